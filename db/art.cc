@@ -0,0 +1,74 @@
+#include <iostream>
+#include <string_view>
+#include "kvbench/kvbench.h"
+#include "art.h"
+
+using namespace kvbench;
+
+template<typename Key, typename Value>
+class ART : public kvbench::DB<Key, Value> {
+ public:
+  int Get(Key key, Value* value) {
+    char buffer[8];
+    return db_.Get(Bytes_(key, buffer), value);
+  }
+
+  int Put(Key key, Value value) {
+    char buffer[8];
+    db_.Put(Bytes_(key, buffer), value);
+    return true;
+  }
+
+  int Update(Key key,  Value value) {
+    char buffer[8];
+    return db_.Update(Bytes_(key, buffer), value);
+  }
+
+  int Delete(Key key) {
+    char buffer[8];
+    return db_.Delete(Bytes_(key, buffer));
+  }
+
+  int Scan(Key min_key, size_t count, Value* values,
+           const Key* max_key = nullptr) {
+    char min_buffer[8], max_buffer[8];
+    std::string_view max;
+    if (max_key) max = Bytes_(*max_key, max_buffer);
+    return db_.Scan(Bytes_(min_key, min_buffer), count, values,
+                    max_key ? &max : nullptr);
+  }
+
+  std::string Name() const {
+    return "ART (OLC)";
+  }
+
+ private:
+  art::Tree<Value> db_;
+
+  // Integer keys are stored big-endian, so that their bytes sort like the
+  // integers.
+  static std::string_view Bytes_(uint64_t key, char* buffer) {
+    for (int i = 0; i < 8; ++i) buffer[i] = key >> (56 - 8 * i);
+    return std::string_view(buffer, 8);
+  }
+
+  static std::string_view Bytes_(std::string_view key, char*) { return key; }
+};
+
+// art_string_bench is built with KVBENCH_STRING_KEYS, for string keys and
+// values of the sizes given by -key-size and -value-size.
+#ifdef KVBENCH_STRING_KEYS
+using BenchKey = std::string_view;
+using BenchValue = std::string_view;
+#else
+using BenchKey = uint64_t;
+using BenchValue = uint64_t;
+#endif
+
+int main(int argc, char** argv) {
+  Bench<BenchKey, BenchValue>* bench = new Bench<BenchKey, BenchValue>(argc, argv);
+  bench->SetDBFactory([] { return new ART<BenchKey, BenchValue>(); });
+  bench->Run();
+  delete bench;
+  return 0;
+}
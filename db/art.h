@@ -0,0 +1,776 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace art {
+
+// Adaptive Radix Tree (Leis et al., ICDE 2013) over byte string keys, with
+// uint64_t or std::string_view values. Inner nodes grow from 4 to 16, 48
+// and 256 children as they fill; Node16 is searched with SSE2. Paths
+// without branches are compressed into a prefix that is stored in full
+// behind the node, so lookups never need to check the key at a leaf
+// against skipped bytes. A key that is a prefix of other keys hangs at the
+// node where it ends.
+//
+// Synchronization is optimistic lock coupling ("The ART of Practical
+// Synchronization"): readers note the version of every node before reading
+// it and restart if it changed, writers lock the node they modify, and its
+// parent when the node is replaced or its prefix is split.
+//
+// Leaves hold the key and the value. Integer values are overwritten in
+// place, string values by replacing the leaf. Replaced nodes and leaves
+// may still be read by concurrent readers, so they are retired and only
+// freed with the tree. Deletes don't shrink nodes.
+template <typename Value>
+class Tree {
+  static_assert(std::is_same<Value, uint64_t>::value ||
+                    std::is_same<Value, std::string_view>::value,
+                "values are uint64_t or std::string_view");
+
+ public:
+  Tree() : root_(NewNode_(kNode256, 0)) {}
+
+  ~Tree() {
+    FreeTree_(root_);
+    for (auto& list : retired_)
+      for (Node* node : list.nodes) Free_(node);
+  }
+
+  Tree(const Tree&) = delete;
+  Tree& operator=(const Tree&) = delete;
+
+  // String values point into the leaf, they stay valid while the tree
+  // exists.
+  bool Get(std::string_view key, Value* value) const {
+    while (true) {
+      Position position;
+      int found = Find_(key, &position);
+      if (found < 0) {
+        Pause();
+        continue;
+      }
+      if (found) *value = ValueOf_(position.leaf);
+      return found;
+    }
+  }
+
+  // Inserts the key or overwrites its value.
+  void Put(std::string_view key, Value value) {
+    while (!TryPut_(key, value)) Pause();
+  }
+
+  // Overwrites the value of an existing key, returns whether it exists.
+  bool Update(std::string_view key, Value value) {
+    while (true) {
+      Position position;
+      int found = Find_(key, &position);
+      if (found == 0) return false;
+      if (found < 0 || !position.node->Upgrade(position.version)) {
+        Pause();
+        continue;
+      }
+      Leaf* leaf = Overwrite_(position.leaf, value);
+      if (leaf != position.leaf) Hang_(position.node, position.byte, leaf);
+      position.node->Unlock();
+      return true;
+    }
+  }
+
+  bool Delete(std::string_view key) {
+    while (true) {
+      Position position;
+      int found = Find_(key, &position);
+      if (found == 0) return false;
+      if (found < 0 || !position.node->Upgrade(position.version)) {
+        Pause();
+        continue;
+      }
+      if (position.byte == kHere)
+        position.node->here = nullptr;
+      else
+        RemoveChild_(position.node, position.byte);
+      position.node->Unlock();
+      Retire_(Tag_(position.leaf));
+      return true;
+    }
+  }
+
+  // Copies the values of up to `count` keys from `min_key` on, and not
+  // above `*max_key` if given, into `values` in key order. Returns the
+  // number of values copied. The children of every node are read
+  // consistently; if a node changes while the scan descends, it restarts
+  // after the last key copied.
+  size_t Scan(std::string_view min_key, size_t count, Value* values,
+              const std::string_view* max_key = nullptr) const {
+    ScanState state{values, count, max_key};
+    state.bound = min_key;
+    while (count > 0 && !Scan_(root_, 0, true, &state)) {
+      if (state.n > 0) {
+        state.bound = state.last;
+        state.exclusive = true;
+      }
+      Pause();
+    }
+    return state.n;
+  }
+
+ private:
+  enum Type : uint8_t { kNode4, kNode16, kNode48, kNode256 };
+  static constexpr uint64_t kLocked = 0b10;
+  static constexpr uint64_t kObsolete = 0b01;
+  static constexpr uint8_t kEmpty48 = 0xFF;
+  static constexpr int kHere = -1;  // a key ending at the node, not a byte
+  static constexpr size_t kRetireLists = 64;
+
+  struct Leaf {
+    std::atomic<uint64_t> value{0};  // integer values
+    uint32_t key_size;
+    uint32_t value_size;  // string values follow the key
+
+    const char* Data() const { return reinterpret_cast<const char*>(this + 1); }
+    char* Data() { return reinterpret_cast<char*>(this + 1); }
+    std::string_view Key() const { return std::string_view(Data(), key_size); }
+  };
+
+  struct Node {
+    // a lock bit, an obsolete bit and a counter of modifications above
+    std::atomic<uint64_t> version{0b100};
+    Type type;
+    uint16_t count = 0;
+    uint32_t prefix_size;  // the prefix follows the node
+    Leaf* here = nullptr;
+
+    Node(Type type, uint32_t prefix_size)
+        : type(type), prefix_size(prefix_size) {}
+
+    uint8_t* Prefix() {
+      return reinterpret_cast<uint8_t*>(this) + SizeOf_(type);
+    }
+
+    // Notes the version, returns false if the node is being modified or
+    // has been replaced.
+    bool ReadLock(uint64_t* version) const {
+      *version = this->version.load(std::memory_order_acquire);
+      return !(*version & (kLocked | kObsolete));
+    }
+
+    // Whether the node is unchanged since `version` was noted.
+    bool Check(uint64_t version) const {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return this->version.load(std::memory_order_relaxed) == version;
+    }
+
+    // Locks the node if it is unchanged since `version` was noted.
+    bool Upgrade(uint64_t version) {
+      return this->version.compare_exchange_strong(
+          version, version + kLocked, std::memory_order_acquire);
+    }
+
+    void Unlock() { version.fetch_add(kLocked, std::memory_order_release); }
+
+    // Unlocks a node that has been replaced, readers of it restart.
+    void UnlockObsolete() {
+      version.fetch_add(kLocked | kObsolete, std::memory_order_release);
+    }
+  };
+
+  // Children are nodes or leaves, leaves are tagged with the lowest bit.
+  struct Node4 : Node {
+    uint8_t keys[4];
+    Node* children[4] = {};
+    explicit Node4(uint32_t prefix_size) : Node(kNode4, prefix_size) {}
+  };
+
+  struct Node16 : Node {
+    uint8_t keys[16];
+    Node* children[16] = {};
+    explicit Node16(uint32_t prefix_size) : Node(kNode16, prefix_size) {}
+  };
+
+  struct Node48 : Node {
+    uint8_t index[256];  // slot in children of every byte, or kEmpty48
+    Node* children[48] = {};
+    explicit Node48(uint32_t prefix_size) : Node(kNode48, prefix_size) {
+      std::memset(index, kEmpty48, sizeof(index));
+    }
+  };
+
+  struct Node256 : Node {
+    Node* children[256] = {};
+    explicit Node256(uint32_t prefix_size) : Node(kNode256, prefix_size) {}
+  };
+
+  // Where a key hangs: below `byte` of `node`, or at `node` if kHere.
+  struct Position {
+    Node* node;
+    uint64_t version;
+    int byte;
+    Leaf* leaf;
+  };
+
+  struct ScanState {
+    Value* values;
+    size_t count;
+    const std::string_view* max_key;
+    size_t n = 0;
+    bool done = false;
+    std::string bound;  // the scan restarts from here
+    bool exclusive = false;
+    std::string last;  // the key of the last value copied
+  };
+
+  struct alignas(64) RetireList {
+    std::mutex mutex;
+    std::vector<Node*> nodes;
+  };
+
+  Node* root_;  // a Node256 without prefix, never replaced
+  mutable RetireList retired_[kRetireLists];
+
+  static void Pause() {
+#if defined(__SSE2__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  static bool IsLeaf_(const Node* child) {
+    return reinterpret_cast<uintptr_t>(child) & 1;
+  }
+
+  static Leaf* AsLeaf_(Node* child) {
+    return reinterpret_cast<Leaf*>(reinterpret_cast<uintptr_t>(child) - 1);
+  }
+
+  static Node* Tag_(Leaf* leaf) {
+    return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(leaf) + 1);
+  }
+
+  static size_t SizeOf_(Type type) {
+    switch (type) {
+      case kNode4:   return sizeof(Node4);
+      case kNode16:  return sizeof(Node16);
+      case kNode48:  return sizeof(Node48);
+      default:       return sizeof(Node256);
+    }
+  }
+
+  static Node* NewNode_(Type type, uint32_t prefix_size) {
+    void* memory = std::malloc(SizeOf_(type) + prefix_size);
+    switch (type) {
+      case kNode4:   return new (memory) Node4(prefix_size);
+      case kNode16:  return new (memory) Node16(prefix_size);
+      case kNode48:  return new (memory) Node48(prefix_size);
+      default:       return new (memory) Node256(prefix_size);
+    }
+  }
+
+  static Leaf* NewLeaf_(std::string_view key, Value value) {
+    size_t value_size = 0;
+    if constexpr (std::is_same<Value, std::string_view>::value)
+      value_size = value.size();
+    Leaf* leaf =
+        new (std::malloc(sizeof(Leaf) + key.size() + value_size)) Leaf();
+    leaf->key_size = key.size();
+    leaf->value_size = value_size;
+    std::memcpy(leaf->Data(), key.data(), key.size());
+    if constexpr (std::is_same<Value, std::string_view>::value)
+      std::memcpy(leaf->Data() + key.size(), value.data(), value_size);
+    else
+      leaf->value.store(value, std::memory_order_relaxed);
+    return leaf;
+  }
+
+  static Value ValueOf_(const Leaf* leaf) {
+    if constexpr (std::is_same<Value, std::string_view>::value)
+      return std::string_view(leaf->Data() + leaf->key_size, leaf->value_size);
+    else
+      return leaf->value.load(std::memory_order_relaxed);
+  }
+
+  // Gives the leaf `value`, returns the leaf to hang in its place. Called
+  // with the node holding it locked.
+  Leaf* Overwrite_(Leaf* leaf, Value value) {
+    if constexpr (std::is_same<Value, std::string_view>::value) {
+      Leaf* replacement = NewLeaf_(leaf->Key(), value);
+      Retire_(Tag_(leaf));
+      return replacement;
+    } else {
+      leaf->value.store(value, std::memory_order_relaxed);
+      return leaf;
+    }
+  }
+
+  // Frees a node or a leaf, but not the children of a node.
+  static void Free_(Node* node) {
+    if (IsLeaf_(node)) {
+      Leaf* leaf = AsLeaf_(node);
+      leaf->~Leaf();
+      std::free(leaf);
+    } else {
+      node->~Node();
+      std::free(node);
+    }
+  }
+
+  static void FreeTree_(Node* node) {
+    if (!IsLeaf_(node)) {
+      if (node->here != nullptr) Free_(Tag_(node->here));
+      uint8_t bytes[256];
+      Node* children[256];
+      int n = Children_(node, bytes, children);
+      for (int i = 0; i < n; ++i) FreeTree_(children[i]);
+    }
+    Free_(node);
+  }
+
+  void Retire_(Node* node) const {
+    RetireList& list =
+        retired_[(reinterpret_cast<uintptr_t>(node) >> 6) % kRetireLists];
+    std::lock_guard<std::mutex> lock(list.mutex);
+    list.nodes.push_back(node);
+  }
+
+  static int Find16_(const Node16* node, uint8_t byte) {
+    int count = node->count;
+#if defined(__SSE2__)
+    __m128i match = _mm_cmpeq_epi8(
+        _mm_set1_epi8(byte),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(node->keys)));
+    unsigned mask = _mm_movemask_epi8(match) & ((1u << count) - 1);
+    return mask ? __builtin_ctz(mask) : -1;
+#else
+    for (int i = 0; i < count; ++i)
+      if (node->keys[i] == byte) return i;
+    return -1;
+#endif
+  }
+
+  // The child below `byte`, or nullptr.
+  static Node* Child_(const Node* node, uint8_t byte) {
+    switch (node->type) {
+      case kNode4: {
+        auto n = static_cast<const Node4*>(node);
+        for (int i = 0; i < n->count && i < 4; ++i)
+          if (n->keys[i] == byte) return n->children[i];
+        return nullptr;
+      }
+      case kNode16: {
+        auto n = static_cast<const Node16*>(node);
+        int i = Find16_(n, byte);
+        return i < 0 ? nullptr : n->children[i];
+      }
+      case kNode48: {
+        auto n = static_cast<const Node48*>(node);
+        uint8_t slot = n->index[byte];
+        return slot == kEmpty48 ? nullptr : n->children[slot];
+      }
+      default:
+        return static_cast<const Node256*>(node)->children[byte];
+    }
+  }
+
+  // The bytes and children of `node` in byte order, returns their number.
+  static int Children_(const Node* node, uint8_t* bytes, Node** children) {
+    int n = 0;
+    switch (node->type) {
+      case kNode4: {
+        auto node4 = static_cast<const Node4*>(node);
+        for (int i = 0; i < node4->count && i < 4; ++i, ++n) {
+          bytes[n] = node4->keys[i];
+          children[n] = node4->children[i];
+        }
+        break;
+      }
+      case kNode16: {
+        auto node16 = static_cast<const Node16*>(node);
+        for (int i = 0; i < node16->count && i < 16; ++i, ++n) {
+          bytes[n] = node16->keys[i];
+          children[n] = node16->children[i];
+        }
+        break;
+      }
+      case kNode48: {
+        auto node48 = static_cast<const Node48*>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+          uint8_t slot = node48->index[byte];
+          if (slot == kEmpty48 || node48->children[slot] == nullptr) continue;
+          bytes[n] = byte;
+          children[n++] = node48->children[slot];
+        }
+        break;
+      }
+      default: {
+        auto node256 = static_cast<const Node256*>(node);
+        for (int byte = 0; byte < 256; ++byte) {
+          if (node256->children[byte] == nullptr) continue;
+          bytes[n] = byte;
+          children[n++] = node256->children[byte];
+        }
+      }
+    }
+    return n;
+  }
+
+  static bool Full_(const Node* node) {
+    switch (node->type) {
+      case kNode4:   return node->count == 4;
+      case kNode16:  return node->count == 16;
+      case kNode48:  return node->count == 48;
+      default:       return false;
+    }
+  }
+
+  // Inserts a child below a byte that has none, the node isn't full.
+  static void AddChild_(Node* node, uint8_t byte, Node* child) {
+    switch (node->type) {
+      case kNode4:
+      case kNode16: {
+        uint8_t* keys;
+        Node** children;
+        if (node->type == kNode4) {
+          keys = static_cast<Node4*>(node)->keys;
+          children = static_cast<Node4*>(node)->children;
+        } else {
+          keys = static_cast<Node16*>(node)->keys;
+          children = static_cast<Node16*>(node)->children;
+        }
+        int pos = 0;
+        while (pos < node->count && keys[pos] < byte) ++pos;
+        std::memmove(keys + pos + 1, keys + pos, node->count - pos);
+        std::memmove(children + pos + 1, children + pos,
+                     (node->count - pos) * sizeof(Node*));
+        keys[pos] = byte;
+        children[pos] = child;
+        break;
+      }
+      case kNode48: {
+        auto n = static_cast<Node48*>(node);
+        int slot = 0;
+        while (n->children[slot] != nullptr) ++slot;
+        n->children[slot] = child;
+        n->index[byte] = slot;
+        break;
+      }
+      default:
+        static_cast<Node256*>(node)->children[byte] = child;
+    }
+    ++node->count;
+  }
+
+  // Replaces the child below `byte`.
+  static void ChangeChild_(Node* node, uint8_t byte, Node* child) {
+    switch (node->type) {
+      case kNode4: {
+        auto n = static_cast<Node4*>(node);
+        for (int i = 0; i < n->count; ++i)
+          if (n->keys[i] == byte) n->children[i] = child;
+        break;
+      }
+      case kNode16: {
+        auto n = static_cast<Node16*>(node);
+        n->children[Find16_(n, byte)] = child;
+        break;
+      }
+      case kNode48: {
+        auto n = static_cast<Node48*>(node);
+        n->children[n->index[byte]] = child;
+        break;
+      }
+      default:
+        static_cast<Node256*>(node)->children[byte] = child;
+    }
+  }
+
+  static void RemoveChild_(Node* node, uint8_t byte) {
+    switch (node->type) {
+      case kNode4:
+      case kNode16: {
+        uint8_t* keys;
+        Node** children;
+        if (node->type == kNode4) {
+          keys = static_cast<Node4*>(node)->keys;
+          children = static_cast<Node4*>(node)->children;
+        } else {
+          keys = static_cast<Node16*>(node)->keys;
+          children = static_cast<Node16*>(node)->children;
+        }
+        int pos = 0;
+        while (keys[pos] != byte) ++pos;
+        std::memmove(keys + pos, keys + pos + 1, node->count - pos - 1);
+        std::memmove(children + pos, children + pos + 1,
+                     (node->count - pos - 1) * sizeof(Node*));
+        break;
+      }
+      case kNode48: {
+        auto n = static_cast<Node48*>(node);
+        n->children[n->index[byte]] = nullptr;
+        n->index[byte] = kEmpty48;
+        break;
+      }
+      default:
+        static_cast<Node256*>(node)->children[byte] = nullptr;
+    }
+    --node->count;
+  }
+
+  // A copy of full `node` of the next larger type.
+  static Node* Grow_(Node* node) {
+    Type type = node->type == kNode4    ? kNode16
+                : node->type == kNode16 ? kNode48
+                                        : kNode256;
+    Node* bigger = NewNode_(type, node->prefix_size);
+    std::memcpy(bigger->Prefix(), node->Prefix(), node->prefix_size);
+    bigger->here = node->here;
+    uint8_t bytes[256];
+    Node* children[256];
+    int n = Children_(node, bytes, children);
+    for (int i = 0; i < n; ++i) AddChild_(bigger, bytes[i], children[i]);
+    return bigger;
+  }
+
+  // Hangs `leaf` of `key` below `node`, which the key reaches at `depth`.
+  static void Hang_(Node* node, std::string_view key, size_t depth,
+                    Leaf* leaf) {
+    if (depth == key.size())
+      node->here = leaf;
+    else
+      AddChild_(node, key[depth], Tag_(leaf));
+  }
+
+  // Puts `leaf` in the place of the one at `byte` of `node`.
+  static void Hang_(Node* node, int byte, Leaf* leaf) {
+    if (byte == kHere)
+      node->here = leaf;
+    else
+      ChangeChild_(node, byte, Tag_(leaf));
+  }
+
+  // Locates `key`. Returns 1 and its position if found, 0 if not, and -1
+  // if the descent has to restart.
+  int Find_(std::string_view key, Position* position) const {
+    Node* node = root_;
+    uint64_t version;
+    if (!node->ReadLock(&version)) return -1;
+    size_t depth = 0;
+    while (true) {
+      uint32_t prefix_size = node->prefix_size;
+      if (prefix_size > 0) {
+        if (key.size() - depth < prefix_size ||
+            std::memcmp(node->Prefix(), key.data() + depth, prefix_size) != 0)
+          return node->Check(version) ? 0 : -1;
+        depth += prefix_size;
+      }
+      int byte = depth == key.size() ? kHere : (uint8_t)key[depth];
+      Node* child = byte == kHere ? (node->here ? Tag_(node->here) : nullptr)
+                                  : Child_(node, byte);
+      if (!node->Check(version)) return -1;
+      if (child == nullptr) return 0;
+      if (IsLeaf_(child)) {
+        Leaf* leaf = AsLeaf_(child);
+        if (leaf->Key() != key) return 0;
+        *position = Position{node, version, byte, leaf};
+        return 1;
+      }
+      // checking the parent again makes sure the child hasn't been
+      // replaced or had its prefix split between the two reads
+      uint64_t child_version;
+      if (!child->ReadLock(&child_version) || !node->Check(version))
+        return -1;
+      node = child;
+      version = child_version;
+      depth += 1;
+    }
+  }
+
+  // One attempt to put the key, returns false to restart.
+  bool TryPut_(std::string_view key, Value value) {
+    Node* parent = nullptr;
+    uint64_t parent_version = 0;
+    uint8_t parent_byte = 0;
+    Node* node = root_;
+    uint64_t version;
+    if (!node->ReadLock(&version)) return false;
+    size_t depth = 0;
+    while (true) {
+      uint32_t prefix_size = node->prefix_size;
+      uint8_t* prefix = node->Prefix();
+      uint32_t match = 0;
+      while (match < prefix_size && depth + match < key.size() &&
+             prefix[match] == (uint8_t)key[depth + match])
+        ++match;
+      if (match < prefix_size) {
+        // the key leaves the compressed path, which is split by a Node4
+        // holding the common part; the root has no prefix, so `parent` is
+        // set
+        if (!parent->Upgrade(parent_version)) return false;
+        if (!node->Upgrade(version)) {
+          parent->Unlock();
+          return false;
+        }
+        Node* split = NewNode_(kNode4, match);
+        std::memcpy(split->Prefix(), prefix, match);
+        Hang_(split, key, depth + match, NewLeaf_(key, value));
+        AddChild_(split, prefix[match], node);
+        // the node keeps the bytes after the one it now hangs below
+        std::memmove(prefix, prefix + match + 1, prefix_size - match - 1);
+        node->prefix_size = prefix_size - match - 1;
+        ChangeChild_(parent, parent_byte, split);
+        node->Unlock();
+        parent->Unlock();
+        return true;
+      }
+      depth += prefix_size;
+
+      if (depth == key.size()) {
+        if (!node->Upgrade(version)) return false;
+        if (node->here != nullptr)
+          node->here = Overwrite_(node->here, value);
+        else
+          node->here = NewLeaf_(key, value);
+        node->Unlock();
+        return true;
+      }
+
+      uint8_t byte = key[depth];
+      Node* child = Child_(node, byte);
+      if (!node->Check(version)) return false;
+
+      if (child == nullptr) {
+        if (!Full_(node)) {
+          if (!node->Upgrade(version)) return false;
+          AddChild_(node, byte, Tag_(NewLeaf_(key, value)));
+          node->Unlock();
+          return true;
+        }
+        // the root is a Node256 and never full, so `parent` is set
+        if (!parent->Upgrade(parent_version)) return false;
+        if (!node->Upgrade(version)) {
+          parent->Unlock();
+          return false;
+        }
+        Node* bigger = Grow_(node);
+        AddChild_(bigger, byte, Tag_(NewLeaf_(key, value)));
+        ChangeChild_(parent, parent_byte, bigger);
+        node->UnlockObsolete();
+        parent->Unlock();
+        Retire_(node);
+        return true;
+      }
+
+      if (IsLeaf_(child)) {
+        if (!node->Upgrade(version)) return false;
+        Leaf* leaf = AsLeaf_(child);
+        std::string_view other = leaf->Key();
+        if (other == key) {
+          Leaf* updated = Overwrite_(leaf, value);
+          if (updated != leaf) ChangeChild_(node, byte, Tag_(updated));
+        } else {
+          // both keys continue below `byte`, under a Node4 holding the
+          // bytes they share after it
+          size_t start = depth + 1;
+          size_t common = 0;
+          while (start + common < key.size() && start + common < other.size() &&
+                 key[start + common] == other[start + common])
+            ++common;
+          Node* split = NewNode_(kNode4, common);
+          std::memcpy(split->Prefix(), key.data() + start, common);
+          Hang_(split, other, start + common, leaf);
+          Hang_(split, key, start + common, NewLeaf_(key, value));
+          ChangeChild_(node, byte, split);
+        }
+        node->Unlock();
+        return true;
+      }
+
+      uint64_t child_version;
+      if (!child->ReadLock(&child_version) || !node->Check(version))
+        return false;
+      parent = node;
+      parent_version = version;
+      parent_byte = byte;
+      node = child;
+      version = child_version;
+      depth += 1;
+    }
+  }
+
+  // Copies `leaf` unless it is outside the bounds of the scan.
+  static void Emit_(const Leaf* leaf, bool bounded, ScanState* state) {
+    std::string_view key = leaf->Key();
+    if (bounded) {
+      int order = key.compare(state->bound);
+      if (order < 0 || (order == 0 && state->exclusive)) return;
+    }
+    if (state->max_key != nullptr && key > *state->max_key) {
+      state->done = true;
+      return;
+    }
+    state->values[state->n++] = ValueOf_(leaf);
+    state->last.assign(key.data(), key.size());
+    if (state->n == state->count) state->done = true;
+  }
+
+  // Scans the subtree of `node`, reached at `depth`. Keys below the bound
+  // are skipped while `bounded`, i.e. while the path equals the bound.
+  // Returns false if the scan has to restart.
+  bool Scan_(Node* node, size_t depth, bool bounded, ScanState* state) const {
+    uint64_t version;
+    if (!node->ReadLock(&version)) return false;
+    const std::string& bound = state->bound;
+    uint32_t prefix_size = node->prefix_size;
+    int order = 0;  // of the prefix to the bound
+    if (bounded) {
+      const uint8_t* prefix = node->Prefix();
+      for (uint32_t i = 0; i < prefix_size && order == 0; ++i) {
+        if (depth + i == bound.size())
+          order = 1;  // the keys below extend the bound
+        else if (prefix[i] != (uint8_t)bound[depth + i])
+          order = prefix[i] < (uint8_t)bound[depth + i] ? -1 : 1;
+      }
+    }
+    Leaf* here = node->here;
+    uint8_t bytes[256];
+    Node* children[256];
+    int n = Children_(node, bytes, children);
+    if (!node->Check(version)) return false;
+    if (order < 0) return true;
+    if (order > 0) bounded = false;
+    depth += prefix_size;
+
+    // the key ending here sorts before the ones below it
+    if (here != nullptr && (!bounded || depth == bound.size()))
+      Emit_(here, bounded, state);
+    int first = 0;
+    if (bounded && depth < bound.size()) {
+      while (first < n && bytes[first] < (uint8_t)bound[depth]) ++first;
+    }
+    for (int i = first; i < n && !state->done; ++i) {
+      bool child_bounded =
+          bounded && depth < bound.size() && bytes[i] == (uint8_t)bound[depth];
+      if (IsLeaf_(children[i]))
+        Emit_(AsLeaf_(children[i]), child_bounded, state);
+      else if (!Scan_(children[i], depth + 1, child_bounded, state))
+        return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace art
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace btreeolc {
+
+// Concurrent B+tree of uint64_t keys and values with optimistic lock
+// coupling (Leis et al., "The ART of Practical Synchronization"). Every
+// node carries a version: readers note it before reading the node and
+// check that it is unchanged afterwards, restarting from the root if not,
+// so lookups and scans write no shared memory. Writers upgrade the
+// version to a lock. Full nodes are split eagerly on the way down, which
+// only ever needs the node and its parent locked.
+//
+// Nodes are four cache lines, so a node is read with few misses and the
+// SIMD search of its keys stays short. Leaves are linked to their right
+// sibling for scans. Deletes don't merge nodes, so nodes are only freed
+// with the tree and readers never see freed memory.
+class BTree {
+ public:
+  BTree() : root_(new Leaf()) {}
+
+  ~BTree() { Free_(root_.load()); }
+
+  BTree(const BTree&) = delete;
+  BTree& operator=(const BTree&) = delete;
+
+  bool Get(uint64_t key, uint64_t* value) const {
+    while (true) {
+      uint64_t version;
+      const Leaf* leaf = FindLeaf_(key, &version);
+      if (leaf == nullptr) continue;
+      int pos = LowerBound(leaf->keys, leaf->count, key);
+      bool found = pos < leaf->count && leaf->keys[pos] == key;
+      uint64_t found_value = found ? leaf->values[pos] : 0;
+      if (!leaf->Check(version)) continue;
+      if (found) *value = found_value;
+      return found;
+    }
+  }
+
+  // Inserts the key or overwrites its value.
+  void Put(uint64_t key, uint64_t value) {
+    while (!TryPut_(key, value)) Pause();
+  }
+
+  // Overwrites the value of an existing key, returns whether it exists.
+  bool Update(uint64_t key, uint64_t value) {
+    while (true) {
+      uint64_t version;
+      Leaf* leaf = FindLeaf_(key, &version);
+      if (leaf == nullptr || !leaf->Upgrade(version)) continue;
+      int pos = LowerBound(leaf->keys, leaf->count, key);
+      bool found = pos < leaf->count && leaf->keys[pos] == key;
+      if (found) leaf->values[pos] = value;
+      leaf->Unlock();
+      return found;
+    }
+  }
+
+  bool Delete(uint64_t key) {
+    while (true) {
+      uint64_t version;
+      Leaf* leaf = FindLeaf_(key, &version);
+      if (leaf == nullptr || !leaf->Upgrade(version)) continue;
+      int pos = LowerBound(leaf->keys, leaf->count, key);
+      bool found = pos < leaf->count && leaf->keys[pos] == key;
+      if (found) {
+        size_t move = leaf->count - pos - 1;
+        std::memmove(leaf->keys + pos, leaf->keys + pos + 1,
+                     move * sizeof(uint64_t));
+        std::memmove(leaf->values + pos, leaf->values + pos + 1,
+                     move * sizeof(uint64_t));
+        --leaf->count;
+      }
+      leaf->Unlock();
+      return found;
+    }
+  }
+
+  // Copies the values of up to `count` keys from `min_key` on, and not
+  // above `*max_key` if given, into `values` in key order. Returns the
+  // number of values copied. A leaf that changes while it is copied is
+  // copied again, so the scan is consistent per leaf. Nodes are never
+  // freed or reused, so reading one that is being modified is harmless
+  // until its version is checked.
+  size_t Scan(uint64_t min_key, size_t count, uint64_t* values,
+              const uint64_t* max_key = nullptr) const {
+    size_t n = 0;
+    uint64_t from = min_key;
+  restart:
+    uint64_t version;
+    const Leaf* leaf = FindLeaf_(from, &version);
+    if (leaf == nullptr) goto restart;
+    while (true) {
+      size_t start = n;
+      bool done = false;
+      int leaf_count = leaf->count;
+      for (int i = LowerBound(leaf->keys, leaf_count, from);
+           i < leaf_count; ++i) {
+        if (max_key != nullptr && leaf->keys[i] > *max_key) {
+          done = true;
+          break;
+        }
+        values[n++] = leaf->values[i];
+        if (n == count) {
+          done = true;
+          break;
+        }
+      }
+      uint64_t last = leaf_count > 0 ? leaf->keys[leaf_count - 1] : 0;
+      const Leaf* next = leaf->next;
+      if (done || next == nullptr) {
+        if (!leaf->Check(version)) {
+          n = start;
+          goto restart;
+        }
+        return n;
+      }
+      uint64_t next_version;
+      if (!next->ReadLock(&next_version) || !leaf->Check(version)) {
+        n = start;
+        goto restart;
+      }
+      // the next leaf only holds keys above the last one of this leaf
+      if (leaf_count > 0) {
+        if (last == UINT64_MAX) return n;
+        from = last + 1;
+      }
+      leaf = next;
+      version = next_version;
+    }
+  }
+
+  // Index of the first of the `count` sorted `keys` that isn't less than
+  // `key`.
+  static int LowerBound(const uint64_t* keys, int count, uint64_t key) {
+    int i = 0;
+#if defined(__AVX2__)
+    // AVX2 only compares signed integers, flipping the sign bits keeps
+    // the order of unsigned ones
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i target =
+        _mm256_xor_si256(_mm256_set1_epi64x(key), sign);
+    for (; i + 4 <= count; i += 4) {
+      __m256i chunk = _mm256_xor_si256(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)),
+          sign);
+      int less = _mm256_movemask_pd(
+          _mm256_castsi256_pd(_mm256_cmpgt_epi64(target, chunk)));
+      if (less != 0xF) return i + __builtin_popcount(less);
+    }
+    while (i < count && keys[i] < key) ++i;
+    return i;
+#else
+    int end = count;
+    while (i < end) {
+      int mid = (i + end) / 2;
+      if (keys[mid] < key)
+        i = mid + 1;
+      else
+        end = mid;
+    }
+    return i;
+#endif
+  }
+
+ private:
+  static constexpr int kInnerSize = 14;
+  static constexpr int kLeafSize = 14;
+  static constexpr uint64_t kLocked = 0b10;
+
+  struct Node {
+    // a lock bit and a counter of modifications above it
+    std::atomic<uint64_t> version{0b100};
+    int16_t count = 0;
+    bool leaf;
+
+    explicit Node(bool leaf) : leaf(leaf) {}
+
+    // Notes the version, returns false if the node is being modified.
+    bool ReadLock(uint64_t* version) const {
+      *version = this->version.load(std::memory_order_acquire);
+      return !(*version & kLocked);
+    }
+
+    // Whether the node is unchanged since `version` was noted.
+    bool Check(uint64_t version) const {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return this->version.load(std::memory_order_relaxed) == version;
+    }
+
+    // Locks the node if it is unchanged since `version` was noted.
+    bool Upgrade(uint64_t version) {
+      return this->version.compare_exchange_strong(
+          version, version + kLocked, std::memory_order_acquire);
+    }
+
+    void Unlock() {
+      // clears the lock bit and counts the modification
+      version.fetch_add(kLocked, std::memory_order_release);
+    }
+  };
+
+  struct alignas(64) Inner : Node {
+    uint64_t keys[kInnerSize];  // keys[i] is the largest key below children[i]
+    Node* children[kInnerSize + 1];
+
+    Inner() : Node(false) {}
+
+    bool Full() const { return count == kInnerSize; }
+
+    void Insert(uint64_t key, Node* child) {
+      int pos = LowerBound(keys, count, key);
+      std::memmove(keys + pos + 1, keys + pos, (count - pos) * sizeof(uint64_t));
+      std::memmove(children + pos + 1, children + pos,
+                   (count - pos + 1) * sizeof(Node*));
+      keys[pos] = key;
+      children[pos] = child;
+      std::swap(children[pos], children[pos + 1]);
+      ++count;
+    }
+
+    // Moves the upper half to a new node, returns it with its separator.
+    Inner* Split(uint64_t* separator) {
+      Inner* right = new Inner();
+      right->count = count - count / 2;
+      count = count - right->count - 1;
+      *separator = keys[count];
+      std::memcpy(right->keys, keys + count + 1,
+                  right->count * sizeof(uint64_t));
+      std::memcpy(right->children, children + count + 1,
+                  (right->count + 1) * sizeof(Node*));
+      return right;
+    }
+  };
+
+  struct alignas(64) Leaf : Node {
+    Leaf* next = nullptr;
+    uint64_t keys[kLeafSize];
+    uint64_t values[kLeafSize];
+
+    Leaf() : Node(true) {}
+
+    bool Full() const { return count == kLeafSize; }
+
+    void Insert(uint64_t key, uint64_t value) {
+      int pos = LowerBound(keys, count, key);
+      if (pos < count && keys[pos] == key) {
+        values[pos] = value;
+        return;
+      }
+      std::memmove(keys + pos + 1, keys + pos, (count - pos) * sizeof(uint64_t));
+      std::memmove(values + pos + 1, values + pos,
+                   (count - pos) * sizeof(uint64_t));
+      keys[pos] = key;
+      values[pos] = value;
+      ++count;
+    }
+
+    Leaf* Split(uint64_t* separator) {
+      Leaf* right = new Leaf();
+      right->count = count - count / 2;
+      count = count - right->count;
+      *separator = keys[count - 1];
+      std::memcpy(right->keys, keys + count, right->count * sizeof(uint64_t));
+      std::memcpy(right->values, values + count,
+                  right->count * sizeof(uint64_t));
+      right->next = next;
+      next = right;
+      return right;
+    }
+  };
+
+  static_assert(sizeof(Inner) == 256 && sizeof(Leaf) == 256,
+                "nodes should fill four cache lines");
+
+  std::atomic<Node*> root_;
+
+  static void Pause() {
+#if defined(__SSE2__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  static void Free_(Node* node) {
+    if (node->leaf) {
+      delete static_cast<Leaf*>(node);
+      return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (int i = 0; i <= inner->count; ++i) Free_(inner->children[i]);
+    delete inner;
+  }
+
+  // The leaf that may hold `key` with its version noted, or nullptr if
+  // the descent has to restart.
+  Leaf* FindLeaf_(uint64_t key, uint64_t* version) const {
+    Node* node = root_.load(std::memory_order_acquire);
+    if (!node->ReadLock(version) ||
+        node != root_.load(std::memory_order_acquire))
+      return nullptr;
+    while (!node->leaf) {
+      Inner* inner = static_cast<Inner*>(node);
+      uint64_t inner_version = *version;
+      node = inner->children[LowerBound(inner->keys, inner->count, key)];
+      if (!inner->Check(inner_version)) return nullptr;
+      // checking the parent again makes sure the child hasn't been split
+      // between reading its pointer and its version
+      if (!node->ReadLock(version) || !inner->Check(inner_version))
+        return nullptr;
+    }
+    return static_cast<Leaf*>(node);
+  }
+
+  void NewRoot_(uint64_t separator, Node* left, Node* right) {
+    Inner* root = new Inner();
+    root->count = 1;
+    root->keys[0] = separator;
+    root->children[0] = left;
+    root->children[1] = right;
+    root_.store(root, std::memory_order_release);
+  }
+
+  // Splits full `node` below `parent` (nullptr at the root). Returns false
+  // if either changed since their versions were noted.
+  template <typename NodeType>
+  bool Split_(NodeType* node, uint64_t version, Inner* parent,
+              uint64_t parent_version) {
+    if (parent != nullptr && !parent->Upgrade(parent_version)) return false;
+    if (!node->Upgrade(version)) {
+      if (parent != nullptr) parent->Unlock();
+      return false;
+    }
+    // the root has been split by another thread meanwhile
+    if (parent == nullptr && node != root_.load(std::memory_order_acquire)) {
+      node->Unlock();
+      return false;
+    }
+    uint64_t separator;
+    Node* right = node->Split(&separator);
+    if (parent != nullptr)
+      parent->Insert(separator, right);
+    else
+      NewRoot_(separator, node, right);
+    node->Unlock();
+    if (parent != nullptr) parent->Unlock();
+    return true;
+  }
+
+  // One attempt to put the key, returns false to restart. Full nodes on
+  // the way are split, which restarts as well.
+  bool TryPut_(uint64_t key, uint64_t value) {
+    Node* node = root_.load(std::memory_order_acquire);
+    uint64_t version;
+    if (!node->ReadLock(&version) ||
+        node != root_.load(std::memory_order_acquire))
+      return false;
+    Inner* parent = nullptr;
+    uint64_t parent_version = 0;
+    while (!node->leaf) {
+      Inner* inner = static_cast<Inner*>(node);
+      if (inner->Full()) {
+        Split_(inner, version, parent, parent_version);
+        return false;
+      }
+      if (parent != nullptr && !parent->Check(parent_version)) return false;
+      parent = inner;
+      parent_version = version;
+      node = inner->children[LowerBound(inner->keys, inner->count, key)];
+      if (!inner->Check(version)) return false;
+      if (!node->ReadLock(&version)) return false;
+    }
+
+    Leaf* leaf = static_cast<Leaf*>(node);
+    if (leaf->Full()) {
+      int pos = LowerBound(leaf->keys, kLeafSize, key);
+      // overwriting needs no room
+      if (pos == kLeafSize || leaf->keys[pos] != key) {
+        Split_(leaf, version, parent, parent_version);
+        return false;
+      }
+    }
+    if (!leaf->Upgrade(version)) return false;
+    if (parent != nullptr && !parent->Check(parent_version)) {
+      leaf->Unlock();
+      return false;
+    }
+    leaf->Insert(key, value);
+    leaf->Unlock();
+    return true;
+  }
+};
+
+}  // namespace btreeolc
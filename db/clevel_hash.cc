@@ -1,3 +1,5 @@
+#include <dlfcn.h>
+
 #include <iostream>
 #include "kvbench/kvbench.h"
 
@@ -24,17 +26,60 @@ struct root {
   nvobj::persistent_ptr<persistent_map_type> cons;
 };
 
+// clevel hashing persists through pool_base::persist(), flush() and drain(),
+// i.e. these libpmemobj calls of the program. If PM is emulated they go
+// through PMem, which counts and delays them; the pool is on tmpfs then and
+// marked as PM, where libpmemobj flushes and fences the same way. Otherwise
+// they go on to libpmemobj unchanged. Persists inside libpmemobj, e.g. of
+// its transactions and allocator, don't pass through here and aren't
+// counted.
+template<typename Function>
+static Function NextSymbol(const char* name) {
+  void* symbol = dlsym(RTLD_NEXT, name);
+  if (symbol == nullptr) {
+    std::cerr << "ERROR! " << name << " isn't found: " << dlerror() << "!"
+              << std::endl;
+    exit(-1);
+  }
+  return reinterpret_cast<Function>(symbol);
+}
+
+extern "C" {
+
+void pmemobj_persist(PMEMobjpool* pop, const void* addr, size_t len) {
+  using Persist = void (*)(PMEMobjpool*, const void*, size_t);
+  if (kvbench::PMem::Emulated()) return kvbench::PMem::Persist(addr, len);
+  static Persist next = NextSymbol<Persist>("pmemobj_persist");
+  next(pop, addr, len);
+}
+
+void pmemobj_flush(PMEMobjpool* pop, const void* addr, size_t len) {
+  using Flush = void (*)(PMEMobjpool*, const void*, size_t);
+  if (kvbench::PMem::Emulated()) return kvbench::PMem::Flush(addr, len);
+  static Flush next = NextSymbol<Flush>("pmemobj_flush");
+  next(pop, addr, len);
+}
+
+void pmemobj_drain(PMEMobjpool* pop) {
+  using Drain = void (*)(PMEMobjpool*);
+  if (kvbench::PMem::Emulated()) return kvbench::PMem::Fence();
+  static Drain next = NextSymbol<Drain>("pmemobj_drain");
+  next(pop);
+}
+
+}
+
 template<typename Key, typename Value>
 class ClevelHash;
 
 template<>
 class ClevelHash<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
  public:
-  ClevelHash() {
-    remove(PATH); // delete the mapped file.
+  ClevelHash() : path_(kvbench::PMem::Path(PATH)) {
+    remove(path_.c_str()); // delete the mapped file.
 
     pop_ = nvobj::pool<root>::create(
-      PATH, LAYOUT, PMEMOBJ_MIN_POOL * 256, S_IWUSR | S_IRUSR);
+      path_, LAYOUT, PMEMOBJ_MIN_POOL * 256, S_IWUSR | S_IRUSR);
     auto proot = pop_.root();
 
     {
@@ -70,23 +115,15 @@ class ClevelHash<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return 0;
   }
 
-  int Scan(uint64_t min_key, std::vector<uint64_t>* values) {
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
     return 0;
   }
 
-  int GetThreadNumber() const {
-    return nr_thread_;
-  }
-
-  void PhaseEnd(kvbench::Operation op, size_t size) {
-    if (op == kvbench::Operation::LOAD)
-      nr_thread_ = 1;
-    else
-      nr_thread_ *= 2;
-
+  void PhaseBegin(kvbench::Operation op, size_t size) {
     nvobj::transaction::manual tx(pop_);
-		db_->set_thread_num(GetThreadNumber() + 1);
-		nvobj::transaction::commit();
+    db_->set_thread_num(GetThreadNumber() + 1);
+    nvobj::transaction::commit();
   }
 
   std::string Name() const {
@@ -94,9 +131,9 @@ class ClevelHash<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
   }
 
  private:
+  std::string path_;
   pmem::obj::persistent_ptr<persistent_map_type> db_;
   nvobj::pool<root> pop_;
-  int nr_thread_ = 1;
 };
 
 int main(int argc, char** argv) {
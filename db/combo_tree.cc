@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include "kvbench/kvbench.h"
 #include "src/scaled_kv.h"
@@ -17,7 +18,9 @@ template<>
 class ComboTree<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
  public:
   ComboTree() {
-    if (AllocatorInit(NODEPATH, NVM_NODE_SIZE, VALUEPATH, NVM_VALUE_SIZE) < 0)
+    if (AllocatorInit(kvbench::PMem::Path(NODEPATH).c_str(), NVM_NODE_SIZE,
+                      kvbench::PMem::Path(VALUEPATH).c_str(),
+                      NVM_VALUE_SIZE) < 0)
       exit(0);
     db_ = new NVMScaledKV();
     db_->Initialize(10, sizeof(uint64_t), 256);
@@ -58,27 +61,28 @@ class ComboTree<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return 0;
   }
 
-  int Scan(uint64_t min_key, std::vector<uint64_t>* values) {
-    void **values = new void*[scan_size_];
+  // The values are the value pointers Put() stored, returned as they are.
+  // GetRange fills up to `count` of them and doesn't report how many it
+  // found, so the slots are marked with a pointer Put() never stores, i.e.
+  // one not aligned to 512 bytes, and the filled ones counted.
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
+    static_assert(sizeof(void*) == sizeof(uint64_t),
+                  "values are returned as pointers");
+    constexpr uint64_t kUnfilled = 1;
     char keybuf[scaledkv::NVM_KeySize + 1];
     scaledkv::fillchar8wirhint64(keybuf, min_key);
     std::string key1(keybuf, scaledkv::NVM_KeySize);
     std::string key2("", 0);
-    db_->GetRange(key1, key2, values, scan_size_);
-    return 0;
-  }
-
-  int GetThreadNumber() const {
-    return nr_thread_;
-  }
-
-  void PhaseEnd(kvbench::Operation op, size_t size) {
-    if (op == kvbench::Operation::LOAD)
-      nr_thread_ = 1;
-    else
-      nr_thread_ *= 2;
-    if (op == kvbench::Operation::SCAN)
-      scan_size_ *= 10;
+    if (max_key) {
+      scaledkv::fillchar8wirhint64(keybuf, *max_key);
+      key2.assign(keybuf, scaledkv::NVM_KeySize);
+    }
+    std::fill(values, values + count, kUnfilled);
+    db_->GetRange(key1, key2, reinterpret_cast<void**>(values), count);
+    size_t n = 0;
+    while (n < count && values[n] != kUnfilled) ++n;
+    return n;
   }
 
   std::string Name() const {
@@ -87,8 +91,6 @@ class ComboTree<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
 
  private:
   NVMScaledKV* db_;
-  int nr_thread_ = 1;
-  size_t scan_size_ = 100;
 };
 
 int main(int argc, char** argv) {
@@ -32,35 +32,20 @@ class FastFair<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return 0;
   }
 
-  int Scan(uint64_t min_key, std::vector<uint64_t>* values) {
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
     int results_found = 0;
-    uint64_t* results = new uint64_t[scan_size_];
-    db_->btree_search_range (min_key, UINT64_MAX, results, scan_size_, results_found);
-    delete results;
-    return 0;
+    db_->btree_search_range(min_key, max_key ? *max_key : UINT64_MAX, values,
+                            count, results_found);
+    return results_found;
   }
 
   std::string Name() const {
     return "Fast Fair";
   }
 
-  int GetThreadNumber() const {
-    return nr_thread_;
-  }
-
-  void PhaseEnd(kvbench::Operation op, size_t size) {
-    if (op == kvbench::Operation::LOAD)
-      nr_thread_ = 1;
-    else
-      nr_thread_ *= 2;
-    if (op == kvbench::Operation::SCAN)
-      scan_size_ *= 10;
-  }
-
  private:
   btree* db_;
-  int nr_thread_ = 1;
-  size_t scan_size_ = 100;
 };
 
 int main(int argc, char** argv) {
@@ -0,0 +1,65 @@
+#include <iostream>
+#include "kvbench/kvbench.h"
+#include "learned_index.h"
+
+template<typename Key, typename Value>
+class LearnedIndex;
+
+template<>
+class LearnedIndex<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
+ public:
+  int Get(uint64_t key, uint64_t* value) {
+    return db_.Get(key, value);
+  }
+
+  int Put(uint64_t key, uint64_t value) {
+    db_.Put(key, value);
+    return true;
+  }
+
+  int Update(uint64_t key,  uint64_t value) {
+    return db_.Update(key, value);
+  }
+
+  int Delete(uint64_t key) {
+    return db_.Delete(key);
+  }
+
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
+    return db_.Scan(min_key, count, values, max_key);
+  }
+
+  // The models are trained on the keys loaded, and retrained once enough
+  // keys went to the delta buffers or were deleted since.
+  void PhaseEnd(kvbench::Operation op, size_t size) {
+    switch (op) {
+      case kvbench::Operation::LOAD:
+        db_.Build();
+        break;
+      case kvbench::Operation::PUT:
+      case kvbench::Operation::DELETE:
+      case kvbench::Operation::MIX:
+      case kvbench::Operation::TRACE:
+        if (db_.Stale()) db_.Build();
+        break;
+      default:
+        break;
+    }
+  }
+
+  std::string Name() const {
+    return "Learned Index (RMI)";
+  }
+
+ private:
+  learnedindex::LearnedIndex db_;
+};
+
+int main(int argc, char** argv) {
+  kvbench::Bench<uint64_t, uint64_t>* bench = new kvbench::Bench<uint64_t, uint64_t>(argc, argv);
+  bench->SetDBFactory([] { return new LearnedIndex<uint64_t, uint64_t>(); });
+  bench->Run();
+  delete bench;
+  return 0;
+}
@@ -0,0 +1,538 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace learnedindex {
+
+// Learned index of uint64_t keys and values: a two-layer recursive model
+// index (Kraska et al., "The Case for Learned Index Structures") over a
+// sorted array. The root model, linear in the key, routes a key to one of
+// the segments of the second layer; every segment is a linear model of the
+// positions of its keys with the largest errors it makes on them, so a
+// lookup is a prediction and a binary search within the error bounds.
+// Since the root model is monotonic, a segment holds a contiguous range of
+// the array and scans go through the segments in order.
+//
+// Build() sorts all keys and trains the models; it has to run while no
+// other operation does, which the engine does between phases. Keys put
+// before the first build are staged in a hash table. Afterwards, values of
+// keys in the array are overwritten in place and deletes only mark the
+// keys, while new keys go into the delta buffer of their segment: a sorted
+// array with room reserved for inserts, which writers change under the
+// segment's sequence lock and readers read optimistically. The next build
+// merges the delta buffers into the array.
+class LearnedIndex {
+ public:
+  LearnedIndex() = default;
+
+  ~LearnedIndex() { FreeDeltas_(); }
+
+  LearnedIndex(const LearnedIndex&) = delete;
+  LearnedIndex& operator=(const LearnedIndex&) = delete;
+
+  bool Get(uint64_t key, uint64_t* value) const {
+    if (!built_) return Stage_(key).Get(key, value);
+    const Segment& segment = segments_[Route_(key)];
+    size_t pos = Search_(segment, key);
+    if (pos < segment.end && keys_[pos] == key) {
+      if (!live_[pos].load(std::memory_order_acquire)) return false;
+      *value = values_[pos].load(std::memory_order_relaxed);
+      return true;
+    }
+    return DeltaGet_(segment, key, value);
+  }
+
+  // Inserts the key or overwrites its value.
+  void Put(uint64_t key, uint64_t value) {
+    if (!built_) {
+      Stage_(key).Put(key, value);
+      return;
+    }
+    Segment& segment = segments_[Route_(key)];
+    size_t pos = Search_(segment, key);
+    if (pos < segment.end && keys_[pos] == key) {
+      values_[pos].store(value, std::memory_order_relaxed);
+      live_[pos].store(1, std::memory_order_release);
+      return;
+    }
+    DeltaPut_(segment, key, value);
+  }
+
+  // Overwrites the value of an existing key, returns whether it exists.
+  bool Update(uint64_t key, uint64_t value) {
+    if (!built_) return Stage_(key).Update(key, value);
+    Segment& segment = segments_[Route_(key)];
+    size_t pos = Search_(segment, key);
+    if (pos < segment.end && keys_[pos] == key) {
+      if (!live_[pos].load(std::memory_order_acquire)) return false;
+      values_[pos].store(value, std::memory_order_relaxed);
+      return true;
+    }
+    return DeltaUpdate_(segment, key, value);
+  }
+
+  bool Delete(uint64_t key) {
+    if (!built_) return Stage_(key).Delete(key);
+    Segment& segment = segments_[Route_(key)];
+    size_t pos = Search_(segment, key);
+    if (pos < segment.end && keys_[pos] == key)
+      return live_[pos].exchange(0, std::memory_order_acq_rel);
+    return DeltaDelete_(segment, key);
+  }
+
+  // Copies the values of up to `count` keys from `min_key` on, and not
+  // above `*max_key` if given, into `values` in key order. Returns the
+  // number of values copied.
+  size_t Scan(uint64_t min_key, size_t count, uint64_t* values,
+              const uint64_t* max_key = nullptr) const {
+    if (!built_) return StagedScan_(min_key, count, values, max_key);
+    thread_local std::vector<Entry> delta;
+    size_t n = 0;
+    uint64_t limit = max_key != nullptr ? *max_key : UINT64_MAX;
+    for (size_t s = Route_(min_key); s < segments_.size() && n < count; ++s) {
+      const Segment& segment = segments_[s];
+      size_t pos = Search_(segment, min_key);
+      SnapshotDelta_(segment, &delta);
+      size_t d = std::lower_bound(delta.begin(), delta.end(), min_key,
+                                  [](const Entry& entry, uint64_t key) {
+                                    return entry.key < key;
+                                  }) -
+                 delta.begin();
+      // both are sorted and disjoint
+      while (n < count && (pos < segment.end || d < delta.size())) {
+        bool from_array =
+            d == delta.size() || (pos < segment.end && keys_[pos] < delta[d].key);
+        uint64_t key = from_array ? keys_[pos] : delta[d].key;
+        if (key > limit) return n;
+        if (!from_array) {
+          values[n++] = delta[d++].value;
+        } else {
+          if (live_[pos].load(std::memory_order_acquire))
+            values[n++] = values_[pos].load(std::memory_order_relaxed);
+          ++pos;
+        }
+      }
+    }
+    return n;
+  }
+
+  // Merges the staged keys, the delta buffers and the array and trains the
+  // models on the result. No other operation may run meanwhile.
+  void Build() {
+    std::vector<std::pair<uint64_t, uint64_t>> items;
+    for (size_t i = 0; i < keys_.size(); ++i)
+      if (live_[i].load(std::memory_order_relaxed))
+        items.emplace_back(keys_[i], values_[i].load(std::memory_order_relaxed));
+    for (auto& segment : segments_) {
+      const Entry* entries = segment.delta.entries.load();
+      for (uint32_t i = 0; i < segment.delta.count.load(); ++i)
+        items.emplace_back(entries[i].key, entries[i].value);
+    }
+    for (auto& stage : stages_) {
+      for (auto& item : stage.items) items.push_back(item);
+      stage.items.clear();
+    }
+    std::sort(items.begin(), items.end());
+    FreeDeltas_();
+
+    size_t n = items.size();
+    keys_.resize(n);
+    values_.reset(new std::atomic<uint64_t>[n]);
+    live_.reset(new std::atomic<uint8_t>[n]);
+    for (size_t i = 0; i < n; ++i) {
+      keys_[i] = items[i].first;
+      values_[i].store(items[i].second, std::memory_order_relaxed);
+      live_[i].store(1, std::memory_order_relaxed);
+    }
+    TrainRoot_();
+    TrainSegments_();
+    built_ = true;
+  }
+
+  // Whether the index was never built, or its delta buffers and deleted
+  // keys have grown enough for a build to pay off. No other operation may
+  // run meanwhile.
+  bool Stale() const {
+    if (!built_) return true;
+    size_t changed = 0;
+    for (auto& segment : segments_) changed += segment.delta.count.load();
+    for (size_t i = 0; i < keys_.size(); ++i)
+      changed += !live_[i].load(std::memory_order_relaxed);
+    return changed * kStaleRatio > keys_.size();
+  }
+
+ private:
+  // keys per segment the second layer is sized for
+  static constexpr size_t kSegmentKeys = 128;
+  static constexpr size_t kStages = 64;
+  static constexpr size_t kMinDeltaCapacity = 8;
+  // the index is stale once 1/kStaleRatio of its keys changed
+  static constexpr size_t kStaleRatio = 8;
+  static constexpr unsigned kYieldSpins = 64;
+
+  struct Entry {
+    uint64_t key;
+    uint64_t value;
+  };
+
+  struct Delta {
+    // odd while a writer changes the buffer
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<uint32_t> count{0};
+    uint32_t capacity = 0;
+    std::atomic<Entry*> entries{nullptr};
+
+    void Lock() {
+      unsigned spins = 0;
+      while (true) {
+        uint32_t sequence = this->sequence.load(std::memory_order_relaxed);
+        if (!(sequence & 1) &&
+            this->sequence.compare_exchange_weak(sequence, sequence + 1,
+                                                 std::memory_order_acquire))
+          return;
+        Pause(&spins);
+      }
+    }
+
+    void Unlock() {
+      sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+    }
+  };
+
+  struct alignas(64) Segment {
+    // position = slope * (key - base) + intercept
+    uint64_t base = 0;
+    double slope = 0.0;
+    double intercept = 0.0;
+    // the predictions of the keys of [begin, end) are at most this far
+    // above and below their positions
+    size_t error_below = 0;
+    size_t error_above = 0;
+    size_t begin = 0;
+    size_t end = 0;
+    Delta delta;
+  };
+
+  // A stripe of the keys put before the first build.
+  struct alignas(64) Stage {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, uint64_t> items;
+
+    bool Get(uint64_t key, uint64_t* value) {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto iter = items.find(key);
+      if (iter == items.end()) return false;
+      *value = iter->second;
+      return true;
+    }
+
+    void Put(uint64_t key, uint64_t value) {
+      std::lock_guard<std::mutex> lock(mutex);
+      items[key] = value;
+    }
+
+    bool Update(uint64_t key, uint64_t value) {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto iter = items.find(key);
+      if (iter == items.end()) return false;
+      iter->second = value;
+      return true;
+    }
+
+    bool Delete(uint64_t key) {
+      std::lock_guard<std::mutex> lock(mutex);
+      return items.erase(key) > 0;
+    }
+  };
+
+  bool built_ = false;
+  std::vector<uint64_t> keys_;
+  std::unique_ptr<std::atomic<uint64_t>[]> values_;
+  std::unique_ptr<std::atomic<uint8_t>[]> live_;  // 0 if deleted
+  // root model: segment = root_slope_ * (key - min_key_) + root_intercept_
+  uint64_t min_key_ = 0;
+  double root_slope_ = 0.0;
+  double root_intercept_ = 0.0;
+  std::vector<Segment> segments_;
+  mutable Stage stages_[kStages];
+  // delta buffers replaced while growing, readers may still be reading them
+  std::mutex retired_mutex_;
+  std::vector<Entry*> retired_;
+
+  // Waits for a writer of a delta buffer, yielding now and then in case
+  // the writer was preempted while holding the lock.
+  static void Pause(unsigned* spins) {
+#if defined(__SSE2__)
+    if (++*spins % kYieldSpins != 0) {
+      _mm_pause();
+      return;
+    }
+#endif
+    std::this_thread::yield();
+  }
+
+  Stage& Stage_(uint64_t key) const {
+    return stages_[(key * 0x9E3779B97F4A7C15ULL) >> 58];
+  }
+
+  size_t StagedScan_(uint64_t min_key, size_t count, uint64_t* values,
+                     const uint64_t* max_key) const {
+    std::vector<std::pair<uint64_t, uint64_t>> items;
+    for (auto& stage : stages_) {
+      std::lock_guard<std::mutex> lock(stage.mutex);
+      for (auto& item : stage.items)
+        if (item.first >= min_key &&
+            (max_key == nullptr || item.first <= *max_key))
+          items.push_back(item);
+    }
+    size_t n = std::min(count, items.size());
+    std::partial_sort(items.begin(), items.begin() + n, items.end());
+    for (size_t i = 0; i < n; ++i) values[i] = items[i].second;
+    return n;
+  }
+
+  size_t Route_(uint64_t key) const {
+    double prediction =
+        key <= min_key_
+            ? root_intercept_
+            : root_slope_ * (double)(key - min_key_) + root_intercept_;
+    if (prediction <= 0.0) return 0;
+    size_t segment = (size_t)prediction;
+    return std::min(segment, segments_.size() - 1);
+  }
+
+  // Position of the first key of the segment not less than `key`.
+  size_t Search_(const Segment& segment, uint64_t key) const {
+    double prediction =
+        key <= segment.base
+            ? segment.intercept
+            : segment.slope * (double)(key - segment.base) + segment.intercept;
+    size_t guess = prediction <= (double)segment.begin ? segment.begin
+                   : prediction >= (double)segment.end
+                       ? segment.end
+                       : (size_t)prediction;
+    size_t low = guess > segment.begin + segment.error_above
+                     ? guess - segment.error_above
+                     : segment.begin;
+    size_t high = std::min(guess + segment.error_below + 1, segment.end);
+    const uint64_t* keys = keys_.data();
+    size_t pos = std::lower_bound(keys + low, keys + high, key) - keys;
+    // keys not trained on may lie outside the bounds
+    if (pos == low && low > segment.begin && keys[low - 1] >= key)
+      pos = std::lower_bound(keys + segment.begin, keys + low, key) - keys;
+    else if (pos == high && high < segment.end && keys[high] < key)
+      pos = std::lower_bound(keys + high, keys + segment.end, key) - keys;
+    return pos;
+  }
+
+  // Least-squares fit of y over x, returns slope and intercept.
+  template <typename X, typename Y>
+  static std::pair<double, double> Fit_(size_t n, X x, Y y) {
+    if (n == 0) return {0.0, 0.0};
+    double mean_x = 0.0, mean_y = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+      mean_x += x(i);
+      mean_y += y(i);
+    }
+    mean_x /= n;
+    mean_y /= n;
+    double covariance = 0.0, variance = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+      double dx = x(i) - mean_x;
+      covariance += dx * (y(i) - mean_y);
+      variance += dx * dx;
+    }
+    double slope = variance > 0.0 ? covariance / variance : 0.0;
+    // keep the models monotonic
+    if (slope < 0.0) slope = 0.0;
+    return {slope, mean_y - slope * mean_x};
+  }
+
+  void TrainRoot_() {
+    size_t n = keys_.size();
+    size_t segments = std::max<size_t>(1, n / kSegmentKeys);
+    min_key_ = n > 0 ? keys_[0] : 0;
+    auto fit = Fit_(
+        n, [&](size_t i) { return (double)(keys_[i] - min_key_); },
+        [&](size_t i) { return (double)i * segments / n; });
+    root_slope_ = fit.first;
+    root_intercept_ = fit.second;
+    segments_ = std::vector<Segment>(segments);
+  }
+
+  void TrainSegments_() {
+    size_t n = keys_.size();
+    size_t pos = 0;
+    for (size_t s = 0; s < segments_.size(); ++s) {
+      Segment& segment = segments_[s];
+      segment.begin = pos;
+      while (pos < n && Route_(keys_[pos]) == s) ++pos;
+      segment.end = pos;
+      size_t size = segment.end - segment.begin;
+      segment.base = size > 0 ? keys_[segment.begin] : 0;
+      auto fit = Fit_(
+          size,
+          [&](size_t i) { return (double)(keys_[segment.begin + i] - segment.base); },
+          [&](size_t i) { return (double)(segment.begin + i); });
+      segment.slope = fit.first;
+      segment.intercept = size > 0 ? fit.second : (double)segment.begin;
+      segment.error_below = segment.error_above = 0;
+      for (size_t i = segment.begin; i < segment.end; ++i) {
+        double prediction =
+            segment.slope * (double)(keys_[i] - segment.base) + segment.intercept;
+        size_t guess = prediction <= (double)segment.begin ? segment.begin
+                       : prediction >= (double)segment.end
+                           ? segment.end
+                           : (size_t)prediction;
+        if (guess > i)
+          segment.error_above = std::max(segment.error_above, guess - i);
+        else
+          segment.error_below = std::max(segment.error_below, i - guess);
+      }
+    }
+  }
+
+  void FreeDeltas_() {
+    for (auto& segment : segments_) delete[] segment.delta.entries.load();
+    for (Entry* entries : retired_) delete[] entries;
+    retired_.clear();
+  }
+
+  // Index of the first entry of the delta buffer not less than `key`.
+  static uint32_t DeltaSearch_(const Entry* entries, uint32_t count,
+                               uint64_t key) {
+    uint32_t low = 0, high = count;
+    while (low < high) {
+      uint32_t mid = (low + high) / 2;
+      if (entries[mid].key < key)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return low;
+  }
+
+  // Reads a consistent buffer and count of the delta buffer and returns the
+  // sequence they were read at. Writers only move entries within a buffer,
+  // and replaced buffers are kept until the next build, so reading the
+  // first `*count` entries stays in bounds until the sequence is checked.
+  static uint32_t ReadDelta_(const Delta& delta, const Entry** entries,
+                             uint32_t* count, unsigned* spins) {
+    while (true) {
+      uint32_t sequence = delta.sequence.load(std::memory_order_acquire);
+      if (sequence & 1) {
+        Pause(spins);
+        continue;
+      }
+      *entries = delta.entries.load(std::memory_order_acquire);
+      *count = delta.count.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (delta.sequence.load(std::memory_order_relaxed) == sequence)
+        return sequence;
+    }
+  }
+
+  bool DeltaGet_(const Segment& segment, uint64_t key, uint64_t* value) const {
+    const Delta& delta = segment.delta;
+    unsigned spins = 0;
+    while (true) {
+      const Entry* entries;
+      uint32_t count;
+      uint32_t sequence = ReadDelta_(delta, &entries, &count, &spins);
+      uint32_t i = DeltaSearch_(entries, count, key);
+      bool found = i < count && entries[i].key == key;
+      uint64_t found_value = found ? entries[i].value : 0;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (delta.sequence.load(std::memory_order_relaxed) != sequence) continue;
+      if (found) *value = found_value;
+      return found;
+    }
+  }
+
+  void SnapshotDelta_(const Segment& segment, std::vector<Entry>* out) const {
+    const Delta& delta = segment.delta;
+    unsigned spins = 0;
+    while (true) {
+      const Entry* entries;
+      uint32_t count;
+      uint32_t sequence = ReadDelta_(delta, &entries, &count, &spins);
+      out->assign(entries, entries + count);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (delta.sequence.load(std::memory_order_relaxed) == sequence) return;
+    }
+  }
+
+  void DeltaPut_(Segment& segment, uint64_t key, uint64_t value) {
+    Delta& delta = segment.delta;
+    delta.Lock();
+    Entry* entries = delta.entries.load(std::memory_order_relaxed);
+    uint32_t count = delta.count.load(std::memory_order_relaxed);
+    uint32_t i = DeltaSearch_(entries, count, key);
+    if (i < count && entries[i].key == key) {
+      entries[i].value = value;
+      delta.Unlock();
+      return;
+    }
+    if (count == delta.capacity) {
+      // readers may be in the old buffer, it is freed by the next build
+      delta.capacity = std::max<uint32_t>(kMinDeltaCapacity, count * 2);
+      Entry* grown = new Entry[delta.capacity];
+      if (count > 0) std::memcpy(grown, entries, count * sizeof(Entry));
+      if (entries != nullptr) {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        retired_.push_back(entries);
+      }
+      entries = grown;
+      delta.entries.store(entries, std::memory_order_release);
+    }
+    std::memmove(entries + i + 1, entries + i, (count - i) * sizeof(Entry));
+    entries[i] = Entry{key, value};
+    delta.count.store(count + 1, std::memory_order_relaxed);
+    delta.Unlock();
+  }
+
+  bool DeltaUpdate_(Segment& segment, uint64_t key, uint64_t value) {
+    Delta& delta = segment.delta;
+    delta.Lock();
+    Entry* entries = delta.entries.load(std::memory_order_relaxed);
+    uint32_t count = delta.count.load(std::memory_order_relaxed);
+    uint32_t i = DeltaSearch_(entries, count, key);
+    bool found = i < count && entries[i].key == key;
+    if (found) entries[i].value = value;
+    delta.Unlock();
+    return found;
+  }
+
+  bool DeltaDelete_(Segment& segment, uint64_t key) {
+    Delta& delta = segment.delta;
+    delta.Lock();
+    Entry* entries = delta.entries.load(std::memory_order_relaxed);
+    uint32_t count = delta.count.load(std::memory_order_relaxed);
+    uint32_t i = DeltaSearch_(entries, count, key);
+    bool found = i < count && entries[i].key == key;
+    if (found) {
+      std::memmove(entries + i, entries + i + 1,
+                   (count - i - 1) * sizeof(Entry));
+      delta.count.store(count - 1, std::memory_order_relaxed);
+    }
+    delta.Unlock();
+    return found;
+  }
+};
+
+}  // namespace learnedindex
@@ -30,7 +30,8 @@ class LevelHash<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return 0;
   }
 
-  int Scan(uint64_t min_key, std::vector<uint64_t>* values) {
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
     return 0;
   }
 
@@ -38,20 +39,8 @@ class LevelHash<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return "Level Hashing";
   }
 
-  int GetThreadNumber() const {
-    return nr_thread_;
-  }
-
-  void PhaseEnd(kvbench::Operation op, size_t size) {
-    if (op == kvbench::Operation::LOAD)
-      nr_thread_ = 1;
-    else
-      nr_thread_ *= 2;
-  }
-
  private:
   Hash* db_;
-  int nr_thread_ = 1;
 };
 
 int main(int argc, char** argv) {
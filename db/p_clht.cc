@@ -6,7 +6,7 @@ template<typename Key, typename Value>
 class CLHT;
 
 template<>
-class CLHT<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
+class CLHT<uint64_t, uint64_t> : public kvbench::CoroDB<uint64_t, uint64_t> {
  public:
   CLHT() : db_(clht_create(512)) {
     clht_gc_thread_init(db_, 0);
@@ -33,28 +33,35 @@ class CLHT<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
     return 0;
   }
 
-  int Scan(uint64_t min_key, std::vector<uint64_t>* values) {
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
     return 0;
   }
 
-  std::string Name() const {
-    return "Level Hashing";
+#ifdef KVBENCH_HAVE_CORO
+  // Prefetches the bucket of the key and suspends; the chain behind the
+  // first bucket is rare enough to be walked without suspending. The table
+  // may be resized while suspended, so the operation reloads it and the
+  // bucket prefetched is only a hint.
+  kvbench::Task CoGet(uint64_t key, uint64_t* value) {
+    clht_hashtable_t* ht = db_->ht;
+    co_await kvbench::Prefetch(ht->table + clht_hash(ht, key));
+    *value = clht_get(db_->ht, key);
   }
 
-  int GetThreadNumber() const {
-    return nr_thread_;
+  kvbench::Task CoPut(uint64_t key, uint64_t value) {
+    clht_hashtable_t* ht = db_->ht;
+    co_await kvbench::Prefetch(ht->table + clht_hash(ht, key));
+    clht_put(db_, key, value);
   }
+#endif
 
-  void PhaseEnd(kvbench::Operation op, size_t size) {
-    if (op == kvbench::Operation::LOAD)
-      nr_thread_ = 1;
-    else
-      nr_thread_ *= 2;
+  std::string Name() const {
+    return "Level Hashing";
   }
 
  private:
   clht_t* db_;
-  int nr_thread_;
 };
 
 int main(int argc, char** argv) {
@@ -0,0 +1,47 @@
+#include <iostream>
+#include "kvbench/kvbench.h"
+#include "skiplist.h"
+
+template<typename Key, typename Value>
+class SkipList;
+
+template<>
+class SkipList<uint64_t, uint64_t> : public kvbench::DB<uint64_t, uint64_t> {
+ public:
+  int Get(uint64_t key, uint64_t* value) {
+    return db_.Get(key, value);
+  }
+
+  int Put(uint64_t key, uint64_t value) {
+    db_.Put(key, value);
+    return true;
+  }
+
+  int Update(uint64_t key,  uint64_t value) {
+    return db_.Update(key, value);
+  }
+
+  int Delete(uint64_t key) {
+    return db_.Delete(key);
+  }
+
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
+    return db_.Scan(min_key, count, values, max_key);
+  }
+
+  std::string Name() const {
+    return "SkipList (lock-free)";
+  }
+
+ private:
+  skiplist::SkipList db_;
+};
+
+int main(int argc, char** argv) {
+  kvbench::Bench<uint64_t, uint64_t>* bench = new kvbench::Bench<uint64_t, uint64_t>(argc, argv);
+  bench->SetDBFactory([] { return new SkipList<uint64_t, uint64_t>(); });
+  bench->Run();
+  delete bench;
+  return 0;
+}
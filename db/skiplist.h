@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <new>
+#include <vector>
+
+namespace skiplist {
+
+// Lock-free skiplist of uint64_t keys and values (Herlihy and Shavit, "The
+// Art of Multiprocessor Programming", 14.4). A node is in the set while
+// it is linked at the bottom level and its bottom link isn't marked.
+// Deleting a node marks its links from the top down, the marked bottom
+// link being the deletion, and the next traversal through it unlinks it
+// by CAS. Tower heights are geometric with p = 1/4, drawn from a
+// per-thread generator.
+//
+// Unlinked nodes are reclaimed with epochs: every operation announces the
+// global epoch it runs in, and a node unlinked in epoch e is reused once
+// the epoch reached e + 2, as no operation that could have seen it is
+// still running then. Nodes come from per-thread arenas with free lists
+// per tower height, so nodes freed by deletes are reused by later
+// inserts, while the arena chunks are only returned with the list.
+class SkipList {
+ public:
+  SkipList() : id_(next_id_.fetch_add(1) + 1) {
+    void* memory =
+        std::malloc(sizeof(Node) + (kMaxHeight - 1) * sizeof(Node*));
+    head_ = new (memory) Node(0, 0, kMaxHeight);
+  }
+
+  ~SkipList() {
+    std::free(head_);
+    size_t threads = std::min(threads_.load(), kMaxThreads);
+    for (size_t i = 0; i < threads; ++i)
+      for (void* chunk : threads_state_[i].chunks) std::free(chunk);
+  }
+
+  SkipList(const SkipList&) = delete;
+  SkipList& operator=(const SkipList&) = delete;
+
+  bool Get(uint64_t key, uint64_t* value) {
+    Guard guard(this);
+    Node* node = Seek_(key);
+    if (node == nullptr || node->key != key) return false;
+    *value = node->value.load(std::memory_order_relaxed);
+    return true;
+  }
+
+  // Inserts the key or overwrites its value.
+  void Put(uint64_t key, uint64_t value) {
+    Guard guard(this);
+    Node* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+    while (true) {
+      if (Find_(key, preds, succs)) {
+        succs[0]->value.store(value, std::memory_order_relaxed);
+        return;
+      }
+      Node* node = Allocate_(guard.state, RandomHeight_(guard.state));
+      node->key = key;
+      node->value.store(value, std::memory_order_relaxed);
+      for (int level = 0; level < node->height; ++level)
+        node->next[level].store(succs[level], std::memory_order_relaxed);
+      // the bottom link inserts the key, the others are shortcuts
+      Node* succ = succs[0];
+      if (!preds[0]->next[0].compare_exchange_strong(
+              succ, node, std::memory_order_release)) {
+        Free_(guard.state, node);  // never published
+        continue;
+      }
+      LinkTower_(guard.state, node, preds, succs);
+      return;
+    }
+  }
+
+  // Overwrites the value of an existing key, returns whether it exists.
+  bool Update(uint64_t key, uint64_t value) {
+    Guard guard(this);
+    Node* node = Seek_(key);
+    if (node == nullptr || node->key != key) return false;
+    node->value.store(value, std::memory_order_relaxed);
+    return true;
+  }
+
+  bool Delete(uint64_t key) {
+    Guard guard(this);
+    Node* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+    if (!Find_(key, preds, succs)) return false;
+    Node* node = succs[0];
+    for (int level = node->height - 1; level > 0; --level) {
+      Node* next = node->next[level].load(std::memory_order_acquire);
+      while (!IsMarked_(next) &&
+             !node->next[level].compare_exchange_weak(next, Mark_(next)))
+        ;
+    }
+    Node* next = node->next[0].load(std::memory_order_acquire);
+    while (true) {
+      if (IsMarked_(next)) return false;  // deleted by another thread
+      if (node->next[0].compare_exchange_weak(next, Mark_(next))) break;
+    }
+    Find_(key, preds, succs);  // unlinks it
+    Finish_(guard.state, node, kDeleted);
+    return true;
+  }
+
+  // Copies the values of up to `count` keys from `min_key` on, and not
+  // above `*max_key` if given, into `values` by following the bottom
+  // level. Returns the number of values copied.
+  size_t Scan(uint64_t min_key, size_t count, uint64_t* values,
+              const uint64_t* max_key = nullptr) {
+    Guard guard(this);
+    size_t n = 0;
+    Node* node = Seek_(min_key);
+    while (node != nullptr && n < count) {
+      Node* next = node->next[0].load(std::memory_order_acquire);
+      if (!IsMarked_(next)) {
+        if (max_key != nullptr && node->key > *max_key) break;
+        values[n++] = node->value.load(std::memory_order_relaxed);
+      }
+      node = Unmark_(next);
+    }
+    return n;
+  }
+
+ private:
+  static constexpr int kMaxHeight = 16;
+  static constexpr size_t kMaxThreads = 1024;
+  static constexpr size_t kChunkSize = 1 << 20;
+  // a thread tries to advance the epoch every this many retired nodes
+  static constexpr size_t kReclaimInterval = 64;
+  static constexpr uint8_t kLinked = 1;   // the tower is done
+  static constexpr uint8_t kDeleted = 2;  // the node has been unlinked
+
+  struct Node {
+    uint64_t key;
+    std::atomic<uint64_t> value;
+    uint8_t height;
+    // unlinked nodes are retired by the last of their inserter and deleter
+    std::atomic<uint8_t> state{0};
+    std::atomic<Node*> next[1];  // `height` links, the lowest bit marks
+
+    Node(uint64_t key, uint64_t value, int height)
+        : key(key), value(value), height(height) {
+      for (int level = 0; level < height; ++level)
+        next[level].store(nullptr, std::memory_order_relaxed);
+    }
+  };
+
+  struct Retired {
+    Node* node;
+    uint64_t epoch;
+  };
+
+  struct alignas(64) ThreadState {
+    // the epoch the running operation announced, shifted left, with the
+    // lowest bit set while one runs
+    std::atomic<uint64_t> epoch{0};
+    uint64_t random = 0;
+    std::deque<Retired> retired;
+    std::vector<Node*> free[kMaxHeight];  // by height - 1
+    std::vector<void*> chunks;
+    char* chunk_next = nullptr;
+    char* chunk_end = nullptr;
+  };
+
+  // Announces the epoch for the lifetime of an operation.
+  struct Guard {
+    ThreadState& state;
+
+    explicit Guard(SkipList* list) : state(list->State_()) {
+      state.epoch.store(list->epoch_.load(std::memory_order_relaxed) << 1 | 1,
+                        std::memory_order_seq_cst);
+    }
+
+    ~Guard() { state.epoch.store(0, std::memory_order_release); }
+  };
+
+  static inline std::atomic<uint64_t> next_id_{0};
+
+  const uint64_t id_;  // tells apart lists at the same address
+  Node* head_;
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<size_t> threads_{0};
+  ThreadState threads_state_[kMaxThreads];
+
+  static bool IsMarked_(Node* next) {
+    return reinterpret_cast<uintptr_t>(next) & 1;
+  }
+
+  static Node* Mark_(Node* next) {
+    return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(next) | 1);
+  }
+
+  static Node* Unmark_(Node* next) {
+    return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(next) & ~1ULL);
+  }
+
+  ThreadState& State_() {
+    struct Cache {
+      uint64_t id = 0;
+      ThreadState* state = nullptr;
+    };
+    thread_local Cache cache;
+    if (cache.id != id_) {
+      size_t index = threads_.fetch_add(1);
+      if (index >= kMaxThreads) {
+        std::cerr << "ERROR! more than " << kMaxThreads
+                  << " threads used the skiplist!" << std::endl;
+        exit(-1);
+      }
+      cache.state = &threads_state_[index];
+      cache.state->random = (index + 1) * 0x9E3779B97F4A7C15ULL;
+      cache.id = id_;
+    }
+    return *cache.state;
+  }
+
+  static int RandomHeight_(ThreadState& state) {
+    // xorshift64*
+    state.random ^= state.random >> 12;
+    state.random ^= state.random << 25;
+    state.random ^= state.random >> 27;
+    uint64_t random = state.random * 0x2545F4914F6CDD1DULL;
+    int height = 1;
+    while (height < kMaxHeight && (random & 3) == 0) {
+      ++height;
+      random >>= 2;
+    }
+    return height;
+  }
+
+  static Node* Allocate_(ThreadState& state, int height) {
+    std::vector<Node*>& free = state.free[height - 1];
+    if (!free.empty()) {
+      Node* node = free.back();
+      free.pop_back();
+      return new (node) Node(0, 0, height);
+    }
+    size_t size = sizeof(Node) + (height - 1) * sizeof(Node*);
+    if (state.chunk_next + size > state.chunk_end) {
+      state.chunk_next = static_cast<char*>(std::malloc(kChunkSize));
+      state.chunk_end = state.chunk_next + kChunkSize;
+      state.chunks.push_back(state.chunk_next);
+    }
+    Node* node = new (state.chunk_next) Node(0, 0, height);
+    state.chunk_next += size;
+    return node;
+  }
+
+  static void Free_(ThreadState& state, Node* node) {
+    state.free[node->height - 1].push_back(node);
+  }
+
+  // The first node not deleted with a key not less than `key`, or nullptr.
+  // Doesn't write.
+  Node* Seek_(uint64_t key) const {
+    Node* pred = head_;
+    Node* curr = nullptr;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      curr = Unmark_(pred->next[level].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        Node* succ = curr->next[level].load(std::memory_order_acquire);
+        if (IsMarked_(succ)) {
+          curr = Unmark_(succ);  // deleted, skip it
+        } else if (curr->key < key) {
+          pred = curr;
+          curr = succ;
+        } else {
+          break;
+        }
+      }
+    }
+    return curr;
+  }
+
+  // The last nodes before `key` and the first ones not before it on every
+  // level, unlinking marked nodes on the way. Returns whether the key is
+  // there.
+  bool Find_(uint64_t key, Node** preds, Node** succs) {
+  retry:
+    Node* pred = head_;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+      Node* curr = Unmark_(pred->next[level].load(std::memory_order_acquire));
+      while (curr != nullptr) {
+        Node* succ = curr->next[level].load(std::memory_order_acquire);
+        if (IsMarked_(succ)) {
+          Node* expected = curr;
+          // fails if pred is being deleted itself
+          if (!pred->next[level].compare_exchange_strong(
+                  expected, Unmark_(succ), std::memory_order_acq_rel))
+            goto retry;
+          curr = Unmark_(succ);
+        } else if (curr->key < key) {
+          pred = curr;
+          curr = succ;
+        } else {
+          break;
+        }
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+    return succs[0] != nullptr && succs[0]->key == key;
+  }
+
+  // Links the upper levels of a node inserted at the bottom, unless it is
+  // deleted meanwhile.
+  void LinkTower_(ThreadState& state, Node* node, Node** preds, Node** succs) {
+    for (int level = 1; level < node->height; ++level) {
+      while (true) {
+        Node* next = node->next[level].load(std::memory_order_acquire);
+        if (IsMarked_(next)) goto done;
+        if (next != succs[level] &&
+            !node->next[level].compare_exchange_strong(next, succs[level]))
+          continue;
+        Node* succ = succs[level];
+        if (preds[level]->next[level].compare_exchange_strong(
+                succ, node, std::memory_order_release))
+          break;
+        // another node went in between, or the node has been unlinked
+        Find_(node->key, preds, succs);
+        if (succs[0] != node) goto done;
+      }
+    }
+  done:
+    // a delete racing with the links may have missed the latest ones
+    if (IsMarked_(node->next[0].load(std::memory_order_acquire)))
+      Find_(node->key, preds, succs);
+    Finish_(state, node, kLinked);
+  }
+
+  // Retires the node once both its inserter and its deleter are done with
+  // it, so that no link is added after it is unlinked.
+  void Finish_(ThreadState& state, Node* node, uint8_t done) {
+    if (node->state.fetch_or(done, std::memory_order_acq_rel) & ~done)
+      Retire_(state, node);
+  }
+
+  void Retire_(ThreadState& state, Node* node) {
+    state.retired.push_back(
+        Retired{node, epoch_.load(std::memory_order_acquire)});
+    if (state.retired.size() % kReclaimInterval != 0) return;
+    TryAdvance_();
+    uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    while (!state.retired.empty() &&
+           state.retired.front().epoch + 2 <= epoch) {
+      Free_(state, state.retired.front().node);
+      state.retired.pop_front();
+    }
+  }
+
+  // Moves to the next epoch if every running operation announced the
+  // current one.
+  void TryAdvance_() {
+    uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    size_t threads = std::min(threads_.load(), kMaxThreads);
+    for (size_t i = 0; i < threads; ++i) {
+      uint64_t announced =
+          threads_state_[i].epoch.load(std::memory_order_acquire);
+      if ((announced & 1) && (announced >> 1) != epoch) return;
+    }
+    epoch_.compare_exchange_strong(epoch, epoch + 1);
+  }
+};
+
+}  // namespace skiplist
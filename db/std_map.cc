@@ -1,11 +1,20 @@
 #include <iostream>
 #include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include "kvbench/kvbench.h"
 
 using namespace kvbench;
 
+// std::string_view keys and values are only valid during a call, the map
+// keeps std::string copies of them.
+template<typename T>
+using Stored = typename std::conditional<
+    std::is_same<T, std::string_view>::value, std::string, T>::type;
+
 template<typename Key, typename Value>
-class Map : public kvbench::DB<Key, Value> {
+class Map : public kvbench::CoroDB<Key, Value> {
  public:
   int Get(Key key, Value* value) {
     auto iter = map_.find(key);
@@ -17,7 +26,7 @@ class Map : public kvbench::DB<Key, Value> {
   }
 
   int Put(Key key, Value value) {
-    map_.insert(std::pair<Key, Value>(key, value));
+    map_.emplace(key, value);
     return true;
   }
 
@@ -26,26 +35,95 @@ class Map : public kvbench::DB<Key, Value> {
   }
 
   int Delete(Key key) {
-    map_.erase(key);
+    auto iter = map_.find(key);
+    if (iter != map_.end()) map_.erase(iter);
     return 0;
   }
 
-  int Scan(Key min_key, std::vector<Value>* values) {
-    return 0;
+  int Scan(Key min_key, size_t count, Value* values,
+           const Key* max_key = nullptr) {
+    size_t n = 0;
+    for (auto iter = map_.lower_bound(min_key);
+         iter != map_.end() && n < count; ++iter) {
+      if (max_key && *max_key < iter->first) break;
+      values[n++] = iter->second;
+    }
+    return n;
+  }
+
+#if defined(KVBENCH_HAVE_CORO) && defined(__GLIBCXX__)
+  // std::map doesn't expose its nodes, so with libstdc++ the interleaved
+  // operations walk the red-black tree by hand, prefetching every node of
+  // the path and suspending before its key is compared. Other standard
+  // libraries take the default path of CoroDB and search without
+  // suspending.
+  kvbench::Task CoGet(Key key, Value* value) {
+    Node* node = Root_();
+    Node* result = nullptr;
+    while (node != nullptr) {
+      co_await kvbench::Prefetch(node->_M_valptr());
+      if (node->_M_valptr()->first < key) {
+        node = static_cast<Node*>(node->_M_right);
+      } else {
+        result = node;
+        node = static_cast<Node*>(node->_M_left);
+      }
+    }
+    if (result != nullptr && !(key < result->_M_valptr()->first))
+      *value = result->_M_valptr()->second;
+  }
+
+  // Only prefetches the path, emplace_hint() then checks the hint, so that
+  // inserts of other coroutines in between can't misplace the key.
+  kvbench::Task CoPut(Key key, Value value) {
+    Node* node = Root_();
+    Node* result = nullptr;
+    while (node != nullptr) {
+      co_await kvbench::Prefetch(node->_M_valptr());
+      if (node->_M_valptr()->first < key) {
+        node = static_cast<Node*>(node->_M_right);
+      } else {
+        result = node;
+        node = static_cast<Node*>(node->_M_left);
+      }
+    }
+    map_.emplace_hint(result ? Iterator(result) : map_.end(), key, value);
   }
+#endif
 
   std::string Name() const {
     return "std::map";
   }
 
  private:
-  std::map<Key, Value> map_;
+  using StoredMap = std::map<Stored<Key>, Stored<Value>, std::less<>>;
+
+  StoredMap map_;
+
+#if defined(KVBENCH_HAVE_CORO) && defined(__GLIBCXX__)
+  using Iterator = typename StoredMap::iterator;
+  using Node = std::_Rb_tree_node<typename StoredMap::value_type>;
+
+  Node* Root_() {
+    // the parent of the header node, i.e. end(), is the root
+    return static_cast<Node*>(map_.end()._M_node->_M_parent);
+  }
+#endif
 };
 
+// std_map_string_bench is built with KVBENCH_STRING_KEYS, for string keys
+// and values of the sizes given by -key-size and -value-size.
+#ifdef KVBENCH_STRING_KEYS
+using BenchKey = std::string_view;
+using BenchValue = std::string_view;
+#else
+using BenchKey = uint64_t;
+using BenchValue = uint64_t;
+#endif
+
 int main(int argc, char** argv) {
-  Bench<uint64_t, uint64_t>* bench = new Bench<uint64_t, uint64_t>(argc, argv);
-  DB<uint64_t, uint64_t>* db = new Map<uint64_t, uint64_t>();
-  bench->SetDB(db);
+  Bench<BenchKey, BenchValue>* bench = new Bench<BenchKey, BenchValue>(argc, argv);
+  bench->SetDBFactory([] { return new Map<BenchKey, BenchValue>(); });
   bench->Run();
   delete bench;
   return 0;
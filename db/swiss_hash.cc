@@ -0,0 +1,61 @@
+#include <iostream>
+#include "kvbench/kvbench.h"
+#include "swiss_hash.h"
+
+template<typename Key, typename Value>
+class SwissHash;
+
+template<>
+class SwissHash<uint64_t, uint64_t> : public kvbench::CoroDB<uint64_t, uint64_t> {
+ public:
+  int Get(uint64_t key, uint64_t* value) {
+    return db_.Get(key, value);
+  }
+
+  int Put(uint64_t key, uint64_t value) {
+    db_.Put(key, value);
+    return true;
+  }
+
+  int Update(uint64_t key,  uint64_t value) {
+    return db_.Update(key, value);
+  }
+
+  int Delete(uint64_t key) {
+    return db_.Delete(key);
+  }
+
+  int Scan(uint64_t min_key, size_t count, uint64_t* values,
+           const uint64_t* max_key = nullptr) {
+    return 0;
+  }
+
+#ifdef KVBENCH_HAVE_CORO
+  // Prefetches the first group of the probe sequence and suspends, later
+  // groups are rare enough to be probed without suspending.
+  kvbench::Task CoGet(uint64_t key, uint64_t* value) {
+    co_await kvbench::Prefetch(db_.HomeGroup(key));
+    db_.Get(key, value);
+  }
+
+  kvbench::Task CoPut(uint64_t key, uint64_t value) {
+    co_await kvbench::Prefetch(db_.HomeGroup(key));
+    db_.Put(key, value);
+  }
+#endif
+
+  std::string Name() const {
+    return "Swiss Hash";
+  }
+
+ private:
+  swisshash::HashTable db_;
+};
+
+int main(int argc, char** argv) {
+  kvbench::Bench<uint64_t, uint64_t>* bench = new kvbench::Bench<uint64_t, uint64_t>(argc, argv);
+  bench->SetDBFactory([] { return new SwissHash<uint64_t, uint64_t>(); });
+  bench->Run();
+  delete bench;
+  return 0;
+}
@@ -0,0 +1,511 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace swisshash {
+
+// Concurrent open-addressing hash table of uint64_t keys and values in the
+// style of Swiss tables: slots are organized in groups with one control
+// byte per slot, which holds 7 bits of the key's hash or marks the slot as
+// empty or deleted, so that a lookup compares all control bytes of a group
+// with one SIMD instruction (32 slots per group with AVX2, 16 with SSE2)
+// and only touches keys whose hash bits match. Groups are probed
+// quadratically until one with an empty slot.
+//
+// Readers don't write shared memory: every group carries a sequence number
+// that writers make odd while they change the group, and readers retry a
+// group whose number changed while they read it. Writers of the same key
+// serialize on one of kStripes spinlocks picked by its hash, independently
+// of the table, so that a key is only ever in one place.
+//
+// The table doubles incrementally: once it is 7/8 used (deleted slots
+// count until they are dropped by the next resize) a new table is
+// published and every following insert moves kMigrateGroups groups of the
+// old table, while lookups check the old table before the new one. Should
+// the new table fill up before the migration ends, both are rehashed into
+// a larger one with all stripes locked. Retired tables are only freed with
+// the whole table, as readers may still probe them.
+class HashTable {
+ public:
+  explicit HashTable(size_t capacity = 0) {
+    size_t groups = kMinGroups;
+    while (groups * kGroupSize * 7 / 8 < capacity) groups *= 2;
+    Table* table = NewTable_(groups);
+    tables_.push_back(table);
+    table_.store(table, std::memory_order_release);
+  }
+
+  ~HashTable() {
+    for (Table* table : tables_) FreeTable_(table);
+  }
+
+  HashTable(const HashTable&) = delete;
+  HashTable& operator=(const HashTable&) = delete;
+
+  bool Get(uint64_t key, uint64_t* value) const {
+    uint64_t hash = Hash(key);
+    while (true) {
+      Table* table = table_.load(std::memory_order_acquire);
+      Table* old = old_.load(std::memory_order_acquire);
+      // entries move from the old table to the new one before they are
+      // deleted from the old, so checking the old one first can't miss them
+      if (old != nullptr && old != table && Find_(old, key, hash, value))
+        return true;
+      if (Find_(table, key, hash, value)) return true;
+      // a resize may have moved the key past us
+      if (table_.load(std::memory_order_acquire) == table) return false;
+    }
+  }
+
+  // Inserts the key or overwrites its value.
+  void Put(uint64_t key, uint64_t value) { Write_(key, value, true); }
+
+  // Overwrites the value of an existing key, returns whether it exists.
+  bool Update(uint64_t key, uint64_t value) {
+    return Write_(key, value, false);
+  }
+
+  bool Delete(uint64_t key) {
+    uint64_t hash = Hash(key);
+    Stripe& stripe = stripes_[StripeOf_(hash)];
+    stripe.Lock();
+    bool found = false;
+    Table* old = old_.load(std::memory_order_acquire);
+    if (old != nullptr) found = Erase_(old, key, hash);
+    if (!found) found = Erase_(table_.load(std::memory_order_acquire), key, hash);
+    if (found) --stripe.live;
+    stripe.Unlock();
+    return found;
+  }
+
+  // The group `key` is looked up in first, for prefetching.
+  const void* HomeGroup(uint64_t key) const {
+    Table* table = table_.load(std::memory_order_acquire);
+    return &table->groups[(Hash(key) >> 7) & table->mask];
+  }
+
+  static uint64_t Hash(uint64_t key) {
+    // MurmurHash3 finalizer
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return key;
+  }
+
+ private:
+#if defined(__AVX2__)
+  static constexpr size_t kGroupSize = 32;
+#else
+  static constexpr size_t kGroupSize = 16;
+#endif
+  using Mask = uint32_t;  // one bit per slot of a group
+  static constexpr int8_t kEmpty = -128;   // 0b10000000
+  static constexpr int8_t kDeleted = -2;   // 0b11111110
+  static constexpr size_t kMinGroups = 16;
+  static constexpr size_t kStripes = 256;
+  static constexpr size_t kMigrateGroups = 2;
+
+  struct alignas(64) Group {
+    std::atomic<uint32_t> sequence{0};
+    alignas(kGroupSize) int8_t ctrl[kGroupSize];
+    std::atomic<uint64_t> keys[kGroupSize];
+    std::atomic<uint64_t> values[kGroupSize];
+
+    // Slots whose control byte equals `h2`.
+    Mask Match(int8_t h2) const {
+#if defined(__AVX2__)
+      __m256i ctrl_bytes =
+          _mm256_load_si256(reinterpret_cast<const __m256i*>(ctrl));
+      return _mm256_movemask_epi8(
+          _mm256_cmpeq_epi8(ctrl_bytes, _mm256_set1_epi8(h2)));
+#elif defined(__SSE2__)
+      __m128i ctrl_bytes =
+          _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_bytes, _mm_set1_epi8(h2)));
+#else
+      Mask mask = 0;
+      for (size_t i = 0; i < kGroupSize; ++i)
+        if (ctrl[i] == h2) mask |= (Mask)1 << i;
+      return mask;
+#endif
+    }
+
+    Mask MatchEmpty() const { return Match(kEmpty); }
+
+    // Empty and deleted slots, i.e. the ones with the sign bit set.
+    Mask MatchFree() const {
+#if defined(__AVX2__)
+      return _mm256_movemask_epi8(
+          _mm256_load_si256(reinterpret_cast<const __m256i*>(ctrl)));
+#elif defined(__SSE2__)
+      return _mm_movemask_epi8(
+          _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl)));
+#else
+      Mask mask = 0;
+      for (size_t i = 0; i < kGroupSize; ++i)
+        if (ctrl[i] < 0) mask |= (Mask)1 << i;
+      return mask;
+#endif
+    }
+
+    void Lock() {
+      while (true) {
+        uint32_t sequence = this->sequence.load(std::memory_order_relaxed);
+        if (!(sequence & 1) &&
+            this->sequence.compare_exchange_weak(sequence, sequence + 1,
+                                                 std::memory_order_acquire))
+          return;
+        Pause();
+      }
+    }
+
+    void Unlock() {
+      sequence.store(sequence.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+    }
+  };
+
+  struct Table {
+    Group* groups;
+    size_t mask;  // number of groups - 1
+    std::atomic<size_t> migrate_next{0};
+    std::atomic<size_t> migrated{0};
+    std::atomic<size_t> used{0};  // full and deleted slots
+
+    bool Crowded() const {
+      return used.load(std::memory_order_relaxed) >
+             (mask + 1) * kGroupSize * 7 / 8;
+    }
+  };
+
+  struct alignas(64) Stripe {
+    std::atomic<bool> locked{false};
+    int64_t live = 0;  // keys, may be negative in a single stripe
+
+    void Lock() {
+      while (locked.exchange(true, std::memory_order_acquire))
+        while (locked.load(std::memory_order_relaxed)) Pause();
+    }
+
+    void Unlock() { locked.store(false, std::memory_order_release); }
+  };
+
+  std::atomic<Table*> table_{nullptr};
+  std::atomic<Table*> old_{nullptr};
+  Stripe stripes_[kStripes];
+  std::mutex resize_mutex_;
+  std::vector<Table*> tables_;  // all tables ever published
+
+  static void Pause() {
+#if defined(__SSE2__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  static int8_t H2(uint64_t hash) { return hash & 0x7F; }
+
+  static size_t StripeOf_(uint64_t hash) { return hash >> 56; }
+
+  static Table* NewTable_(size_t groups) {
+    Table* table = new Table();
+    table->groups = new Group[groups];
+    table->mask = groups - 1;
+    for (size_t i = 0; i < groups; ++i)
+      std::memset(table->groups[i].ctrl, kEmpty, kGroupSize);
+    return table;
+  }
+
+  static void FreeTable_(Table* table) {
+    delete[] table->groups;
+    delete table;
+  }
+
+  // Calls `visit(group)` on the groups of the probe sequence of `hash`
+  // until it returns true or a group has an empty slot. Returns whether
+  // `visit` returned true.
+  template <typename Visit>
+  static bool Probe_(Table* table, uint64_t hash, Visit visit) {
+    size_t index = (hash >> 7) & table->mask;
+    for (size_t step = 1; step <= table->mask + 1; ++step) {
+      Group& group = table->groups[index];
+      bool empty = false;
+      if (visit(group, empty)) return true;
+      if (empty) return false;
+      index = (index + step) & table->mask;  // triangular numbers
+    }
+    return false;
+  }
+
+  static bool Find_(Table* table, uint64_t key, uint64_t hash,
+                    uint64_t* value) {
+    int8_t h2 = H2(hash);
+    return Probe_(table, hash, [&](Group& group, bool& empty) {
+      while (true) {
+        uint32_t sequence = group.sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+          Pause();
+          continue;
+        }
+        bool found = false;
+        uint64_t found_value = 0;
+        for (Mask match = group.Match(h2); match != 0; match &= match - 1) {
+          int slot = __builtin_ctz(match);
+          if (group.keys[slot].load(std::memory_order_relaxed) == key) {
+            found_value = group.values[slot].load(std::memory_order_relaxed);
+            found = true;
+            break;
+          }
+        }
+        empty = group.MatchEmpty() != 0;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (group.sequence.load(std::memory_order_relaxed) != sequence)
+          continue;
+        if (found) *value = found_value;
+        return found;
+      }
+    });
+  }
+
+  // Slot of `key` in `group`, or -1. Called with the key's stripe locked,
+  // so the key can't appear or disappear meanwhile.
+  static int SlotOf_(const Group& group, uint64_t key, int8_t h2) {
+    for (Mask match = group.Match(h2); match != 0; match &= match - 1) {
+      int slot = __builtin_ctz(match);
+      if (group.keys[slot].load(std::memory_order_relaxed) == key) return slot;
+    }
+    return -1;
+  }
+
+  static bool Assign_(Table* table, uint64_t key, uint64_t hash,
+                      uint64_t value) {
+    int8_t h2 = H2(hash);
+    return Probe_(table, hash, [&](Group& group, bool& empty) {
+      int slot = SlotOf_(group, key, h2);
+      if (slot >= 0) {
+        group.Lock();
+        group.values[slot].store(value, std::memory_order_relaxed);
+        group.Unlock();
+        return true;
+      }
+      empty = group.MatchEmpty() != 0;
+      return false;
+    });
+  }
+
+  static bool Erase_(Table* table, uint64_t key, uint64_t hash) {
+    int8_t h2 = H2(hash);
+    return Probe_(table, hash, [&](Group& group, bool& empty) {
+      int slot = SlotOf_(group, key, h2);
+      if (slot >= 0) {
+        group.Lock();
+        group.ctrl[slot] = kDeleted;
+        group.Unlock();
+        return true;
+      }
+      empty = group.MatchEmpty() != 0;
+      return false;
+    });
+  }
+
+  // Puts a key that isn't in `table` into the first free slot of its probe
+  // sequence. Returns whether it took an empty slot rather than a deleted
+  // one, or false with `*full` set if the table has no free slot.
+  static bool Insert_(Table* table, uint64_t key, uint64_t hash,
+                      uint64_t value, bool* full) {
+    bool took_empty = false;
+    *full = !Probe_(table, hash, [&](Group& group, bool& empty) {
+      while (true) {
+        Mask free = group.MatchFree();
+        if (free == 0) return false;
+        group.Lock();
+        // another stripe may have taken the slot before we locked
+        free = group.MatchFree();
+        if (free == 0) {
+          group.Unlock();
+          continue;
+        }
+        int slot = __builtin_ctz(free);
+        took_empty = group.ctrl[slot] == kEmpty;
+        group.keys[slot].store(key, std::memory_order_relaxed);
+        group.values[slot].store(value, std::memory_order_relaxed);
+        // writers of other keys check the control byte before the key
+        std::atomic_thread_fence(std::memory_order_release);
+        group.ctrl[slot] = H2(hash);
+        group.Unlock();
+        return true;
+      }
+    });
+    return took_empty;
+  }
+
+  bool Write_(uint64_t key, uint64_t value, bool insert) {
+    uint64_t hash = Hash(key);
+    size_t stripe_id = StripeOf_(hash);
+    Stripe& stripe = stripes_[stripe_id];
+    stripe.Lock();
+    // the tables only change with all stripes locked
+    Table* table = table_.load(std::memory_order_acquire);
+    Table* old = old_.load(std::memory_order_acquire);
+    bool found = (old != nullptr && Assign_(old, key, hash, value)) ||
+                 Assign_(table, key, hash, value);
+    bool check = false;
+    bool full = false;
+    if (!found && insert) {
+      if (Insert_(table, key, hash, value, &full)) {
+        table->used.fetch_add(1, std::memory_order_relaxed);
+        check = true;
+      }
+      if (!full) ++stripe.live;
+    }
+    stripe.Unlock();
+
+    if (full) {
+      // only possible if inserts outran the migration, finish it and grow
+      Grow_(table, true);
+      return Write_(key, value, insert);
+    }
+    if (old != nullptr && insert) Migrate_(old, table);
+    if (check && table->Crowded()) Grow_(table, false);
+    return found;
+  }
+
+  // Moves up to kMigrateGroups groups of `old` to `table`.
+  void Migrate_(Table* old, Table* table) {
+    size_t groups = old->mask + 1;
+    for (size_t i = 0; i < kMigrateGroups; ++i) {
+      size_t index = old->migrate_next.fetch_add(1, std::memory_order_relaxed);
+      if (index >= groups) return;
+      if (!MigrateGroup_(old, table, old->groups[index])) {
+        // `table` is full, the rest of `old` is rehashed along with it
+        Rehash_(table);
+        return;
+      }
+      if (old->migrated.fetch_add(1, std::memory_order_acq_rel) + 1 == groups)
+        Retire_(old);
+    }
+  }
+
+  // Returns false, leaving the keys not moved yet in `group`, if `table` is
+  // full.
+  bool MigrateGroup_(Table* old, Table* table, Group& group) {
+    for (size_t slot = 0; slot < kGroupSize; ++slot) {
+      if (group.ctrl[slot] < 0) continue;
+      uint64_t key = group.keys[slot].load(std::memory_order_relaxed);
+      uint64_t hash = Hash(key);
+      Stripe& stripe = stripes_[StripeOf_(hash)];
+      stripe.Lock();
+      // deleted or moved by its writer meanwhile
+      if (group.ctrl[slot] >= 0 &&
+          group.keys[slot].load(std::memory_order_relaxed) == key) {
+        bool full;
+        if (Insert_(table, key, hash,
+                    group.values[slot].load(std::memory_order_relaxed), &full))
+          table->used.fetch_add(1, std::memory_order_relaxed);
+        if (full) {
+          stripe.Unlock();
+          return false;
+        }
+        group.Lock();
+        group.ctrl[slot] = kDeleted;
+        group.Unlock();
+      }
+      stripe.Unlock();
+    }
+    return true;
+  }
+
+  // Replaces `table` and the old table still migrating into it by a table
+  // holding the keys of both, with all stripes locked. The migration can't
+  // finish once `table` is full, which only happens if inserts outran it.
+  void Rehash_(Table* table) {
+    std::lock_guard<std::mutex> lock(resize_mutex_);
+    if (table_.load(std::memory_order_acquire) != table) return;
+    for (auto& stripe : stripes_) stripe.Lock();
+    Table* old = old_.load(std::memory_order_acquire);
+    // with all stripes locked every key is in exactly one of them
+    size_t live = 0;
+    for (Table* from : {old, table}) {
+      if (from == nullptr) continue;
+      for (size_t i = 0; i <= from->mask; ++i)
+        for (size_t slot = 0; slot < kGroupSize; ++slot)
+          live += from->groups[i].ctrl[slot] >= 0;
+    }
+    size_t groups = (table->mask + 1) * 2;
+    while (live > groups * kGroupSize / 2) groups *= 2;
+    Table* next = NewTable_(groups);
+    tables_.push_back(next);
+    for (Table* from : {old, table}) {
+      if (from == nullptr) continue;
+      for (size_t i = 0; i <= from->mask; ++i) {
+        Group& group = from->groups[i];
+        for (size_t slot = 0; slot < kGroupSize; ++slot) {
+          if (group.ctrl[slot] < 0) continue;
+          uint64_t key = group.keys[slot].load(std::memory_order_relaxed);
+          bool full;
+          Insert_(next, key, Hash(key),
+                  group.values[slot].load(std::memory_order_relaxed), &full);
+        }
+      }
+    }
+    next->used.store(live, std::memory_order_relaxed);
+    // readers that see the new old_ with the previous table_ retry, as
+    // table_ changed
+    old_.store(nullptr, std::memory_order_release);
+    table_.store(next, std::memory_order_release);
+    for (auto& stripe : stripes_) stripe.Unlock();
+  }
+
+  void Retire_(Table* old) {
+    std::lock_guard<std::mutex> lock(resize_mutex_);
+    if (old_.load(std::memory_order_acquire) == old)
+      old_.store(nullptr, std::memory_order_release);
+  }
+
+  // Publishes a table twice the size of `table`, or of the same size if
+  // most of its used slots are deleted ones. With `finish` the running
+  // migration is completed first instead of giving up.
+  void Grow_(Table* table, bool finish) {
+    std::unique_lock<std::mutex> lock(resize_mutex_);
+    if (table_.load(std::memory_order_acquire) != table) return;
+    Table* old = old_.load(std::memory_order_acquire);
+    if (old != nullptr) {
+      if (!finish) return;
+      lock.unlock();
+      while (old_.load(std::memory_order_acquire) == old) {
+        Migrate_(old, table);
+        if (old->migrate_next.load(std::memory_order_relaxed) > old->mask)
+          std::this_thread::yield();  // the last groups are being moved
+      }
+      lock.lock();
+      if (table_.load(std::memory_order_acquire) != table) return;
+    }
+
+    for (auto& stripe : stripes_) stripe.Lock();
+    int64_t live = 0;
+    for (auto& stripe : stripes_) live += stripe.live;
+    size_t groups = table->mask + 1;
+    if ((size_t)live * 2 > groups * kGroupSize || finish) groups *= 2;
+    Table* next = NewTable_(groups);
+    tables_.push_back(next);
+    old_.store(table, std::memory_order_release);
+    table_.store(next, std::memory_order_release);
+    for (auto& stripe : stripes_) stripe.Unlock();
+  }
+};
+
+}  // namespace swisshash
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace kvbench {
+
+// Parses a cpu list such as "0-3,8,10-11".
+inline std::vector<int> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) end = list.size();
+    std::string range = list.substr(pos, end - pos);
+    size_t dash = range.find('-');
+    if (!range.empty()) {
+      int first = std::stoi(range.substr(0, dash));
+      int last = dash == std::string::npos ? first
+                                           : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    pos = end + 1;
+  }
+  return cpus;
+}
+
+// CPUs the process may run on, grouped by NUMA node. Machines without NUMA
+// information in sysfs are treated as a single node.
+inline std::vector<std::vector<int>> NumaTopology() {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  sched_getaffinity(0, sizeof(allowed), &allowed);
+
+  std::vector<std::vector<int>> nodes;
+  for (int node = 0;; ++node) {
+    std::ifstream file("/sys/devices/system/node/node" +
+                       std::to_string(node) + "/cpulist");
+    if (!file) break;
+    std::string list;
+    std::getline(file, list);
+    std::vector<int> cpus;
+    for (int cpu : ParseCpuList(list))
+      if (CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+    if (!cpus.empty()) nodes.push_back(cpus);
+  }
+  if (nodes.empty()) {
+    nodes.emplace_back();
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      if (CPU_ISSET(cpu, &allowed)) nodes.back().push_back(cpu);
+  }
+  return nodes;
+}
+
+// Order in which worker threads are placed on CPUs:
+//
+//   compact   fill one NUMA node before moving on to the next
+//   scatter   round-robin over the NUMA nodes
+//
+// If `cpus` isn't empty only those CPUs are used; with an empty policy they
+// are used in the given order.
+inline std::vector<int> PlaceThreads(const std::string& policy,
+                                     const std::vector<int>& cpus) {
+  if (policy.empty()) return cpus;
+
+  std::vector<std::vector<int>> nodes = NumaTopology();
+  if (!cpus.empty()) {
+    for (auto& node : nodes) {
+      node.erase(std::remove_if(node.begin(), node.end(),
+                                [&cpus](int cpu) {
+                                  return std::find(cpus.begin(), cpus.end(),
+                                                   cpu) == cpus.end();
+                                }),
+                 node.end());
+    }
+  }
+
+  std::vector<int> placement;
+  if (policy == "compact") {
+    for (auto& node : nodes)
+      placement.insert(placement.end(), node.begin(), node.end());
+  } else if (policy == "scatter") {
+    for (size_t i = 0;; ++i) {
+      size_t placed = placement.size();
+      for (auto& node : nodes)
+        if (i < node.size()) placement.push_back(node[i]);
+      if (placement.size() == placed) break;
+    }
+  } else {
+    std::cerr << "ERROR! unknown numa policy " << policy << "!" << std::endl;
+    exit(-1);
+  }
+  return placement;
+}
+
+// Pins the calling thread to `cpu`.
+inline bool PinThread(int cpu) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+// Sets the memory policy of the calling thread, inherited by the threads it
+// creates afterwards:
+//
+//   local        allocate on the node of the CPU that touches the page
+//   interleave   interleave pages over all NUMA nodes
+inline bool SetMemPolicy(const std::string& policy) {
+  if (policy == "local")
+    return syscall(SYS_set_mempolicy, MPOL_LOCAL, nullptr, 0) == 0;
+  if (policy == "interleave") {
+    unsigned long mask[16] = {0};
+    int node = 0;
+    for (; node < (int)(sizeof(mask) * 8); ++node) {
+      std::ifstream file("/sys/devices/system/node/node" +
+                         std::to_string(node) + "/cpulist");
+      if (!file) break;
+      mask[node / 64] |= 1UL << (node % 64);
+    }
+    if (node == 0) mask[0] = 1;
+    return syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, mask,
+                   sizeof(mask) * 8) == 0;
+  }
+  std::cerr << "ERROR! unknown memory policy " << policy << "!" << std::endl;
+  exit(-1);
+}
+
+} // namespace kvbench
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define KVBENCH_HAVE_TSC 1
+#endif
+
+namespace kvbench {
+
+// Clock used to time single operations. On x86 with an invariant TSC it
+// reads the time stamp counter (rdtsc to start, rdtscp to end so that the
+// timed operation can't be reordered past it) and converts ticks to
+// nanoseconds with a frequency calibrated against CLOCK_MONOTONIC. Otherwise
+// it falls back to clock_gettime(CLOCK_MONOTONIC), where one tick is one
+// nanosecond.
+class Clock {
+ public:
+  static uint64_t Start() { return StartWith_(Get_()); }
+
+  static uint64_t End() { return EndWith_(Get_()); }
+
+  static double ToNs(uint64_t ticks) { return ticks * Get_().ns_per_tick; }
+
+  static bool IsTsc() { return Get_().tsc; }
+
+  static std::string Source() { return IsTsc() ? "tsc" : "clock_gettime"; }
+
+  // Ticks per second.
+  static double Frequency() { return 1e9 / Get_().ns_per_tick; }
+
+  // Median cost in nanoseconds of one Start()/End() pair, i.e. what an
+  // empty operation measures as.
+  static double Overhead() { return Get_().overhead; }
+
+  // Calibrates the clock; called once up front so that the calibration
+  // isn't charged to the first operation.
+  static void Init() { Get_(); }
+
+ private:
+  struct State {
+    bool tsc = false;
+    double ns_per_tick = 1.0;
+    double overhead = 0.0;
+  };
+
+  static uint64_t MonotonicNs_() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+  }
+
+  static bool InvariantTsc_() {
+#ifdef KVBENCH_HAVE_TSC
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+    return edx & (1 << 8);
+#else
+    return false;
+#endif
+  }
+
+  static State Calibrate_() {
+    State state;
+#ifdef KVBENCH_HAVE_TSC
+    if (InvariantTsc_()) {
+      uint64_t ns_start = MonotonicNs_();
+      uint64_t tsc_start = __rdtsc();
+      while (MonotonicNs_() - ns_start < 50000000) {}
+      uint64_t tsc_end = __rdtsc();
+      uint64_t ns_end = MonotonicNs_();
+      state.tsc = true;
+      state.ns_per_tick = (double)(ns_end - ns_start) / (tsc_end - tsc_start);
+    }
+#endif
+    return state;
+  }
+
+  static State& Get_() {
+    static State state = [] {
+      State state = Calibrate_();
+      std::vector<uint64_t> samples(10000);
+      for (auto& sample : samples) {
+        uint64_t start = StartWith_(state);
+        sample = EndWith_(state) - start;
+      }
+      std::nth_element(samples.begin(), samples.begin() + samples.size() / 2,
+                       samples.end());
+      state.overhead = samples[samples.size() / 2] * state.ns_per_tick;
+      return state;
+    }();
+    return state;
+  }
+
+  static uint64_t StartWith_(const State& state) {
+#ifdef KVBENCH_HAVE_TSC
+    if (state.tsc) return __rdtsc();
+#endif
+    return MonotonicNs_();
+  }
+
+  static uint64_t EndWith_(const State& state) {
+#ifdef KVBENCH_HAVE_TSC
+    if (state.tsc) {
+      unsigned int aux;
+      return __rdtscp(&aux);
+    }
+#endif
+    return MonotonicNs_();
+  }
+};
+
+} // namespace kvbench
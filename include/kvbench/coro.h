@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define KVBENCH_HAVE_CORO 1
+#endif
+
+namespace kvbench {
+
+#ifdef KVBENCH_HAVE_CORO
+
+// Per-thread free lists of coroutine frames. Frames of one coroutine always
+// have the same size, so after the first batch of a phase every frame is
+// recycled instead of allocated.
+class FramePool {
+ public:
+  static void* Allocate(size_t size) {
+    size_t size_class = Class_(size);
+    if (size_class >= kClasses) return ::operator new(size);
+    std::vector<void*>& list = Lists_().free[size_class];
+    if (list.empty()) return ::operator new((size_class + 1) * kGranularity);
+    void* frame = list.back();
+    list.pop_back();
+    return frame;
+  }
+
+  static void Free(void* frame, size_t size) {
+    size_t size_class = Class_(size);
+    if (size_class >= kClasses)
+      ::operator delete(frame);
+    else
+      Lists_().free[size_class].push_back(frame);
+  }
+
+ private:
+  static constexpr size_t kGranularity = 64;
+  static constexpr size_t kClasses = 64;  // frames up to 4KB
+
+  struct Lists {
+    std::vector<void*> free[kClasses];
+
+    ~Lists() {
+      for (auto& list : free)
+        for (void* frame : list) ::operator delete(frame);
+    }
+  };
+
+  static size_t Class_(size_t size) {
+    return (size + kGranularity - 1) / kGranularity - 1;
+  }
+
+  static Lists& Lists_() {
+    thread_local Lists lists;
+    return lists;
+  }
+};
+
+// One operation run as a coroutine. It starts suspended and runs up to its
+// next suspension point, usually a Prefetch, every time it is resumed.
+class Task {
+ public:
+  struct promise_type {
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+
+    static void* operator new(size_t size) { return FramePool::Allocate(size); }
+    static void operator delete(void* frame, size_t size) {
+      FramePool::Free(frame, size);
+    }
+  };
+
+  Task() = default;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      if (handle_) handle_.destroy();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() {
+    if (handle_) handle_.destroy();
+  }
+
+  bool Done() const { return !handle_ || handle_.done(); }
+
+  // Runs the operation up to its next suspension point, returns whether it
+  // has finished.
+  bool Resume() {
+    handle_.resume();
+    return handle_.done();
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_;
+};
+
+// `co_await Prefetch(addr)` starts loading the cache line of `addr` and
+// suspends, so that other operations run while the load is in flight.
+class Prefetch {
+ public:
+  explicit Prefetch(const void* addr) { __builtin_prefetch(addr); }
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<>) const noexcept {}
+  void await_resume() const noexcept {}
+};
+
+// Resumes `tasks` round-robin until all of them have finished.
+inline void RunInterleaved(Task* tasks, size_t n) {
+  size_t running = 0;
+  for (size_t i = 0; i < n; ++i) running += !tasks[i].Done();
+  while (running > 0)
+    for (size_t i = 0; i < n; ++i)
+      if (!tasks[i].Done() && tasks[i].Resume()) --running;
+}
+
+#endif  // KVBENCH_HAVE_CORO
+
+} // namespace kvbench
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "kvbench.pb.h"
+
+namespace kvbench {
+
+// Log-linear latency histogram in integer nanoseconds, in the spirit of
+// HdrHistogram. Values below 2^kSubBucketBits are counted exactly, larger
+// ones in buckets whose width is 1/2^(kSubBucketBits-1) of their value,
+// i.e. with a relative error below 1.6%. Each thread records into its own
+// histogram without synchronization, they are merged when the phase ends.
+class Histogram {
+ public:
+  static constexpr int kSubBucketBits = 7;
+  static constexpr uint64_t kSubBuckets = 1ULL << kSubBucketBits;
+  static constexpr uint64_t kHalfSubBuckets = kSubBuckets / 2;
+  static constexpr size_t kBuckets =
+      kSubBuckets + (64 - kSubBucketBits) * kHalfSubBuckets;
+
+  Histogram() : counts_(kBuckets, 0) {}
+
+  void Record(uint64_t value) {
+    ++counts_[Index(value)];
+    ++count_;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  void Merge(const Histogram& other) {
+    for (size_t i = 0; i < kBuckets; ++i)
+      counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+
+  void Clear() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    sum_ = 0;
+    min_ = UINT64_MAX;
+    max_ = 0;
+  }
+
+  uint64_t Count() const { return count_; }
+
+  uint64_t Min() const { return count_ ? min_ : 0; }
+
+  uint64_t Max() const { return max_; }
+
+  double Mean() const { return count_ ? (double)sum_ / count_ : 0.0; }
+
+  // Smallest recorded value (up to bucket precision) that is larger than or
+  // equal to `percentile` percent of the recorded values.
+  uint64_t Percentile(double percentile) const {
+    if (count_ == 0) return 0;
+    uint64_t rank = std::max<uint64_t>(1, count_ * percentile / 100.0 + 0.5);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+      seen += counts_[i];
+      if (seen >= rank) return std::min(HighestEquivalent(i), max_);
+    }
+    return max_;
+  }
+
+  // Stores the non-empty buckets only.
+  void ToProto(LatencyHistogram* proto) const {
+    proto->Clear();
+    proto->set_sub_bucket_bits(kSubBucketBits);
+    proto->set_count(count_);
+    proto->set_sum(sum_);
+    proto->set_min(Min());
+    proto->set_max(max_);
+    for (size_t i = 0; i < kBuckets; ++i) {
+      if (counts_[i] == 0) continue;
+      proto->add_index(i);
+      proto->add_bucket_count(counts_[i]);
+    }
+  }
+
+  void FromProto(const LatencyHistogram& proto) {
+    Clear();
+    count_ = proto.count();
+    sum_ = proto.sum();
+    min_ = count_ ? proto.min() : UINT64_MAX;
+    max_ = proto.max();
+    for (int i = 0; i < proto.index_size(); ++i)
+      counts_[proto.index(i)] = proto.bucket_count(i);
+  }
+
+  static size_t Index(uint64_t value) {
+    if (value < kSubBuckets) return value;
+    int shift = 63 - __builtin_clzll(value) - (kSubBucketBits - 1);
+    uint64_t sub_bucket = value >> shift;
+    return kSubBuckets + (shift - 1) * kHalfSubBuckets +
+           (sub_bucket - kHalfSubBuckets);
+  }
+
+  static uint64_t LowestEquivalent(size_t index) {
+    if (index < kSubBuckets) return index;
+    int shift = (index - kSubBuckets) / kHalfSubBuckets + 1;
+    uint64_t sub_bucket = (index - kSubBuckets) % kHalfSubBuckets +
+                          kHalfSubBuckets;
+    return sub_bucket << shift;
+  }
+
+  static uint64_t HighestEquivalent(size_t index) {
+    if (index < kSubBuckets) return index;
+    int shift = (index - kSubBuckets) / kHalfSubBuckets + 1;
+    return LowestEquivalent(index) + (1ULL << shift) - 1;
+  }
+
+ private:
+  std::vector<uint64_t> counts_;
+  uint64_t count_ = 0;
+  uint64_t sum_ = 0;
+  uint64_t min_ = UINT64_MAX;
+  uint64_t max_ = 0;
+};
+
+} // namespace kvbench
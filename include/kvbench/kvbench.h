@@ -1,19 +1,38 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <type_traits>
 #include <vector>
 #include <iterator>
+#include <limits>
 
 #include "kvbench.pb.cc"
 #include "kvbench.pb.h"
+#include "affinity.h"
+#include "clock.h"
+#include "coro.h"
+#include "histogram.h"
+#include "mix.h"
+#include "pmem.h"
 #include "random.h"
+#include "resource.h"
+#include "thread_pool.h"
+#include "trace.h"
 
 namespace kvbench {
 
@@ -24,6 +43,8 @@ enum class Operation {
   UPDATE,
   DELETE,
   SCAN,
+  MIX,
+  TRACE,
   ERROR,
 };
 
@@ -47,6 +68,12 @@ std::ostream& operator<<(std::ostream& os, const Operation& op) {
     case Operation::SCAN:
       os << "SCAN";
       break;
+    case Operation::MIX:
+      os << "MIX";
+      break;
+    case Operation::TRACE:
+      os << "TRACE";
+      break;
     default:
       os << "ERROR";
       break;
@@ -77,8 +104,77 @@ struct TestPhase {
   Random<Value>* random_value;
   int test_threads;
   bool record_latency;
+  // memory budget in bytes for pre-generated keys and values, 0 generates
+  // them inside the timed loop.
+  size_t pregenerate_limit = 0;
+  // time batches of this many operations as a whole and only a
+  // `latency_sample_rate` fraction of them one by one, <= 1 times every
+  // operation.
+  size_t latency_batch = 0;
+  double latency_sample_rate = 0.01;
+  // fraction of the operations at the start and at the end of every thread
+  // that is left out of the steady-state statistics.
+  double warmup = 0.0;
+  // run for this many seconds instead of `size` operations if > 0
+  double duration = 0.0;
+  // sample the throughput and latency every this many milliseconds, 0
+  // disables the timeline.
+  int timeline_interval = 0;
+  // MIX phases: share of every operation type, and the keys of the inserts,
+  // drawn from the range after the keys inserted by the previous phases.
+  OpMix mix;
+  Random<Key>* random_insert_key = nullptr;
+  // TRACE phases: the trace to replay, `size` records of it or all if 0,
+  // split over the threads by key hash instead of round-robin, and issued
+  // at their timestamps instead of back to back.
+  std::string trace_file;
+  bool trace_by_key = false;
+  bool trace_timing = false;
+  // open loop: issue `rate` operations per second in total, spaced evenly
+  // or as Poisson arrivals, instead of each thread issuing back to back.
+  double rate = 0.0;
+  bool poisson = false;
+  // run the phase closed-loop and then at 1/rate_sweep, 2/rate_sweep, ...
+  // of the throughput it reached, recording the latency of every step.
+  int rate_sweep = 0;
+  // scans read `scan_length` items, or a number drawn from
+  // `random_scan_length` over [1, scan_length] if it isn't null, and stop
+  // at `scan_span` keys after their start key if > 0 (integer keys only).
+  size_t scan_length = 100;
+  Random<uint64_t>* random_scan_length = nullptr;
+  uint64_t scan_span = 0;
+  // issue LOAD, PUT, GET and DELETE as Multi* calls on `batch` keys if > 1.
+  // Latency is then per batch, with the amortized latency per key in the
+  // batch histogram.
+  size_t batch = 0;
+  // LOAD, PUT and GET: run every batch as `interleave` coroutines resumed
+  // round-robin, if > 1 and the DB is a CoroDB.
+  size_t interleave = 0;
+  // string keys and values: their size distributions, see SizeDistribution
+  std::string key_size;
+  std::string value_size;
+  // run the phase once per thread count, each step on a freshly loaded DB
+  // if `thread_sweep_reload`.
+  std::vector<int> thread_sweep;
+  bool thread_sweep_reload = false;
 };
 
+// Last key of a scan over `span` keys from `key`, if the key type has one.
+template <typename Key>
+typename std::enable_if<std::is_integral<Key>::value, bool>::type ScanEndKey(
+    const Key& key, uint64_t span, Key* end) {
+  *end = std::numeric_limits<Key>::max() - key < span - 1
+             ? std::numeric_limits<Key>::max()
+             : key + (span - 1);
+  return true;
+}
+
+template <typename Key>
+typename std::enable_if<!std::is_integral<Key>::value, bool>::type ScanEndKey(
+    const Key& key, uint64_t span, Key* end) {
+  return false;
+}
+
 class Timer {
  public:
   void Start() { start_ = std::chrono::high_resolution_clock::now(); }
@@ -94,6 +190,287 @@ class Timer {
   std::chrono::time_point<std::chrono::high_resolution_clock> end_;
 };
 
+constexpr size_t kCacheLineSize = 64;
+
+template <typename T>
+struct CacheAlignedAllocator {
+  using value_type = T;
+
+  CacheAlignedAllocator() = default;
+
+  template <typename U>
+  CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(
+        ::operator new(n * sizeof(T), std::align_val_t(kCacheLineSize)));
+  }
+
+  void deallocate(T* p, size_t) {
+    ::operator delete(p, std::align_val_t(kCacheLineSize));
+  }
+
+  template <typename U>
+  bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+
+  template <typename U>
+  bool operator!=(const CacheAlignedAllocator<U>&) const { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, CacheAlignedAllocator<T>>;
+
+// Feeds keys and values to one worker thread. Without pre-generation the
+// generators are called inside the timed loop. With it, Prepare() fills
+// cache-aligned arrays before the phase timer starts and the worker only
+// streams through them. If the whole stream doesn't fit in `chunk`
+// entries, two chunk buffers are used and a filler thread generates the
+// next chunk while the worker consumes the current one.
+template <typename Key, typename Value>
+class OpSource {
+ public:
+  OpSource(Random<Key>* random_key, Random<Value>* random_value, size_t size,
+           size_t chunk, bool with_value,
+           Random<Key>* random_insert_key = nullptr)
+      : random_key_(random_key),
+        random_value_(random_value),
+        random_insert_key_(random_insert_key),
+        size_(size),
+        chunk_(std::min(chunk, size)),
+        with_value_(with_value) {}
+
+  ~OpSource() {
+    stop_ = true;
+    if (filler_.joinable()) filler_.join();
+    delete random_key_;
+    delete random_value_;
+    delete random_insert_key_;
+    delete random_scan_length_;
+  }
+
+  bool Pregenerated() const { return chunk_ > 0; }
+
+  size_t BufferBytes() const {
+    size_t bytes = sizeof(Key) + (with_value_ ? sizeof(Value) : 0);
+    return bytes * (keys_[0].capacity() + keys_[1].capacity()) + arena_bytes_;
+  }
+
+  // Keys and values that point into the arenas of their generators, i.e.
+  // string views, have to outlive the `in_flight` operations being issued
+  // and both pre-generated chunks.
+  void Reserve(size_t in_flight) {
+    size_t window = in_flight + (Pregenerated() ? 2 * chunk_ : 0);
+    arena_bytes_ = random_key_->Reserve(window);
+    if (with_value_) arena_bytes_ += random_value_->Reserve(window);
+    if (random_insert_key_)
+      arena_bytes_ += random_insert_key_->Reserve(in_flight);
+  }
+
+  // Replay the records of `trace` instead of generating keys.
+  void SetTrace(TraceShard* trace) { trace_ = trace; }
+
+  void Prepare() {
+    if (trace_) trace_->Prepare();
+    if (!Pregenerated()) return;
+    size_t chunks = size_ / chunk_ + (size_ % chunk_ != 0);
+    for (int i = 0; i < (chunks > 1 ? 2 : 1); ++i) {
+      keys_[i].reserve(chunk_);
+      if (with_value_) values_[i].reserve(chunk_);
+    }
+    Fill_(0, 0);
+    ready_[0] = true;
+    end_ = keys_[0].size();
+    if (chunks > 1)
+      filler_ = std::thread(&OpSource::FillMain_, this, chunks);
+  }
+
+  Key NextKey() {
+    if (!Pregenerated()) return random_key_->Next();
+    if (pos_ == end_) NextChunk_();
+    return keys_[current_][pos_++];
+  }
+
+  // Value paired with the key returned by the last NextKey().
+  Value NextValue() {
+    if (!Pregenerated()) return random_value_->Next();
+    return values_[current_][pos_ - 1];
+  }
+
+  // New key for an insert of a MIX phase. Not pre-generated, as the number
+  // of inserts isn't known up front.
+  Key NextInsertKey() { return random_insert_key_->Next(); }
+
+  const TraceRecord& NextRecord() { return trace_->Next(); }
+
+  // Key of the bench's key type for a trace key. String keys get the sizes
+  // of the generated ones, so that a trace can run on loaded keys.
+  Key TraceKey(uint64_t id) {
+    if constexpr (std::is_same<Key, std::string_view>::value)
+      if (auto random = dynamic_cast<RandomStringKey*>(random_key_))
+        return random->Key(id);
+    return kvbench::TraceKey<Key>(id);
+  }
+
+  // Scan lengths drawn from `random`, `scan_length` each if it is null.
+  void SetScanLength(size_t scan_length, Random<uint64_t>* random) {
+    scan_length_ = scan_length;
+    random_scan_length_ = random;
+  }
+
+  size_t NextScanLength() {
+    return random_scan_length_ ? random_scan_length_->Next() : scan_length_;
+  }
+
+  TraceShard* Trace() const { return trace_; }
+
+ private:
+  Random<Key>* random_key_;
+  Random<Value>* random_value_;
+  Random<Key>* random_insert_key_;
+  TraceShard* trace_ = nullptr;
+  size_t scan_length_ = 0;
+  Random<uint64_t>* random_scan_length_ = nullptr;
+  size_t size_;
+  size_t chunk_;
+  bool with_value_;
+  size_t arena_bytes_ = 0;
+  AlignedVector<Key> keys_[2];
+  AlignedVector<Value> values_[2];
+  std::atomic<bool> ready_[2] = {{false}, {false}};
+  std::atomic<bool> stop_{false};
+  std::thread filler_;
+  int current_ = 0;
+  size_t pos_ = 0;
+  size_t end_ = 0;
+
+  void Fill_(int buffer, size_t chunk_id) {
+    size_t n = std::min(chunk_, size_ - chunk_id * chunk_);
+    keys_[buffer].clear();
+    values_[buffer].clear();
+    for (size_t i = 0; i < n; ++i) {
+      keys_[buffer].push_back(random_key_->Next());
+      if (with_value_) values_[buffer].push_back(random_value_->Next());
+    }
+  }
+
+  void FillMain_(size_t chunks) {
+    for (size_t chunk_id = 1; chunk_id < chunks; ++chunk_id) {
+      int buffer = chunk_id % 2;
+      while (ready_[buffer].load(std::memory_order_acquire)) {
+        if (stop_) return;
+        std::this_thread::yield();
+      }
+      Fill_(buffer, chunk_id);
+      ready_[buffer].store(true, std::memory_order_release);
+    }
+  }
+
+  void NextChunk_() {
+    ready_[current_].store(false, std::memory_order_release);
+    current_ ^= 1;
+    while (!ready_[current_].load(std::memory_order_acquire))
+      std::this_thread::yield();
+    pos_ = 0;
+    end_ = keys_[current_].size();
+  }
+};
+
+// Latency statistics of a range of operations.
+struct LatencyStat {
+  size_t ops = 0;
+  double total_latency = 0.0;  // us
+  double max_latency = 0.0;    // us
+  Histogram histogram;
+  Histogram batch_histogram;  // mean latency per operation of each batch
+  Histogram key_histogram;    // latency of each Multi* call per key
+
+  void Merge(const LatencyStat& other) {
+    ops += other.ops;
+    total_latency += other.total_latency;
+    max_latency = std::max(max_latency, other.max_latency);
+    histogram.Merge(other.histogram);
+    batch_histogram.Merge(other.batch_histogram);
+    key_histogram.Merge(other.key_histogram);
+  }
+};
+
+// Statistics one worker thread collects during a phase. The operations in
+// the steady-state window and the ones outside of it, i.e. ramp-up and
+// ramp-down, are kept apart.
+struct alignas(kCacheLineSize) ThreadStat {
+  LatencyStat steady;
+  LatencyStat ramp;
+  uint64_t steady_start = 0;  // clock ticks
+  uint64_t steady_end = 0;
+  google::protobuf::RepeatedField<double> latencys;
+  // per operation type of a MIX phase, indexed by MixOp
+  std::vector<LatencyStat> op_stats;
+  uint64_t scan_items = 0;  // returned by all scans
+  PMem::Counters pmem;  // flushes and fences of the thread's operations
+  // published every few operations for the timeline sampler
+  std::atomic<uint64_t> published_ops{0};
+  std::atomic<double> published_latency{0.0};  // us
+};
+
+// Issues the operations of one thread of an open-loop phase at `rate`
+// operations per second, with constant or exponentially distributed (i.e.
+// Poisson arrivals) gaps. Wait() spins until the intended send time of the
+// next operation and returns it; operations are timed from there, so that
+// the time they spent queued behind a stalled engine counts towards their
+// latency instead of being omitted.
+class Pacer {
+ public:
+  Pacer(double rate, bool poisson, uint64_t seed)
+      : interval_(Clock::Frequency() / rate), poisson_(poisson) {
+    gen_.seed(seed);
+  }
+
+  void Start(uint64_t tick) { next_ = tick; }
+
+  uint64_t Wait() {
+    uint64_t intended = (uint64_t)next_;
+    next_ += poisson_ ? dist_(gen_) * interval_ : interval_;
+    while ((int64_t)(Clock::Start() - intended) < 0) {
+#ifdef KVBENCH_HAVE_TSC
+      _mm_pause();
+#else
+      std::this_thread::yield();
+#endif
+    }
+    return intended;
+  }
+
+ private:
+  double interval_;  // clock ticks
+  bool poisson_;
+  double next_ = 0.0;
+  std::mt19937_64 gen_;
+  std::exponential_distribution<double> dist_;
+};
+
+// Worker threads check in and spin until the coordinator releases them all
+// at once, so thread creation and startup skew stay out of the measurement.
+class StartBarrier {
+ public:
+  void Wait() {
+    ready_.fetch_add(1, std::memory_order_acq_rel);
+    while (!start_.load(std::memory_order_acquire))
+      std::this_thread::yield();
+  }
+
+  // Waits until `nr_thread` workers are waiting.
+  void WaitReady(int nr_thread) const {
+    while (ready_.load(std::memory_order_acquire) < nr_thread)
+      std::this_thread::yield();
+  }
+
+  void Release() { start_.store(true, std::memory_order_release); }
+
+ private:
+  std::atomic<int> ready_{0};
+  std::atomic<bool> start_{false};
+};
+
 template <typename Key, typename Value>
 class Options {
  public:
@@ -102,22 +479,77 @@ class Options {
         record_latency_(default_record_latency) {}
 
   void Append(Operation op, size_t size) {
-    phases_.emplace_back(op, size, new RandomDefault<Key>(),
-                         new RandomDefault<Value>(), test_threads_,
-                         record_latency_);
+    Append(op, size, test_threads_, record_latency_);
   }
 
   void Append(Operation op, size_t size, int test_threads) {
-    phases_.emplace_back(op, size, new RandomDefault<Key>(),
-                         new RandomDefault<Value>(), test_threads,
-                         record_latency_);
+    Append(op, size, test_threads, record_latency_);
   }
 
   void Append(Operation op, size_t size, int test_threads,
               bool record_latency) {
-    phases_.emplace_back(op, size, new RandomDefault<Key>(),
-                         new RandomDefault<Value>(), test_threads,
-                         record_latency);
+    // the key distribution of a YCSB preset wins over a -key-random that
+    // was given for an earlier phase
+    bool preset_keys = op == Operation::MIX && !key_random_set_ &&
+                       !mix_.key_random.empty();
+    Append(op, size, preset_keys ? "" : key_random_, value_random_,
+           test_threads, record_latency);
+    key_random_set_ = false;
+  }
+
+  // `key_random` and `value_random` are generator specs, see NewRandom().
+  // LOAD and PUT draw keys from the range right after the keys inserted by
+  // the previous phases, the other operations from the inserted keys.
+  void Append(Operation op, size_t size, const std::string& key_random,
+              const std::string& value_random, int test_threads,
+              bool record_latency) {
+    uint64_t first = 0;
+    uint64_t items = key_space_;
+    if (op == Operation::LOAD || op == Operation::PUT) {
+      first = key_space_;
+      items = size;
+      key_space_ += size;
+    } else if (items == 0) {
+      items = size;
+    }
+    std::string key_spec = key_random;
+    if (op == Operation::MIX) {
+      if (mix_.Empty()) {
+        std::cerr << "ERROR! MIX phase without an operation mix!" << std::endl;
+        exit(-1);
+      }
+      // YCSB presets come with their key distribution
+      if (key_spec.empty() && HasKeyIds<Key>())
+        key_spec = mix_.key_random;
+    }
+    phases_.emplace_back(
+        op, size, NewRandomKey<Key>(key_spec, key_size_, first, items),
+        NewRandomValue<Value>(value_random, value_size_, size), test_threads,
+        record_latency);
+    SetPhaseOptions_(phases_.back());
+    if (op == Operation::MIX) {
+      uint64_t inserts = std::ceil(size * mix_.InsertFraction());
+      phases_.back().random_insert_key = NewRandomKey<Key>(
+          HasKeyIds<Key>() ? "Sequential" : "", key_size_, key_space_,
+          inserts);
+      key_space_ += inserts;
+    }
+  }
+
+  // Appends a phase that runs for `seconds` instead of a number of
+  // operations. Inserting phases draw from a nominal range of
+  // kTimedPhaseKeys keys after the inserted ones, which doesn't extend the
+  // key space of the following phases since the real count isn't known.
+  // Phases before any insert draw from as many keys, so the generators
+  // must set up in time independent of the key space, as NewRandom()'s do.
+  void AppendFor(Operation op, double seconds) {
+    uint64_t key_space = key_space_;
+    Append(op, kTimedPhaseKeys);
+    key_space_ = key_space;
+    phases_.back().size = 0;
+    phases_.back().duration = seconds;
+    if (phases_.back().timeline_interval == 0)
+      phases_.back().timeline_interval = kDefaultTimelineInterval;
   }
 
   void Append(Operation op, size_t size, Random<Key>* random_key,
@@ -125,6 +557,99 @@ class Options {
               bool record_latency) {
     phases_.emplace_back(op, size, random_key, random_value, test_threads,
                          record_latency);
+    SetPhaseOptions_(phases_.back());
+  }
+
+  // Generator specs used by the following Append() calls. The key
+  // distribution of a YCSB preset is used instead in MIX phases, unless the
+  // key spec was set right before the phase.
+  void SetKeyRandom(const std::string& spec) {
+    key_random_ = spec;
+    key_random_set_ = true;
+  }
+
+  void SetValueRandom(const std::string& spec) { value_random_ = spec; }
+
+  // Size distributions of string keys and values of the following phases,
+  // see SizeDistribution. Keys are at least 8 bytes.
+  void SetKeySize(const std::string& spec) { key_size_ = spec; }
+
+  void SetValueSize(const std::string& spec) { value_size_ = spec; }
+
+  // Pre-generate the keys and values of the following phases before their
+  // timer starts, using at most `bytes` of memory per phase. 0 disables.
+  void SetPregenerate(size_t bytes) { pregenerate_limit_ = bytes; }
+
+  // Time the following phases in batches of `batch` operations, timing
+  // only a random `sample_rate` fraction of the operations one by one.
+  void SetLatencyBatch(size_t batch) { latency_batch_ = batch; }
+
+  void SetLatencySampleRate(double sample_rate) {
+    latency_sample_rate_ = sample_rate;
+  }
+
+  // Leave the first and last `fraction` of the operations of the following
+  // phases out of their steady-state statistics.
+  void SetWarmup(double fraction) { warmup_ = fraction; }
+
+  // Trace replayed by the following TRACE phases, see trace.h.
+  void SetTrace(const std::string& path) { trace_file_ = path; }
+
+  void SetTraceSplit(bool by_key) { trace_by_key_ = by_key; }
+
+  void SetTraceTiming(bool timing) { trace_timing_ = timing; }
+
+  // Run the following phases open-loop at `rate` operations per second,
+  // 0 runs them closed-loop.
+  void SetRate(double rate) { rate_ = rate; }
+
+  void SetArrival(bool poisson) { poisson_ = poisson; }
+
+  // Sweep the offered load of the following phases in `steps` steps up to
+  // their closed-loop throughput, 0 disables.
+  void SetRateSweep(int steps) { rate_sweep_ = steps; }
+
+  // Run the following phases once with every thread count in `threads`,
+  // an empty list disables. With `reload` every step after the first runs
+  // on a new DB from the bench's factory with the LOAD phases replayed.
+  void SetThreadSweep(const std::vector<int>& threads) {
+    thread_sweep_.clear();
+    for (int nr_thread : threads)
+      if (nr_thread > 0) thread_sweep_.push_back(nr_thread);
+  }
+
+  void SetThreadSweepReload(bool reload) { thread_sweep_reload_ = reload; }
+
+  // Scans of the following phases read `length` items or, with a spec
+  // other than "Constant", a number drawn from [1, length] by a generator
+  // as in NewRandom(). A `span` > 0 also ends them that many keys after
+  // their start key.
+  void SetScanLength(size_t length) { scan_length_ = length; }
+
+  void SetScanLengthRandom(const std::string& spec) {
+    scan_length_random_ = spec == "Constant" ? "" : spec;
+  }
+
+  void SetScanSpan(uint64_t span) { scan_span_ = span; }
+
+  // Issue the following LOAD, PUT, GET and DELETE phases in batches of
+  // `batch` keys through the Multi* calls, <= 1 disables.
+  void SetBatch(size_t batch) { batch_ = batch; }
+
+  // Keep `n` lookups or inserts per thread in flight in the following LOAD,
+  // PUT and GET phases by interleaving them as coroutines, see CoroDB.
+  // <= 1 disables.
+  void SetInterleave(size_t n) { interleave_ = n; }
+
+  // Operation mix of the following MIX phases, see ParseOpMix().
+  void SetMix(const std::string& spec) { mix_ = ParseOpMix(spec); }
+
+  // Record a throughput/latency timeline every `ms` milliseconds in the
+  // following phases. Time-bounded phases default to 100ms.
+  void SetTimelineInterval(int ms) { timeline_interval_ = ms; }
+
+  void SetRecordLatency(bool record_latency) {
+    record_latency_ = record_latency;
   }
 
   void SetThreadNum(unsigned int nr_thread) { test_threads_ = nr_thread; }
@@ -133,6 +658,70 @@ class Options {
   std::vector<TestPhase<Key, Value>> phases_;
   int test_threads_ = 1;    // TODO: deprecated
   bool record_latency_ = true;
+  std::string key_random_;
+  bool key_random_set_ = false;  // since the last phase was appended
+  std::string value_random_;
+  std::string key_size_ = "Fixed:16";
+  std::string value_size_ = "Fixed:100";
+  uint64_t key_space_ = 0;
+  size_t pregenerate_limit_ = 0;
+  size_t latency_batch_ = 0;
+  double latency_sample_rate_ = 0.01;
+  double warmup_ = 0.0;
+  int timeline_interval_ = 0;
+  OpMix mix_;
+  std::string trace_file_;
+  bool trace_by_key_ = false;
+  bool trace_timing_ = false;
+  double rate_ = 0.0;
+  bool poisson_ = false;
+  int rate_sweep_ = 0;
+  std::vector<int> thread_sweep_;
+  bool thread_sweep_reload_ = false;
+  size_t scan_length_ = 100;
+  std::string scan_length_random_;
+  uint64_t scan_span_ = 0;
+  size_t batch_ = 0;
+  size_t interleave_ = 0;
+
+  static constexpr uint64_t kTimedPhaseKeys = 1ULL << 32;
+  static constexpr int kDefaultTimelineInterval = 100;
+
+  void SetPhaseOptions_(TestPhase<Key, Value>& phase) {
+    phase.pregenerate_limit = pregenerate_limit_;
+    phase.latency_batch = latency_batch_;
+    phase.latency_sample_rate = latency_sample_rate_;
+    phase.warmup = warmup_;
+    phase.timeline_interval = timeline_interval_;
+    phase.mix = mix_;
+    phase.trace_file = trace_file_;
+    phase.trace_by_key = trace_by_key_;
+    phase.trace_timing = trace_timing_;
+    phase.rate = rate_;
+    phase.poisson = poisson_;
+    phase.rate_sweep = rate_sweep_;
+    phase.thread_sweep = thread_sweep_;
+    phase.thread_sweep_reload = thread_sweep_reload_;
+    phase.scan_length = std::max<size_t>(scan_length_, 1);
+    if (!scan_length_random_.empty())
+      phase.random_scan_length =
+          NewRandom<uint64_t>(scan_length_random_, 1, phase.scan_length);
+    phase.scan_span = scan_span_;
+    phase.key_size = key_size_;
+    phase.value_size = value_size_;
+    if (phase.op == Operation::LOAD || phase.op == Operation::PUT ||
+        phase.op == Operation::GET || phase.op == Operation::DELETE)
+      phase.batch = batch_ > 1 ? batch_ : 0;
+    // an interleaved group is issued and timed like a batch
+    if (interleave_ > 1 &&
+        (phase.op == Operation::LOAD || phase.op == Operation::PUT ||
+         phase.op == Operation::GET)) {
+      phase.interleave = interleave_;
+      phase.batch = interleave_;
+    }
+    // batches are timed as a whole already
+    if (phase.batch > 1) phase.latency_batch = 0;
+  }
 
   friend class Bench<Key, Value>;
 };
@@ -152,7 +741,33 @@ class DB {
 
   virtual int Delete(Key key) = 0;
 
-  virtual int Scan(Key min_key, std::vector<Value>* values) = 0;
+  // Keys and values of type std::string_view point into buffers of the
+  // bench and are only valid during the call, engines copy what they keep.
+  //
+  // Reads up to `count` values of the keys from `min_key` on, and no further
+  // than `*max_key` if it isn't null, into `values`. The buffer is owned by
+  // the caller, reused for every scan and has room for `count` values.
+  // Returns the number of values read.
+  virtual int Scan(Key min_key, size_t count, Value* values,
+                   const Key* max_key = nullptr) = 0;
+
+  // Batched operations on `n` keys. The defaults issue the single-key calls
+  // one by one; engines that can overlap the memory accesses of the keys
+  // override them.
+  virtual int MultiGet(const Key* keys, Value* values, size_t n) {
+    for (size_t i = 0; i < n; ++i) Get(keys[i], &values[i]);
+    return 0;
+  }
+
+  virtual int MultiPut(const Key* keys, const Value* values, size_t n) {
+    for (size_t i = 0; i < n; ++i) Put(keys[i], values[i]);
+    return 0;
+  }
+
+  virtual int MultiDelete(const Key* keys, size_t n) {
+    for (size_t i = 0; i < n; ++i) Delete(keys[i]);
+    return 0;
+  }
 
   virtual std::string Name() const = 0;
 
@@ -172,16 +787,54 @@ class DB {
   int nr_thread_;
 };
 
+// DB whose Get and Put can also run as coroutines that prefetch the memory
+// they are about to touch and suspend, so that -interleave overlaps the
+// cache misses of several operations of one thread. The defaults issue the
+// plain calls without suspending. Without coroutine support (C++20) this is
+// a plain DB and -interleave falls back to the Multi* calls.
+template <typename Key, typename Value>
+class CoroDB : public DB<Key, Value> {
+ public:
+#ifdef KVBENCH_HAVE_CORO
+  virtual Task CoGet(Key key, Value* value) {
+    this->Get(key, value);
+    co_return;
+  }
+
+  virtual Task CoPut(Key key, Value value) {
+    this->Put(key, value);
+    co_return;
+  }
+#endif
+};
+
 template <typename Key, typename Value>
 class Bench {
  public:
   Bench(int argc, char** argv)
-      : options_(new Options<Key, Value>()), nr_thread_(1) {
+      : options_(new Options<Key, Value>()), nr_thread_(1),
+        seed_(RandomSeed()),
+        pool_([this](int thread_id) { InitWorker_(thread_id); }) {
     ParseArguments_(argc, argv);
+    // the memory policy is inherited by the worker threads and has to be in
+    // place before the engine allocates anything.
+    if (!mem_policy_.empty() && !SetMemPolicy(mem_policy_))
+      std::cerr << "WARNING! failed to set memory policy " << mem_policy_
+                << "!" << std::endl;
+    placement_ = PlaceThreads(numa_policy_, cpus_);
+    Clock::Init();
+    // before the adapter opens its pools
+    if (!pmem_dir_.empty() &&
+        !PMem::Emulate(pmem_dir_, pmem_flush_latency_, pmem_fence_latency_))
+      std::cerr << "WARNING! " << pmem_dir_
+                << " is not on tmpfs, PM is emulated by a slower medium!"
+                << std::endl;
     GOOGLE_PROTOBUF_VERIFY_VERSION;
   }
 
   ~Bench() {
+    // workers may hold thread-local engine state, stop them first
+    pool_.Shutdown();
     delete db_;
     google::protobuf::ShutdownProtobufLibrary();
   }
@@ -189,6 +842,14 @@ class Bench {
   void SetDB(DB<Key, Value>* db) {
     db_ = db;
     db_->SetThreadNumber(nr_thread_);
+    coro_db_ = dynamic_cast<CoroDB<Key, Value>*>(db);
+  }
+
+  // Creates the DB with `factory`, which thread sweeps with reload call
+  // again for a fresh DB before every step.
+  void SetDBFactory(std::function<DB<Key, Value>*()> factory) {
+    db_factory_ = factory;
+    SetDB(db_factory_());
   }
 
   void Run() { Run_(); }
@@ -200,7 +861,20 @@ class Bench {
                  "=============================="
               << std::endl
               << "DB name:            " << db_->Name() << std::endl
-              << "Total run time (s): " << stats_.stat(0).duration() / 1000000.0 << std::endl;
+              << "Total run time (s): " << stats_.stat(0).duration() / 1000000.0 << std::endl
+              << "Seed:               " << stats_.seed() << std::endl
+              << "Clock:              " << stats_.clock_source() << ", "
+              << stats_.clock_frequency() / 1e9 << " GHz, "
+              << stats_.timer_overhead() << " ns per sample" << std::endl
+              << "NUMA policy:        "
+              << (stats_.numa_policy().empty() ? "none" : stats_.numa_policy())
+              << ", memory policy "
+              << (stats_.mem_policy().empty() ? "default" : stats_.mem_policy())
+              << std::endl;
+    if (!stats_.pmem_dir().empty())
+      std::cout << "PM emulation:       " << stats_.pmem_dir() << ", "
+                << stats_.pmem_flush_latency() << " ns per line flushed, "
+                << stats_.pmem_fence_latency() << " ns per fence" << std::endl;
 
     for (size_t i = 0; i < options_->phases_.size(); ++i) {
       auto stat = stats_.stat(i + 1);
@@ -217,7 +891,151 @@ class Bench {
                 << "  "
                 << "Maximum latency (us): " << stat.max_latency() << std::endl
                 << "  "
+                << "P50 latency (us):     " << stat.p50_latency() << std::endl
+                << "  "
+                << "P90 latency (us):     " << stat.p90_latency() << std::endl
+                << "  "
+                << "P99 latency (us):     " << stat.p99_latency() << std::endl
+                << "  "
+                << "P99.9 latency (us):   " << stat.p999_latency() << std::endl
+                << "  "
+                << "P99.99 latency (us):  " << stat.p9999_latency() << std::endl
+                << "  "
                 << "Throughput (ops/s):   " << stat.throughput() << std::endl;
+      if (stat.has_steady()) {
+        auto& steady = stat.steady();
+        std::cout << "  "
+                  << "Steady state, without first/last " << steady.warmup() * 100
+                  << "% of the operations:" << std::endl
+                  << "    "
+                  << "Total:                " << steady.total() << std::endl
+                  << "    "
+                  << "Average latency (us): " << steady.average_latency() << std::endl
+                  << "    "
+                  << "P50 / P99 / P99.9 latency (us): " << steady.p50_latency()
+                  << " / " << steady.p99_latency() << " / " << steady.p999_latency()
+                  << std::endl
+                  << "    "
+                  << "Throughput (ops/s):   " << steady.throughput() << std::endl;
+      }
+      if (stat.cpu_size() > 0) {
+        std::cout << "  "
+                  << "CPUs:                 ";
+        for (int j = 0; j < stat.cpu_size(); ++j)
+          std::cout << (j ? "," : "") << stat.cpu(j);
+        std::cout << std::endl;
+      }
+      if (stat.scan_items() > 0)
+        std::cout << "  "
+                  << "Scanned items:        " << stat.scan_items() << ", "
+                  << stat.scan_item_throughput() << " items/s" << std::endl;
+      if (stat.phase_end_duration() >= kPrintedPhaseEnd)
+        std::cout << "  "
+                  << "PhaseEnd time (s):    "
+                  << stat.phase_end_duration() / 1000000.0 << std::endl;
+      const ResourceStat& resource = stat.resource();
+      std::cout << "  "
+                << "CPU time (s):         " << resource.user_time() / 1000000.0
+                << " user, " << resource.sys_time() / 1000000.0 << " sys"
+                << std::endl
+                << "  "
+                << "Page faults:          " << resource.minor_faults()
+                << " minor, " << resource.major_faults() << " major"
+                << std::endl
+                << "  "
+                << "Context switches:     " << resource.voluntary_switches()
+                << " voluntary, " << resource.involuntary_switches()
+                << " involuntary" << std::endl
+                << "  "
+                << "RSS (MB):             " << resource.rss_begin() / 1048576.0
+                << " -> " << resource.rss_end() / 1048576.0 << ", peak "
+                << resource.rss_peak() / 1048576.0 << std::endl;
+      if (resource.live_keys() > 0)
+        std::cout << "  "
+                  << "Bytes per key:        " << resource.bytes_per_key()
+                  << ", " << resource.live_keys() << " live keys" << std::endl;
+      if (stat.pmem_flushes() > 0 || stat.pmem_fences() > 0)
+        std::cout << "  "
+                  << "PM flushes per op:    "
+                  << (double)stat.pmem_flushes() / stat.total() << ", "
+                  << (double)stat.pmem_fences() / stat.total()
+                  << " fences per op" << std::endl;
+      if (stat.offered_rate() > 0)
+        std::cout << "  "
+                  << "Offered rate (ops/s): " << stat.offered_rate() << ", "
+                  << stat.arrival() << " arrivals" << std::endl;
+      if (stat.rate_curve_size() > 0) {
+        std::cout << "  "
+                  << "Rate sweep, offered (ops/s) -> throughput (ops/s), "
+                     "average / P99 / P99.9 latency (us):" << std::endl;
+        for (auto& point : stat.rate_curve())
+          std::cout << "    "
+                    << (point.offered_rate() > 0
+                            ? std::to_string((uint64_t)point.offered_rate())
+                            : std::string("closed-loop"))
+                    << " -> " << point.throughput() << ", "
+                    << point.average_latency() << " / " << point.p99_latency()
+                    << " / " << point.p999_latency() << std::endl;
+      }
+      if (stat.thread_curve_size() > 0) {
+        std::cout << "  "
+                  << "Thread sweep, threads -> throughput (ops/s), speedup, "
+                     "efficiency, P99 latency (us):" << std::endl;
+        for (auto& point : stat.thread_curve())
+          std::cout << "    "
+                    << point.threads() << " -> " << point.throughput() << ", "
+                    << point.speedup() << "x, " << point.efficiency() * 100
+                    << "%, " << point.p99_latency() << std::endl;
+      }
+      for (auto& op_stat : stat.op_stat()) {
+        std::cout << "  "
+                  << op_stat.op() << " (" << op_stat.ratio() * 100 << "%): "
+                  << op_stat.total() << " ops, " << op_stat.throughput()
+                  << " ops/s, average / P99 latency (us): "
+                  << op_stat.average_latency() << " / " << op_stat.p99_latency()
+                  << std::endl;
+      }
+      if (stat.timeline_size() > 0) {
+        double min_throughput = stat.timeline(0).throughput();
+        double max_throughput = min_throughput;
+        for (auto& point : stat.timeline()) {
+          min_throughput = std::min(min_throughput, point.throughput());
+          max_throughput = std::max(max_throughput, point.throughput());
+        }
+        std::cout << "  "
+                  << "Timeline points:      " << stat.timeline_size() << std::endl
+                  << "  "
+                  << "Interval throughput min / max (ops/s): " << min_throughput
+                  << " / " << max_throughput << std::endl;
+      }
+      if (stat.buffer_bytes() > 0)
+        std::cout << "  "
+                  << "Pre-generated (MB):   " << stat.buffer_bytes() / 1048576.0 << std::endl;
+      if (stat.interleave() > 0)
+        std::cout << "  "
+                  << "Interleaved ops:      " << stat.interleave()
+                  << " in flight per thread" << std::endl;
+      if (stat.batch() > 0) {
+        Histogram key;
+        key.FromProto(stat.key_histogram());
+        std::cout << "  "
+                  << "Keys per batch:       " << stat.batch()
+                  << ", latencies above are per batch" << std::endl
+                  << "  "
+                  << "Per-key mean / P50 / P99 latency (us): " << stat.key_average_latency()
+                  << " / " << key.Percentile(50) / 1000.0
+                  << " / " << key.Percentile(99) / 1000.0 << std::endl;
+      }
+      if (stat.latency_batch() > 0) {
+        Histogram batch;
+        batch.FromProto(stat.batch_histogram());
+        std::cout << "  "
+                  << "Latency batch size:   " << stat.latency_batch() << std::endl
+                  << "  "
+                  << "Batch mean / P50 / P99 latency (us): " << batch.Mean() / 1000.0
+                  << " / " << batch.Percentile(50) / 1000.0
+                  << " / " << batch.Percentile(99) / 1000.0 << std::endl;
+      }
     }
 
     std::cout << "============================ END STATICS "
@@ -247,11 +1065,37 @@ class Bench {
 
  private:
   DB<Key, Value>* db_;
+  CoroDB<Key, Value>* coro_db_ = nullptr;
+  std::function<DB<Key, Value>*()> db_factory_;
   Options<Key, Value>* options_;
   Stats stats_;
   int nr_thread_;
+  uint64_t seed_;
+  std::vector<int> cpus_;
+  std::string numa_policy_;
+  std::string mem_policy_;
+  // PM emulation: pool directory, delay per line flushed and per fence (ns)
+  std::string pmem_dir_;
+  double pmem_flush_latency_ = 0.0;
+  double pmem_fence_latency_ = 0.0;
+  std::vector<int> placement_;  // cpu of every worker thread, if pinned
+  uint64_t rss_baseline_ = 0;  // resident bytes before the first phase
+  uint64_t live_keys_ = 0;
+  ThreadPool pool_;
   std::vector<double> total_latency_;
   std::vector<double> max_latency_;
+  Histogram total_histogram_;
+
+  // operations between two updates of the progress seen by the sampler
+  static constexpr size_t kPublishInterval = 256;
+  // a rate sweep step is saturated below this fraction of its offered load
+  static constexpr double kSaturation = 0.9;
+  // resident set size is sampled this often during a phase for its peak
+  static constexpr std::chrono::milliseconds kRssSampleInterval{10};
+  // PhaseEnd is printed if it took at least this many microseconds
+  static constexpr double kPrintedPhaseEnd = 1000.0;
+  // keep at most this many latency samples per phase in Stat.latency
+  static constexpr size_t kMaxLatencySamples = 100000;
 
   static Operation ToOperation_(char* str) {
     if (strcmp(str, "LOAD") == 0)   return Operation::LOAD;
@@ -260,6 +1104,8 @@ class Bench {
     if (strcmp(str, "UPDATE") == 0) return Operation::UPDATE;
     if (strcmp(str, "DELETE") == 0) return Operation::DELETE;
     if (strcmp(str, "SCAN") == 0)   return Operation::SCAN;
+    if (strcmp(str, "MIX") == 0)    return Operation::MIX;
+    if (strcmp(str, "TRACE") == 0)  return Operation::TRACE;
     return Operation::ERROR;
   }
 
@@ -278,13 +1124,227 @@ class Bench {
         nr_thread_ = nr_thread;
         options_->SetThreadNum(nr_thread);
         i++;
+      } else if (strcmp(argv[i], "-seed") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -seed argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        seed_ = std::stoull(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-cpus") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -cpus argument must follow a cpu list!" << std::endl;
+          exit(0);
+        }
+        cpus_ = ParseCpuList(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-numa-policy") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -numa-policy argument must follow compact or scatter!" << std::endl;
+          exit(0);
+        }
+        numa_policy_ = argv[i + 1];
+        i++;
+      } else if (strcmp(argv[i], "-mem-policy") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -mem-policy argument must follow local or interleave!" << std::endl;
+          exit(0);
+        }
+        mem_policy_ = argv[i + 1];
+        i++;
+      } else if (strcmp(argv[i], "-pmem-emulate") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -pmem-emulate argument must follow a directory!" << std::endl;
+          exit(0);
+        }
+        pmem_dir_ = argv[i + 1];
+        i++;
+      } else if (strcmp(argv[i], "-pmem-flush-latency") == 0 ||
+                 strcmp(argv[i], "-pmem-fence-latency") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! " << argv[i] << " argument must follow a number of ns!" << std::endl;
+          exit(0);
+        }
+        if (strcmp(argv[i], "-pmem-flush-latency") == 0)
+          pmem_flush_latency_ = std::stod(argv[i + 1]);
+        else
+          pmem_fence_latency_ = std::stod(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-pregenerate") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -pregenerate argument must follow a size in MB!" << std::endl;
+          exit(0);
+        }
+        options_->SetPregenerate(std::stoull(argv[i + 1]) << 20);
+        i++;
+      } else if (strcmp(argv[i], "-latency-batch") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -latency-batch argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        options_->SetLatencyBatch(std::stoull(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-latency-sample") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -latency-sample argument must follow a rate!" << std::endl;
+          exit(0);
+        }
+        options_->SetLatencySampleRate(std::stod(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-warmup") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -warmup argument must follow a percentage!" << std::endl;
+          exit(0);
+        }
+        options_->SetWarmup(std::stod(argv[i + 1]) / 100.0);
+        i++;
+      } else if (strcmp(argv[i], "-trace") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -trace argument must follow a trace file!" << std::endl;
+          exit(0);
+        }
+        options_->SetTrace(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-trace-split") == 0) {
+        if (i == argc - 1 || (strcmp(argv[i + 1], "hash") != 0 &&
+                              strcmp(argv[i + 1], "round-robin") != 0)) {
+          std::cout << "ERROR! -trace-split argument must follow hash or round-robin!" << std::endl;
+          exit(0);
+        }
+        options_->SetTraceSplit(strcmp(argv[i + 1], "hash") == 0);
+        i++;
+      } else if (strcmp(argv[i], "-trace-timing") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -trace-timing argument must follow 0 or 1!" << std::endl;
+          exit(0);
+        }
+        options_->SetTraceTiming(std::stoi(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-rate") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -rate argument must follow a rate in ops/s!" << std::endl;
+          exit(0);
+        }
+        options_->SetRate(std::stod(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-arrival") == 0) {
+        if (i == argc - 1 || (strcmp(argv[i + 1], "constant") != 0 &&
+                              strcmp(argv[i + 1], "poisson") != 0)) {
+          std::cout << "ERROR! -arrival argument must follow constant or poisson!" << std::endl;
+          exit(0);
+        }
+        options_->SetArrival(strcmp(argv[i + 1], "poisson") == 0);
+        i++;
+      } else if (strcmp(argv[i], "-rate-sweep") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -rate-sweep argument must follow a number of steps!" << std::endl;
+          exit(0);
+        }
+        options_->SetRateSweep(std::stoi(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-thread-sweep") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -thread-sweep argument must follow a list of thread counts!" << std::endl;
+          exit(0);
+        }
+        options_->SetThreadSweep(ParseCpuList(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-thread-sweep-reload") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -thread-sweep-reload argument must follow 0 or 1!" << std::endl;
+          exit(0);
+        }
+        options_->SetThreadSweepReload(std::stoi(argv[i + 1]) != 0);
+        i++;
+      } else if (strcmp(argv[i], "-scan-length") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -scan-length argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        options_->SetScanLength(std::stoull(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-scan-length-random") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -scan-length-random argument must follow a random generator!" << std::endl;
+          exit(0);
+        }
+        options_->SetScanLengthRandom(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-scan-span") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -scan-span argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        options_->SetScanSpan(std::stoull(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-batch") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -batch argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        options_->SetBatch(std::stoull(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-interleave") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -interleave argument must follow a number!" << std::endl;
+          exit(0);
+        }
+        options_->SetInterleave(std::stoull(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-key-size") == 0 ||
+                 strcmp(argv[i], "-value-size") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! " << argv[i] << " argument must follow a size distribution!" << std::endl;
+          exit(0);
+        }
+        if (strcmp(argv[i], "-key-size") == 0)
+          options_->SetKeySize(argv[i + 1]);
+        else
+          options_->SetValueSize(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-mix") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -mix argument must follow a YCSB workload or ratios!" << std::endl;
+          exit(0);
+        }
+        options_->SetMix(argv[i + 1]);
+        i++;
+      } else if (strcmp(argv[i], "-timeline") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -timeline argument must follow an interval in ms!" << std::endl;
+          exit(0);
+        }
+        options_->SetTimelineInterval(std::stoi(argv[i + 1]));
+        i++;
+      } else if (strcmp(argv[i], "-record-latency") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! -record-latency argument must follow 0 or 1!" << std::endl;
+          exit(0);
+        }
+        options_->SetRecordLatency(std::stoi(argv[i + 1]) != 0);
+        i++;
+      } else if (strcmp(argv[i], "-key-random") == 0 ||
+                 strcmp(argv[i], "-value-random") == 0) {
+        if (i == argc - 1) {
+          std::cout << "ERROR! " << argv[i] << " argument must follow a generator!" << std::endl;
+          exit(0);
+        }
+        if (strcmp(argv[i], "-key-random") == 0)
+          options_->SetKeyRandom(argv[i + 1]);
+        else
+          options_->SetValueRandom(argv[i + 1]);
+        i++;
       } else if ((op = ToOperation_(argv[i])) != Operation::ERROR) {
         if (i == argc - 1) {
           std::cout << "ERROR! " << op << " argument must follow a number!" << std::endl;
           exit(0);
         }
-        size_t size = std::stoi(argv[i + 1]);
-        options_->Append(op, size);
+        // "10s" runs the phase for 10 seconds
+        std::string size = argv[i + 1];
+        if (!size.empty() && size.back() == 's')
+          options_->AppendFor(op, std::stod(size));
+        else
+          options_->Append(op, std::stoull(size));
         i++;
       }
     }
@@ -296,7 +1356,9 @@ class Bench {
     double latency_sum = 0.0;
     for (int i = 1; i < stats_.stat_size(); ++i) {
       auto stat = stats_.mutable_stat(i);
-      stat->set_average_latency(total_latency_[i - 1] / stat->total());
+      // per Multi* call in batched phases, like the percentiles
+      stat->set_average_latency(total_latency_[i - 1] /
+                                stat->total() * std::max<uint64_t>(stat->batch(), 1));
       stat->set_max_latency(max_latency_[i - 1]);
       stat->set_throughput(stat->total() / stat->duration() * 1000000);
       total_op += stat->total();
@@ -307,15 +1369,70 @@ class Bench {
     stat->set_max_latency(
         *std::max_element(max_latency_.cbegin(), max_latency_.cend()));
     stat->set_average_latency(latency_sum / (stats_.stat_size() - 1));
+    SetPercentiles_(stat, total_histogram_);
+  }
+
+  // Statistics of every operation type of a MIX or TRACE phase. Their
+  // latency comes from the histogram, as batched timing only times some
+  // operations. The ratios of a trace are the ones replayed.
+  static void SetOpStats_(Stat* stat, const TestPhase<Key, Value>& phase,
+                          const std::vector<ThreadStat>& thread_stats) {
+    bool mix = phase.op == Operation::MIX;
+    if (mix) stat->set_mix(phase.mix.name);
+    size_t total = 0;
+    for (auto& thread_stat : thread_stats)
+      for (auto& op_stat : thread_stat.op_stats) total += op_stat.ops;
+    for (int op = 0; op < kMixOps; ++op) {
+      LatencyStat op_stat;
+      for (auto& thread_stat : thread_stats)
+        op_stat.Merge(thread_stat.op_stats[op]);
+      if (mix ? phase.mix.ratio[op] <= 0.0 : op_stat.ops == 0) continue;
+      OpStat* proto = stat->add_op_stat();
+      proto->set_op(kMixOpNames[op]);
+      proto->set_ratio(mix ? phase.mix.ratio[op] / phase.mix.Sum()
+                           : (double)op_stat.ops / total);
+      proto->set_total(op_stat.ops);
+      proto->set_throughput(op_stat.ops / stat->duration() * 1000000);
+      proto->set_average_latency(op_stat.histogram.Mean() / 1000.0);
+      proto->set_max_latency(op_stat.histogram.Max() / 1000.0);
+      proto->set_p50_latency(op_stat.histogram.Percentile(50) / 1000.0);
+      proto->set_p99_latency(op_stat.histogram.Percentile(99) / 1000.0);
+      proto->set_p999_latency(op_stat.histogram.Percentile(99.9) / 1000.0);
+      op_stat.histogram.ToProto(proto->mutable_histogram());
+    }
+  }
+
+  static void SetPercentiles_(Stat* stat, const Histogram& histogram) {
+    histogram.ToProto(stat->mutable_histogram());
+    stat->set_p50_latency(histogram.Percentile(50) / 1000.0);
+    stat->set_p90_latency(histogram.Percentile(90) / 1000.0);
+    stat->set_p99_latency(histogram.Percentile(99) / 1000.0);
+    stat->set_p999_latency(histogram.Percentile(99.9) / 1000.0);
+    stat->set_p9999_latency(histogram.Percentile(99.99) / 1000.0);
   }
 
   void Run_() {
     Stat* stat = stats_.add_stat();
+    stats_.set_seed(seed_);
+    stats_.set_clock_source(Clock::Source());
+    stats_.set_clock_frequency(Clock::Frequency());
+    stats_.set_timer_overhead(Clock::Overhead());
+    stats_.set_numa_policy(numa_policy_.empty() && !cpus_.empty()
+                               ? "explicit"
+                               : numa_policy_);
+    stats_.set_mem_policy(mem_policy_);
+    if (PMem::Emulated()) {
+      stats_.set_pmem_dir(PMem::Dir());
+      stats_.set_pmem_flush_latency(PMem::FlushLatency());
+      stats_.set_pmem_fence_latency(PMem::FenceLatency());
+    }
+    rss_baseline_ = ResidentBytes();
     double run_time = 0.0;
-    for (auto& phase : options_->phases_) {
-      db_->PhaseBegin(phase.op, phase.size);
-      run_time += RunPhase_(phase);
-      db_->PhaseEnd(phase.op, phase.size);
+    for (size_t i = 0; i < options_->phases_.size(); ++i) {
+      auto& phase = options_->phases_[i];
+      run_time += phase.thread_sweep.empty() ? RunStep_(phase, i)
+                                             : RunThreadSweep_(phase, i);
+      CountLiveKeys_(phase, stats_.mutable_stat(stats_.stat_size() - 1));
     }
     stat->set_duration(run_time);
     CaculateStatistic_();
@@ -323,126 +1440,783 @@ class Bench {
     DumpStatistics();
   }
 
-  void RunPhaseMain_(int thread_id, TestPhase<Key, Value>& phase,
-                     size_t test_size, double& total_latency,
-                     double& max_latency,
-                     google::protobuf::RepeatedField<double>& latencys,
-                     int sample_interval) {
-    db_->SetThreadId(thread_id);
+  // Runs phase `index` of the options, which seeds its generators.
+  double RunStep_(TestPhase<Key, Value>& phase, size_t index) {
+    ResourceUsage usage = ResourceUsage::Now();
+    uint64_t rss = ResidentBytes();
+    PeakRssSampler sampler(kRssSampleInterval);
+    sampler.Start();
+    db_->PhaseBegin(phase.op, phase.size);
+    double run_time = phase.rate_sweep > 0 ? RunSweep_(phase, index)
+                                           : RunPhase_(phase, index);
+    // timed apart from the phase, e.g. an index built after LOAD
+    Timer timer;
+    timer.Start();
+    db_->PhaseEnd(phase.op, phase.size);
+    Stat* stat = stats_.mutable_stat(stats_.stat_size() - 1);
+    stat->set_phase_end_duration(timer.End());
+
+    uint64_t rss_peak = sampler.Stop();
+    usage = ResourceUsage::Now() - usage;
+    ResourceStat* resource = stat->mutable_resource();
+    resource->set_user_time(usage.user_time);
+    resource->set_sys_time(usage.sys_time);
+    resource->set_minor_faults(usage.minor_faults);
+    resource->set_major_faults(usage.major_faults);
+    resource->set_voluntary_switches(usage.voluntary_switches);
+    resource->set_involuntary_switches(usage.involuntary_switches);
+    resource->set_rss_begin(rss);
+    resource->set_rss_end(ResidentBytes());
+    resource->set_rss_peak(std::max(rss_peak, resource->rss_end()));
+    return run_time;
+  }
 
-    double latency;
-    Timer latency_timer;
-    max_latency = 0.0;
-    total_latency = 0.0;
-
-#define KVBENCH_RECORD_START \
-  do {                       \
-    latency_timer.Start();   \
-  } while (0)
-
-#define KVBENCH_RECORD_END                                   \
-  do {                                                       \
-    latency = latency_timer.End();                           \
-    total_latency += latency;                                \
-    max_latency = std::max(max_latency, latency);            \
-    if (i % sample_interval == 0) *latencys.Add() = latency; \
-  } while (0)
-
-    if (phase.op == Operation::LOAD || phase.op == Operation::PUT) {
-      for (size_t i = 0; i < test_size; ++i) {
-        Key key = phase.random_key->Next();
-        Value value = phase.random_value->Next();
-        KVBENCH_RECORD_START;
-        db_->Put(key, value);
-        KVBENCH_RECORD_END;
+  // Counts the keys inserted and not deleted so far, assuming that deletes
+  // hit live keys (inserts always draw new ones), and sets the memory per
+  // live key of LOAD, PUT and DELETE phases.
+  void CountLiveKeys_(const TestPhase<Key, Value>& phase, Stat* stat) {
+    uint64_t inserted = 0, deleted = 0;
+    if (phase.op == Operation::LOAD || phase.op == Operation::PUT)
+      inserted = stat->total();
+    else if (phase.op == Operation::DELETE)
+      deleted = stat->total();
+    for (auto& op_stat : stat->op_stat()) {
+      if (op_stat.op() == kMixOpNames[kMixInsert]) inserted += op_stat.total();
+      if (op_stat.op() == kMixOpNames[kMixDelete]) deleted += op_stat.total();
+    }
+    live_keys_ += inserted;
+    live_keys_ -= std::min(live_keys_, deleted);
+    if (phase.op != Operation::LOAD && phase.op != Operation::PUT &&
+        phase.op != Operation::DELETE)
+      return;
+    ResourceStat* resource = stat->mutable_resource();
+    resource->set_live_keys(live_keys_);
+    if (live_keys_ > 0 && resource->rss_end() > rss_baseline_)
+      resource->set_bytes_per_key(
+          (double)(resource->rss_end() - rss_baseline_) / live_keys_);
+  }
+
+  // Drops the Stat of the last run of a phase.
+  void DropLastStat_() {
+    stats_.mutable_stat()->RemoveLast();
+    total_latency_.pop_back();
+    max_latency_.pop_back();
+  }
+
+  // Runs phase `index` once with every thread count of its sweep. Every
+  // step becomes a point of the scaling curve, with its speedup and
+  // parallel efficiency relative to the first step; the phase's Stat is the
+  // one of its last step.
+  double RunThreadSweep_(TestPhase<Key, Value>& phase, size_t index) {
+    std::vector<ThreadPoint> curve;
+    double run_time = 0.0;
+    for (size_t step = 0; step < phase.thread_sweep.size(); ++step) {
+      if (step > 0) {
+        DropLastStat_();
+        if (phase.thread_sweep_reload) Reload_(index);
       }
-    } else if (phase.op == Operation::GET) {
-      for (size_t i = 0; i < test_size; ++i) {
-        Key key = phase.random_key->Next();
-        Value value;
-        KVBENCH_RECORD_START;
-        db_->Get(key, &value);
-        KVBENCH_RECORD_END;
+      int nr_thread = phase.thread_sweep[step];
+      db_->SetThreadNumber(nr_thread);
+      run_time = RunStep_(phase, index);
+      const Stat& stat = stats_.stat(stats_.stat_size() - 1);
+      ThreadPoint point;
+      point.set_threads(nr_thread);
+      point.set_throughput(stat.total() / run_time * 1000000);
+      double base = curve.empty() ? point.throughput() : curve[0].throughput();
+      int base_threads = curve.empty() ? nr_thread : curve[0].threads();
+      point.set_speedup(base > 0 ? point.throughput() / base : 0.0);
+      point.set_efficiency(point.speedup() * base_threads / nr_thread);
+      point.set_average_latency(stat.histogram().count()
+                                    ? stat.histogram().sum() / 1000.0 /
+                                          stat.histogram().count()
+                                    : 0.0);
+      point.set_p50_latency(stat.p50_latency());
+      point.set_p99_latency(stat.p99_latency());
+      point.set_p999_latency(stat.p999_latency());
+      curve.push_back(point);
+    }
+    db_->SetThreadNumber(nr_thread_);
+    Stat* stat = stats_.mutable_stat(stats_.stat_size() - 1);
+    for (auto& point : curve) *stat->add_thread_curve() = point;
+    return run_time;
+  }
+
+  // Replaces the DB by a new one from the factory and replays the phases
+  // before phase `index` that change it, without keeping their statistics.
+  // They draw the same keys as in their first run, with the thread count
+  // of their last run. Time-bounded ones insert or delete as many keys as
+  // they get to, which is warned about.
+  void Reload_(size_t index) {
+    if (!db_factory_) {
+      std::cerr << "WARNING! the bench has no DB factory, the thread sweep "
+                   "continues without reloading!" << std::endl;
+      return;
+    }
+    // workers may hold thread-local state of the old DB
+    pool_.Shutdown();
+    delete db_;
+    SetDB(db_factory_());
+    Histogram total_histogram = total_histogram_;
+    for (size_t i = 0; i < index; ++i) {
+      auto& replay = options_->phases_[i];
+      if (replay.op == Operation::GET || replay.op == Operation::SCAN)
+        continue;
+      if (replay.duration > 0)
+        std::cerr << "WARNING! phase " << i << " is time-bounded, its replay "
+                  << "doesn't change the same keys!" << std::endl;
+      db_->SetThreadNumber(replay.thread_sweep.empty()
+                               ? nr_thread_
+                               : replay.thread_sweep.back());
+      db_->PhaseBegin(replay.op, replay.size);
+      RunPhase_(replay, i);
+      db_->PhaseEnd(replay.op, replay.size);
+      DropLastStat_();
+    }
+    db_->SetThreadNumber(nr_thread_);
+    total_histogram_ = total_histogram;
+  }
+
+  // Runs `phase` once closed-loop to find the throughput it saturates at,
+  // then open-loop at increasing fractions of it, stopping early once a
+  // step falls clearly short of its offered load. Every step becomes a
+  // point of the latency/throughput curve; the phase's Stat is the one of
+  // its last step.
+  double RunSweep_(TestPhase<Key, Value>& phase, size_t index) {
+    double rate = phase.rate;
+    std::vector<RatePoint> curve;
+    double capacity = 0.0;
+    double run_time = 0.0;
+    for (int step = 0; step <= phase.rate_sweep; ++step) {
+      // only the last step keeps its Stat
+      if (step > 0) DropLastStat_();
+      phase.rate = capacity * step / phase.rate_sweep;
+      run_time = RunPhase_(phase, index);
+      const Stat& stat = stats_.stat(stats_.stat_size() - 1);
+      RatePoint point;
+      point.set_offered_rate(phase.rate);
+      point.set_throughput(stat.total() / run_time * 1000000);
+      point.set_average_latency(stat.histogram().count()
+                                    ? stat.histogram().sum() / 1000.0 /
+                                          stat.histogram().count()
+                                    : 0.0);
+      point.set_max_latency(stat.histogram().max() / 1000.0);
+      point.set_p50_latency(stat.p50_latency());
+      point.set_p99_latency(stat.p99_latency());
+      point.set_p999_latency(stat.p999_latency());
+      curve.push_back(point);
+      if (step == 0) capacity = point.throughput();
+      if (step > 0 && point.throughput() < kSaturation * phase.rate) break;
+    }
+    Stat* stat = stats_.mutable_stat(stats_.stat_size() - 1);
+    for (auto& point : curve) *stat->add_rate_curve() = point;
+    phase.rate = rate;
+    return run_time;
+  }
+
+  static void RecordLatency_(LatencyStat& latency_stat, double latency_ns) {
+    latency_stat.max_latency =
+        std::max(latency_stat.max_latency, latency_ns / 1000.0);
+    latency_stat.histogram.Record(latency_ns);
+  }
+
+  // Runs operations [begin, end) of a thread. `prepare` fetches the next key
+  // and value from the source, `execute` issues the DB call. Without a
+  // latency batch every operation is timed; with one, batches of operations
+  // are timed as a whole and only a random subset of them individually.
+  // `op_stat` returns the statistics of the type of the prepared operation
+  // in MIX phases, nullptr otherwise; its latency is only known for the
+  // operations timed one by one. With a `pacer` operations are issued at
+  // their intended send times and timed from them. In batched phases an
+  // operation is a batch of `phase.batch` keys.
+  template <typename Prepare, typename Execute, typename OpStat>
+  void RunOps_(TestPhase<Key, Value>& phase, size_t begin, size_t end,
+               uint64_t seed, size_t sample_interval, LatencyStat& latency_stat,
+               google::protobuf::RepeatedField<double>& latencys,
+               Pacer* pacer, Prepare prepare, Execute execute,
+               OpStat op_stat) {
+    size_t keys = std::max<size_t>(phase.batch, 1);
+    latency_stat.ops += (end - begin) * keys;
+    if (!phase.record_latency) {
+      for (size_t i = begin; i < end; ++i) {
+        prepare();
+        if (pacer) pacer->Wait();
+        if (LatencyStat* stat = op_stat()) ++stat->ops;
+        execute();
       }
-    } else if (phase.op == Operation::UPDATE) {
-      for (size_t i = 0; i < test_size; ++i) {
-        Key key = phase.random_key->Next();
-        Value value = phase.random_value->Next();
-        KVBENCH_RECORD_START;
-        db_->Update(key, value);
-        KVBENCH_RECORD_END;
+      return;
+    }
+
+    if (phase.latency_batch <= 1) {
+      for (size_t i = begin; i < end; ++i) {
+        prepare();
+        uint64_t start = pacer ? pacer->Wait() : Clock::Start();
+        execute();
+        double latency_ns = Clock::ToNs(Clock::End() - start);
+        latency_stat.total_latency += latency_ns / 1000.0;
+        RecordLatency_(latency_stat, latency_ns);
+        if (keys > 1) latency_stat.key_histogram.Record(latency_ns / keys);
+        if (LatencyStat* stat = op_stat()) {
+          ++stat->ops;
+          stat->total_latency += latency_ns / 1000.0;
+          RecordLatency_(*stat, latency_ns);
+        }
+        if (i % sample_interval == 0) *latencys.Add() = latency_ns / 1000.0;
       }
-    } else if (phase.op == Operation::DELETE) {
-      for (size_t i = 0; i < test_size; ++i) {
-        Key key = phase.random_key->Next();
-        KVBENCH_RECORD_START;
+      return;
+    }
+
+    uint64_t threshold =
+        phase.latency_sample_rate >= 1.0
+            ? UINT64_MAX
+            : phase.latency_sample_rate * 18446744073709551616.0;
+    for (size_t base = begin; base < end; base += phase.latency_batch) {
+      size_t batch_end = std::min(end, base + phase.latency_batch);
+      uint64_t batch_start = Clock::Start();
+      for (size_t i = base; i < batch_end; ++i) {
+        prepare();
+        uint64_t intended = pacer ? pacer->Wait() : 0;
+        if (pacer && i == base) batch_start = intended;
+        LatencyStat* stat = op_stat();
+        if (stat) ++stat->ops;
+        if (SplitMix64(seed + i) < threshold) {
+          uint64_t start = pacer ? intended : Clock::Start();
+          execute();
+          double latency_ns = Clock::ToNs(Clock::End() - start);
+          RecordLatency_(latency_stat, latency_ns);
+          if (stat) RecordLatency_(*stat, latency_ns);
+        } else {
+          execute();
+        }
+      }
+      double batch_ns = Clock::ToNs(Clock::End() - batch_start);
+      latency_stat.total_latency += batch_ns / 1000.0;
+      latency_stat.batch_histogram.Record(batch_ns / (batch_end - base));
+      if ((base / phase.latency_batch) % sample_interval == 0)
+        *latencys.Add() = batch_ns / 1000.0 / (batch_end - base);
+    }
+  }
+
+  // Runs the `test_size` operations of a thread, keeping the first and last
+  // `phase.warmup` of them out of the steady-state statistics. Progress is
+  // published for the timeline sampler every few operations, which is also
+  // when `stop` is checked.
+  template <typename Prepare, typename Execute, typename OpStat>
+  void RunWindowed_(TestPhase<Key, Value>& phase, size_t test_size,
+                    uint64_t seed, size_t sample_interval,
+                    ThreadStat& thread_stat, const std::atomic<bool>& stop,
+                    Pacer* pacer, Prepare prepare, Execute execute,
+                    OpStat op_stat) {
+    size_t chunk = kPublishInterval;
+    if (phase.latency_batch > 1)
+      chunk = (chunk + phase.latency_batch - 1) / phase.latency_batch *
+              phase.latency_batch;
+    auto run = [&](size_t begin, size_t end, LatencyStat& latency_stat) {
+      for (size_t base = begin; base < end; base += chunk) {
+        RunOps_(phase, base, std::min(end, base + chunk), seed,
+                sample_interval, latency_stat, thread_stat.latencys, pacer,
+                prepare, execute, op_stat);
+        thread_stat.published_ops.store(
+            thread_stat.steady.ops + thread_stat.ramp.ops,
+            std::memory_order_relaxed);
+        thread_stat.published_latency.store(
+            thread_stat.steady.total_latency + thread_stat.ramp.total_latency,
+            std::memory_order_relaxed);
+        if (stop.load(std::memory_order_relaxed)) return;
+      }
+    };
+
+    size_t ramp = 0;
+    if (phase.duration == 0)
+      ramp = std::min<size_t>(test_size * phase.warmup, test_size / 2);
+    run(0, ramp, thread_stat.ramp);
+    thread_stat.steady_start = Clock::Start();
+    run(ramp, test_size - ramp, thread_stat.steady);
+    thread_stat.steady_end = Clock::End();
+    run(test_size - ramp, test_size, thread_stat.ramp);
+  }
+
+  // Stops time-bounded phases after their duration and samples the
+  // progress of the workers every `phase.timeline_interval` ms until `done`.
+  void SampleMain_(TestPhase<Key, Value>& phase,
+                   std::vector<ThreadStat>& thread_stats,
+                   std::atomic<bool>& stop, std::atomic<bool>& done,
+                   Stat* stat) {
+    using namespace std::chrono;
+    auto start = steady_clock::now();
+    auto deadline = start + duration_cast<steady_clock::duration>(
+                                duration<double>(phase.duration));
+    auto interval = phase.timeline_interval > 0
+                        ? duration_cast<steady_clock::duration>(
+                              milliseconds(phase.timeline_interval))
+                        : duration_cast<steady_clock::duration>(
+                              duration<double>(phase.duration));
+    auto last = start;
+    uint64_t last_ops = 0;
+    double last_latency = 0.0;
+    while (!done.load(std::memory_order_acquire)) {
+      auto next = last + interval;
+      if (phase.duration > 0 && deadline < next) next = deadline;
+      std::this_thread::sleep_until(next);
+      auto now = steady_clock::now();
+      if (phase.duration > 0 && now >= deadline)
+        stop.store(true, std::memory_order_relaxed);
+      if (phase.timeline_interval == 0) {
+        if (stop.load(std::memory_order_relaxed)) return;
+        continue;
+      }
+
+      uint64_t ops = 0;
+      double latency = 0.0;
+      for (auto& thread_stat : thread_stats) {
+        ops += thread_stat.published_ops.load(std::memory_order_relaxed);
+        latency +=
+            thread_stat.published_latency.load(std::memory_order_relaxed);
+      }
+      TimelinePoint* point = stat->add_timeline();
+      point->set_time(duration<double>(now - start).count());
+      point->set_ops(ops - last_ops);
+      point->set_throughput((ops - last_ops) /
+                            duration<double>(now - last).count());
+      if (ops > last_ops)
+        point->set_average_latency((latency - last_latency) /
+                                   (ops - last_ops) *
+                                   std::max<size_t>(phase.batch, 1));
+      last = now;
+      last_ops = ops;
+      last_latency = latency;
+      if (stop.load(std::memory_order_relaxed)) return;
+    }
+  }
+
+  // Issues one operation of a MIX or TRACE phase.
+  template <typename Scan>
+  void ExecuteMixOp_(int op, Key& key, Value& value, Scan scan) {
+    switch (op) {
+      case kMixRead:
+        db_->Get(key, &value);
+        break;
+      case kMixUpdate:
+        db_->Update(key, value);
+        break;
+      case kMixInsert:
+        db_->Put(key, value);
+        break;
+      case kMixDelete:
         db_->Delete(key);
-        KVBENCH_RECORD_END;
+        break;
+      case kMixScan:
+        scan();
+        break;
+      case kMixReadModifyWrite: {
+        Value old_value;
+        db_->Get(key, &old_value);
+        db_->Update(key, value);
+        break;
       }
-    } else if (phase.op == Operation::SCAN) {
-      for (size_t i = 0; i < test_size; ++i) {
-        Key min_key = phase.random_key->Next();
-        std::vector<Value> values;
-        KVBENCH_RECORD_START;
-        db_->Scan(min_key, &values);  // TODO
-        KVBENCH_RECORD_END;
+    }
+  }
+
+  // Whether the batches of `phase` run as interleaved coroutines.
+  bool Interleaved_(const TestPhase<Key, Value>& phase) const {
+#ifdef KVBENCH_HAVE_CORO
+    return phase.interleave > 1 && coro_db_ != nullptr;
+#else
+    return false;
+#endif
+  }
+
+  void InitWorker_(int thread_id) {
+    if (!placement_.empty() &&
+        !PinThread(placement_[thread_id % placement_.size()]))
+      std::cerr << "WARNING! failed to pin thread " << thread_id << "!"
+                << std::endl;
+  }
+
+  void RunPhaseMain_(int thread_id, TestPhase<Key, Value>& phase,
+                     OpSource<Key, Value>& source, size_t test_size,
+                     uint64_t seed, size_t sample_interval,
+                     ThreadStat& thread_stat, StartBarrier& barrier,
+                     const std::atomic<bool>& stop) {
+    db_->SetThreadId(thread_id);
+    PMem::Counters pmem = PMem::ThreadCounters();
+
+    Key key;
+    Value value;
+    auto next_key = [&] { key = source.NextKey(); };
+    auto next_key_value = [&] {
+      key = source.NextKey();
+      value = source.NextValue();
+    };
+    auto no_op_stat = []() -> LatencyStat* { return nullptr; };
+
+    // scans read into a buffer allocated once per phase
+    bool scans = phase.op == Operation::SCAN || phase.op == Operation::MIX ||
+                 phase.op == Operation::TRACE;
+    std::vector<Value> scan_buffer(scans ? phase.scan_length : 0);
+    size_t scan_length = phase.scan_length;
+    Key end_key;
+    const Key* scan_end = nullptr;
+    auto next_scan = [&] {
+      scan_length = source.NextScanLength();
+      if (phase.scan_span > 0 && ScanEndKey(key, phase.scan_span, &end_key))
+        scan_end = &end_key;
+    };
+    auto scan = [&] {
+      thread_stat.scan_items +=
+          db_->Scan(key, scan_length, scan_buffer.data(), scan_end);
+    };
+
+    // MIX: the operation type is drawn per operation, inserts replace the
+    // key from the source with a new one.
+    RandomAlias random_op(phase.mix.ratio);
+    random_op.Seed(SplitMix64(~seed));
+    int op = kMixRead;
+    auto next_mix_op = [&] {
+      op = random_op.Next();
+      key = source.NextKey();
+      value = source.NextValue();
+      if (op == kMixInsert) key = source.NextInsertKey();
+      if (op == kMixScan) next_scan();
+    };
+    auto mix_op_stat = [&] { return &thread_stat.op_stats[op]; };
+
+    // TRACE: with timing, wait for the time of the record relative to the
+    // start of the phase before issuing it.
+    uint64_t start = 0;
+    bool trace_timing = phase.trace_timing && source.Trace();
+    auto next_record = [&] {
+      const TraceRecord& record = source.NextRecord();
+      op = record.op;
+      key = source.TraceKey(record.key);
+      value = source.NextValue();
+      if (op == kMixScan) {
+        next_scan();
+        // the value size of a scan record is its length
+        if (record.value_size > 0)
+          scan_length = std::min<size_t>(record.value_size, phase.scan_length);
+      }
+      if (trace_timing) {
+        uint64_t offset = source.Trace()->Offset(record);
+        while (Clock::ToNs(Clock::Start() - start) < offset)
+          std::this_thread::yield();
       }
+    };
+
+    // open loop: every thread issues its share of the target rate
+    std::unique_ptr<Pacer> pacer;
+    if (phase.rate > 0)
+      pacer.reset(new Pacer(phase.rate / db_->GetThreadNumber() /
+                                std::max<size_t>(phase.batch, 1),
+                            phase.poisson, SplitMix64(seed + 2)));
+
+    auto run = [&](auto prepare, auto execute, auto op_stat) {
+      RunWindowed_(phase, test_size, seed, sample_interval, thread_stat, stop,
+                   pacer.get(), prepare, execute, op_stat);
+    };
+
+    barrier.Wait();
+    start = Clock::Start();
+    if (pacer) pacer->Start(start);
+
+    // batched phases fill `phase.batch` keys at a time
+    std::vector<Key> keys(phase.batch);
+    std::vector<Value> values(phase.batch);
+    auto next_keys = [&] {
+      for (auto& batch_key : keys) batch_key = source.NextKey();
+    };
+    auto next_keys_values = [&] {
+      for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = source.NextKey();
+        values[i] = source.NextValue();
+      }
+    };
+
+#ifdef KVBENCH_HAVE_CORO
+    // interleaved phases start a coroutine per key of the batch and resume
+    // them round-robin until all have finished
+    std::vector<Task> tasks(Interleaved_(phase) ? phase.batch : 0);
+    auto co_put = [&] {
+      for (size_t i = 0; i < tasks.size(); ++i)
+        tasks[i] = coro_db_->CoPut(keys[i], values[i]);
+      RunInterleaved(tasks.data(), tasks.size());
+    };
+    auto co_get = [&] {
+      for (size_t i = 0; i < tasks.size(); ++i)
+        tasks[i] = coro_db_->CoGet(keys[i], &values[i]);
+      RunInterleaved(tasks.data(), tasks.size());
+    };
+#endif
+
+    if (phase.batch > 1 && Interleaved_(phase)) {
+#ifdef KVBENCH_HAVE_CORO
+      if (phase.op == Operation::LOAD || phase.op == Operation::PUT)
+        run(next_keys_values, co_put, no_op_stat);
+      else if (phase.op == Operation::GET)
+        run(next_keys, co_get, no_op_stat);
+#endif
+    } else if (phase.batch > 1) {
+      if (phase.op == Operation::LOAD || phase.op == Operation::PUT)
+        run(next_keys_values,
+            [&] { db_->MultiPut(keys.data(), values.data(), keys.size()); },
+            no_op_stat);
+      else if (phase.op == Operation::GET)
+        run(next_keys,
+            [&] { db_->MultiGet(keys.data(), values.data(), keys.size()); },
+            no_op_stat);
+      else if (phase.op == Operation::DELETE)
+        run(next_keys, [&] { db_->MultiDelete(keys.data(), keys.size()); },
+            no_op_stat);
+    } else if (phase.op == Operation::LOAD || phase.op == Operation::PUT) {
+      run(next_key_value, [&] { db_->Put(key, value); }, no_op_stat);
+    } else if (phase.op == Operation::GET) {
+      run(next_key, [&] { db_->Get(key, &value); }, no_op_stat);
+    } else if (phase.op == Operation::UPDATE) {
+      run(next_key_value, [&] { db_->Update(key, value); }, no_op_stat);
+    } else if (phase.op == Operation::DELETE) {
+      run(next_key, [&] { db_->Delete(key); }, no_op_stat);
+    } else if (phase.op == Operation::SCAN) {
+      run([&] {
+            next_key();
+            next_scan();
+          }, scan, no_op_stat);
+    } else if (phase.op == Operation::MIX) {
+      run(next_mix_op, [&] { ExecuteMixOp_(op, key, value, scan); },
+          mix_op_stat);
+    } else if (phase.op == Operation::TRACE) {
+      run(next_record, [&] { ExecuteMixOp_(op, key, value, scan); },
+          mix_op_stat);
     } else {
       assert(0);
     }
+    thread_stat.pmem.flushes = PMem::ThreadCounters().flushes - pmem.flushes;
+    thread_stat.pmem.fences = PMem::ThreadCounters().fences - pmem.fences;
+  }
 
-#undef KVBENCH_RECORD_START
-#undef KVBENCH_RECORD_END
-  }  // namespace kvbench
-
-  double RunPhase_(TestPhase<Key, Value>& phase) {
+  // Runs phase `index` of the options once. Its generators are seeded from
+  // `index`, so that reruns of the phase draw the same keys.
+  double RunPhase_(TestPhase<Key, Value>& phase, size_t index) {
     Stat* stat = stats_.add_stat();
-    stat->set_total(phase.size);
+    // a TRACE phase replays `size` records of its trace, or all of them
+    size_t size = phase.size;
+    std::unique_ptr<TraceFile> trace;
+    if (phase.op == Operation::TRACE) {
+      trace.reset(new TraceFile(phase.trace_file));
+      if (size == 0 || size > trace->Size()) size = trace->Size();
+      if (phase.trace_timing && !trace->HasTimestamps())
+        std::cerr << "WARNING! " << phase.trace_file
+                  << " has no timestamps, replaying it back to back!"
+                  << std::endl;
+    }
+    stat->set_total(size);
+    if (phase.interleave > 1 && !Interleaved_(phase))
+      std::cerr << "WARNING! " << db_->Name()
+                << " can't run interleaved, issuing batches of "
+                << phase.batch << " keys instead!" << std::endl;
+    int phase_id = index + 1;
     Timer timer;
-    int sample_interval = phase.size < 2000000 ? 1 : phase.size / 2000000;
+    size_t keys_per_op = std::max<size_t>(phase.batch, 1);
+    size_t samples = size / keys_per_op;
+    if (phase.latency_batch > 1) samples /= phase.latency_batch;
+    size_t sample_interval =
+        samples < kMaxLatencySamples ? 1 : samples / kMaxLatencySamples;
+    // the number of operations of a time-bounded phase isn't known up front,
+    // its latencies are only kept in the histogram and the timeline.
+    if (phase.duration > 0) sample_interval = SIZE_MAX;
 
     int nr_thread = db_->GetThreadNumber();
-    google::protobuf::RepeatedField<double>* latencys =
-        new google::protobuf::RepeatedField<double>[nr_thread];
-    std::vector<double> total_latency;
-    std::vector<double> max_latency;
-    total_latency.resize(nr_thread);
-    max_latency.resize(nr_thread);
+    stat->set_threads(nr_thread);
+    std::vector<ThreadStat> thread_stats(nr_thread);
+    for (int thread_id = 0; thread_id < nr_thread && !placement_.empty();
+         ++thread_id)
+      stat->add_cpu(placement_[thread_id % placement_.size()]);
 
-    timer.Start();
-
-    std::vector<std::thread> test_threads;
+    std::vector<size_t> test_sizes;
     for (int thread_id = 0; thread_id < nr_thread; ++thread_id) {
-      size_t test_size;
-      if (thread_id != nr_thread - 1)
-        test_size = phase.size / nr_thread;
+      if (phase.duration > 0)
+        test_sizes.push_back(SIZE_MAX);
+      else if (thread_id != nr_thread - 1)
+        test_sizes.push_back(size / nr_thread);
       else
-        test_size = phase.size - (phase.size / nr_thread) *
-                                     (nr_thread - 1);
-      test_threads.emplace_back(&Bench::RunPhaseMain_, this,
-                                thread_id, std::ref(phase), test_size,
-                                std::ref(total_latency[thread_id]),
-                                std::ref(max_latency[thread_id]),
-                                std::ref(latencys[thread_id]), sample_interval);
+        test_sizes.push_back(size - (size / nr_thread) * (nr_thread - 1));
+      // batched phases only issue whole batches
+      if (test_sizes.back() != SIZE_MAX)
+        test_sizes.back() =
+            (test_sizes.back() + keys_per_op - 1) / keys_per_op * keys_per_op;
+    }
+
+    // every thread gets its own generators, seeded from the run seed, the
+    // phase and the thread id so that a run can be reproduced exactly.
+    std::mutex random_mutex;
+    bool with_value = phase.op == Operation::LOAD ||
+                      phase.op == Operation::PUT ||
+                      phase.op == Operation::UPDATE ||
+                      phase.op == Operation::MIX ||
+                      phase.op == Operation::TRACE;
+    // trace records are replayed in place. The budget includes the arena
+    // bytes of string keys.
+    size_t item_bytes = sizeof(Key) + phase.random_key->ItemBytes() +
+                        (with_value ? sizeof(Value) : 0);
+    size_t chunk =
+        trace ? 0 : phase.pregenerate_limit / item_bytes / nr_thread;
+    // doesn't fit at once, split the budget over two chunk buffers
+    if (chunk < test_sizes.back()) chunk /= 2;
+    if (phase.pregenerate_limit > 0 && chunk == 0) chunk = 1;
+    std::vector<uint64_t> seeds;
+    std::vector<std::unique_ptr<OpSource<Key, Value>>> sources;
+    std::vector<std::unique_ptr<TraceShard>> shards;
+    for (int thread_id = 0; thread_id < nr_thread; ++thread_id) {
+      uint64_t seed =
+          SplitMix64(seed_ ^ ((uint64_t)phase_id << 32 | thread_id));
+      Random<Key>* random_key =
+          phase.random_key->Fork(seed, thread_id, nr_thread);
+      Random<Value>* random_value =
+          phase.random_value->Fork(SplitMix64(seed), thread_id, nr_thread);
+      if (random_key == nullptr)
+        random_key = new RandomLocked<Key>(phase.random_key, &random_mutex);
+      if (random_value == nullptr)
+        random_value =
+            new RandomLocked<Value>(phase.random_value, &random_mutex);
+      Random<Key>* random_insert_key = nullptr;
+      if (phase.random_insert_key) {
+        random_insert_key = phase.random_insert_key->Fork(
+            SplitMix64(seed + 1), thread_id, nr_thread);
+        if (random_insert_key == nullptr)
+          random_insert_key =
+              new RandomLocked<Key>(phase.random_insert_key, &random_mutex);
+      }
+      seeds.push_back(seed);
+      sources.emplace_back(new OpSource<Key, Value>(
+          random_key, random_value, test_sizes[thread_id], chunk, with_value,
+          random_insert_key));
+      Random<uint64_t>* random_scan_length = nullptr;
+      if (phase.random_scan_length) {
+        random_scan_length = phase.random_scan_length->Fork(
+            SplitMix64(seed + 3), thread_id, nr_thread);
+        if (random_scan_length == nullptr)
+          random_scan_length = new RandomLocked<uint64_t>(
+              phase.random_scan_length, &random_mutex);
+      }
+      sources.back()->SetScanLength(phase.scan_length, random_scan_length);
+      sources.back()->Reserve(keys_per_op);
+      if (trace) {
+        shards.emplace_back(new TraceShard(*trace, size, thread_id, nr_thread,
+                                           phase.trace_by_key));
+        sources.back()->SetTrace(shards.back().get());
+      }
+      if (phase.op == Operation::MIX || phase.op == Operation::TRACE)
+        thread_stats[thread_id].op_stats.resize(kMixOps);
     }
 
-    for (auto&& test_thread : test_threads)
-      if (test_thread.joinable()) test_thread.join();
+    if (chunk > 0 || trace) {
+      // fill the buffers on the workers that use them, so that they are
+      // first touched on the right NUMA node.
+      pool_.Run(nr_thread,
+                [&sources](int thread_id) { sources[thread_id]->Prepare(); });
+      size_t buffer_bytes = 0;
+      for (auto& source : sources) buffer_bytes += source->BufferBytes();
+      stat->set_buffer_bytes(buffer_bytes);
+    }
+    for (int thread_id = 0; thread_id < (int)shards.size(); ++thread_id)
+      test_sizes[thread_id] = shards[thread_id]->Size();
+
+    StartBarrier barrier;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> done{false};
+    pool_.Start(nr_thread, [&](int thread_id) {
+      RunPhaseMain_(thread_id, phase, *sources[thread_id],
+                    test_sizes[thread_id] / keys_per_op, seeds[thread_id],
+                    sample_interval, thread_stats[thread_id], barrier, stop);
+    });
+
+    barrier.WaitReady(nr_thread);
+    timer.Start();
+    std::thread sampler;
+    if (phase.duration > 0 || phase.timeline_interval > 0)
+      sampler = std::thread(&Bench::SampleMain_, this, std::ref(phase),
+                            std::ref(thread_stats), std::ref(stop),
+                            std::ref(done), stat);
+    barrier.Release();
+
+    pool_.Wait();
 
     double run_time = timer.End();
     stat->set_duration(run_time);
+    done.store(true, std::memory_order_release);
+    if (sampler.joinable()) sampler.join();
+    sources.clear();
 
     auto stat_latency = stat->mutable_latency();
-    for (int i = 0; i < nr_thread; ++i)
-      stat_latency->MergeFrom(latencys[i]);
+    LatencyStat steady;
+    double steady_throughput = 0.0;
+    for (auto& thread_stat : thread_stats) {
+      stat_latency->MergeFrom(thread_stat.latencys);
+      steady.Merge(thread_stat.steady);
+      double duration_ns =
+          Clock::ToNs(thread_stat.steady_end - thread_stat.steady_start);
+      if (duration_ns > 0)
+        steady_throughput += thread_stat.steady.ops / duration_ns * 1e9;
+    }
+    LatencyStat raw = steady;
+    for (auto& thread_stat : thread_stats) raw.Merge(thread_stat.ramp);
+    if (phase.duration > 0 || keys_per_op > 1) stat->set_total(raw.ops);
+
+    SetPercentiles_(stat, raw.histogram);
+    total_histogram_.Merge(raw.histogram);
+    if (phase.record_latency && phase.latency_batch > 1) {
+      stat->set_latency_batch(phase.latency_batch);
+      raw.batch_histogram.ToProto(stat->mutable_batch_histogram());
+    }
+    if (Interleaved_(phase)) stat->set_interleave(phase.interleave);
+    if (keys_per_op > 1) {
+      stat->set_batch(keys_per_op);
+      if (raw.ops > 0)
+        stat->set_key_average_latency(raw.total_latency / raw.ops);
+      if (phase.record_latency)
+        raw.key_histogram.ToProto(stat->mutable_key_histogram());
+    }
+    if (phase.warmup > 0) {
+      // throughput of the window is the sum of the per-thread rates, as
+      // the threads' windows don't start and end at the same time.
+      SteadyStat* steady_stat = stat->mutable_steady();
+      steady_stat->set_warmup(phase.warmup);
+      steady_stat->set_total(steady.ops);
+      steady_stat->set_throughput(steady_throughput);
+      if (steady.ops > 0)
+        steady_stat->set_average_latency(steady.total_latency / steady.ops *
+                                         keys_per_op);
+      steady_stat->set_max_latency(steady.max_latency);
+      steady_stat->set_p50_latency(steady.histogram.Percentile(50) / 1000.0);
+      steady_stat->set_p99_latency(steady.histogram.Percentile(99) / 1000.0);
+      steady_stat->set_p999_latency(
+          steady.histogram.Percentile(99.9) / 1000.0);
+    }
+
+    if (phase.op == Operation::MIX || phase.op == Operation::TRACE)
+      SetOpStats_(stat, phase, thread_stats);
+    uint64_t scan_items = 0;
+    for (auto& thread_stat : thread_stats) scan_items += thread_stat.scan_items;
+    if (scan_items > 0) {
+      stat->set_scan_items(scan_items);
+      stat->set_scan_item_throughput(scan_items / run_time * 1000000);
+    }
+    for (auto& thread_stat : thread_stats) {
+      stat->set_pmem_flushes(stat->pmem_flushes() + thread_stat.pmem.flushes);
+      stat->set_pmem_fences(stat->pmem_fences() + thread_stat.pmem.fences);
+    }
+    if (std::is_same<Key, std::string_view>::value)
+      stat->set_key_size(phase.key_size);
+    if (std::is_same<Value, std::string_view>::value)
+      stat->set_value_size(phase.value_size);
+    if (phase.rate > 0) {
+      stat->set_offered_rate(phase.rate);
+      stat->set_arrival(phase.poisson ? "poisson" : "constant");
+    }
 
-    total_latency_.push_back(
-        std::accumulate(total_latency.cbegin(), total_latency.cend(), 0.0));
-    max_latency_.push_back(
-        *std::max_element(max_latency.cbegin(), max_latency.cend()));
+    total_latency_.push_back(raw.total_latency);
+    max_latency_.push_back(raw.max_latency);
 
     return run_time;
   }
 };
 
-}  // namespace kvbench
\ No newline at end of file
+}  // namespace kvbench
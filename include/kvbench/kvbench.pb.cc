@@ -5,460 +5,4417 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace protobuf_kvbench_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_kvbench_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Stat;
-}  // namespace protobuf_kvbench_2eproto
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace kvbench {
+PROTOBUF_CONSTEXPR LatencyHistogram::LatencyHistogram(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.index_)*/{}
+  , /*decltype(_impl_._index_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bucket_count_)*/{}
+  , /*decltype(_impl_._bucket_count_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.sum_)*/uint64_t{0u}
+  , /*decltype(_impl_.min_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_.sub_bucket_bits_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyHistogramDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyHistogramDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyHistogramDefaultTypeInternal() {}
+  union {
+    LatencyHistogram _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyHistogramDefaultTypeInternal _LatencyHistogram_default_instance_;
+PROTOBUF_CONSTEXPR ResourceStat::ResourceStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.user_time_)*/0
+  , /*decltype(_impl_.sys_time_)*/0
+  , /*decltype(_impl_.minor_faults_)*/uint64_t{0u}
+  , /*decltype(_impl_.major_faults_)*/uint64_t{0u}
+  , /*decltype(_impl_.voluntary_switches_)*/uint64_t{0u}
+  , /*decltype(_impl_.involuntary_switches_)*/uint64_t{0u}
+  , /*decltype(_impl_.rss_begin_)*/uint64_t{0u}
+  , /*decltype(_impl_.rss_end_)*/uint64_t{0u}
+  , /*decltype(_impl_.rss_peak_)*/uint64_t{0u}
+  , /*decltype(_impl_.live_keys_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_per_key_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResourceStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourceStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourceStatDefaultTypeInternal() {}
+  union {
+    ResourceStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceStatDefaultTypeInternal _ResourceStat_default_instance_;
+PROTOBUF_CONSTEXPR SteadyStat::SteadyStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.warmup_)*/0
+  , /*decltype(_impl_.total_)*/uint64_t{0u}
+  , /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.max_latency_)*/0
+  , /*decltype(_impl_.p50_latency_)*/0
+  , /*decltype(_impl_.p99_latency_)*/0
+  , /*decltype(_impl_.p999_latency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SteadyStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SteadyStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SteadyStatDefaultTypeInternal() {}
+  union {
+    SteadyStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SteadyStatDefaultTypeInternal _SteadyStat_default_instance_;
+PROTOBUF_CONSTEXPR TimelinePoint::TimelinePoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_)*/0
+  , /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.ops_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimelinePointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimelinePointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimelinePointDefaultTypeInternal() {}
+  union {
+    TimelinePoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimelinePointDefaultTypeInternal _TimelinePoint_default_instance_;
+PROTOBUF_CONSTEXPR OpStat::OpStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.histogram_)*/nullptr
+  , /*decltype(_impl_.ratio_)*/0
+  , /*decltype(_impl_.total_)*/uint64_t{0u}
+  , /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.max_latency_)*/0
+  , /*decltype(_impl_.p50_latency_)*/0
+  , /*decltype(_impl_.p99_latency_)*/0
+  , /*decltype(_impl_.p999_latency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OpStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OpStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OpStatDefaultTypeInternal() {}
+  union {
+    OpStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OpStatDefaultTypeInternal _OpStat_default_instance_;
+PROTOBUF_CONSTEXPR RatePoint::RatePoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offered_rate_)*/0
+  , /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.max_latency_)*/0
+  , /*decltype(_impl_.p50_latency_)*/0
+  , /*decltype(_impl_.p99_latency_)*/0
+  , /*decltype(_impl_.p999_latency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RatePointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RatePointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RatePointDefaultTypeInternal() {}
+  union {
+    RatePoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RatePointDefaultTypeInternal _RatePoint_default_instance_;
+PROTOBUF_CONSTEXPR ThreadPoint::ThreadPoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.speedup_)*/0
+  , /*decltype(_impl_.efficiency_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.p50_latency_)*/0
+  , /*decltype(_impl_.p99_latency_)*/0
+  , /*decltype(_impl_.p999_latency_)*/0
+  , /*decltype(_impl_.threads_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ThreadPointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ThreadPointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ThreadPointDefaultTypeInternal() {}
+  union {
+    ThreadPoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ThreadPointDefaultTypeInternal _ThreadPoint_default_instance_;
+PROTOBUF_CONSTEXPR Stat::Stat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.latency_)*/{}
+  , /*decltype(_impl_.cpu_)*/{}
+  , /*decltype(_impl_._cpu_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.timeline_)*/{}
+  , /*decltype(_impl_.op_stat_)*/{}
+  , /*decltype(_impl_.rate_curve_)*/{}
+  , /*decltype(_impl_.thread_curve_)*/{}
+  , /*decltype(_impl_.mix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.arrival_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_size_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_size_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.histogram_)*/nullptr
+  , /*decltype(_impl_.batch_histogram_)*/nullptr
+  , /*decltype(_impl_.steady_)*/nullptr
+  , /*decltype(_impl_.resource_)*/nullptr
+  , /*decltype(_impl_.key_histogram_)*/nullptr
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_.average_latency_)*/0
+  , /*decltype(_impl_.max_latency_)*/0
+  , /*decltype(_impl_.throughput_)*/0
+  , /*decltype(_impl_.total_)*/int64_t{0}
+  , /*decltype(_impl_.buffer_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_latency_)*/0
+  , /*decltype(_impl_.p90_latency_)*/0
+  , /*decltype(_impl_.p99_latency_)*/0
+  , /*decltype(_impl_.p999_latency_)*/0
+  , /*decltype(_impl_.p9999_latency_)*/0
+  , /*decltype(_impl_.latency_batch_)*/uint64_t{0u}
+  , /*decltype(_impl_.failed_)*/0
+  , /*decltype(_impl_.threads_)*/0
+  , /*decltype(_impl_.offered_rate_)*/0
+  , /*decltype(_impl_.scan_items_)*/uint64_t{0u}
+  , /*decltype(_impl_.scan_item_throughput_)*/0
+  , /*decltype(_impl_.batch_)*/uint64_t{0u}
+  , /*decltype(_impl_.interleave_)*/uint64_t{0u}
+  , /*decltype(_impl_.phase_end_duration_)*/0
+  , /*decltype(_impl_.pmem_flushes_)*/uint64_t{0u}
+  , /*decltype(_impl_.pmem_fences_)*/uint64_t{0u}
+  , /*decltype(_impl_.key_average_latency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatDefaultTypeInternal() {}
+  union {
+    Stat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatDefaultTypeInternal _Stat_default_instance_;
+PROTOBUF_CONSTEXPR Stats::Stats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stat_)*/{}
+  , /*decltype(_impl_.clock_source_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.numa_policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mem_policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.pmem_dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.seed_)*/uint64_t{0u}
+  , /*decltype(_impl_.clock_frequency_)*/0
+  , /*decltype(_impl_.timer_overhead_)*/0
+  , /*decltype(_impl_.pmem_flush_latency_)*/0
+  , /*decltype(_impl_.pmem_fence_latency_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsDefaultTypeInternal() {}
+  union {
+    Stats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsDefaultTypeInternal _Stats_default_instance_;
+}  // namespace kvbench
+static ::_pb::Metadata file_level_metadata_kvbench_2eproto[9];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_kvbench_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kvbench_2eproto = nullptr;
+
+const uint32_t TableStruct_kvbench_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.sub_bucket_bits_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.sum_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::LatencyHistogram, _impl_.bucket_count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.user_time_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.sys_time_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.minor_faults_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.major_faults_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.voluntary_switches_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.involuntary_switches_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.rss_begin_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.rss_end_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.rss_peak_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.live_keys_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ResourceStat, _impl_.bytes_per_key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.warmup_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.max_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.p50_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.p99_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::SteadyStat, _impl_.p999_latency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::TimelinePoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::TimelinePoint, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::TimelinePoint, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::TimelinePoint, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::TimelinePoint, _impl_.ops_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.ratio_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.max_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.p50_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.p99_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.p999_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::OpStat, _impl_.histogram_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.offered_rate_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.max_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.p50_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.p99_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::RatePoint, _impl_.p999_latency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.threads_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.speedup_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.efficiency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.p50_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.p99_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::ThreadPoint, _impl_.p999_latency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.max_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.failed_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.buffer_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.histogram_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.p50_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.p90_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.p99_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.p999_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.p9999_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.latency_batch_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.batch_histogram_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.cpu_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.steady_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.timeline_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.mix_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.op_stat_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.offered_rate_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.arrival_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.rate_curve_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.scan_items_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.scan_item_throughput_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.batch_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.interleave_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.key_size_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.value_size_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.threads_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.thread_curve_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.phase_end_duration_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.pmem_flushes_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.pmem_fences_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.resource_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.key_average_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stat, _impl_.key_histogram_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.stat_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.seed_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.clock_source_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.clock_frequency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.timer_overhead_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.numa_policy_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.mem_policy_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.pmem_dir_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.pmem_flush_latency_),
+  PROTOBUF_FIELD_OFFSET(::kvbench::Stats, _impl_.pmem_fence_latency_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::kvbench::LatencyHistogram)},
+  { 13, -1, -1, sizeof(::kvbench::ResourceStat)},
+  { 30, -1, -1, sizeof(::kvbench::SteadyStat)},
+  { 44, -1, -1, sizeof(::kvbench::TimelinePoint)},
+  { 54, -1, -1, sizeof(::kvbench::OpStat)},
+  { 70, -1, -1, sizeof(::kvbench::RatePoint)},
+  { 83, -1, -1, sizeof(::kvbench::ThreadPoint)},
+  { 97, -1, -1, sizeof(::kvbench::Stat)},
+  { 141, -1, -1, sizeof(::kvbench::Stats)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::kvbench::_LatencyHistogram_default_instance_._instance,
+  &::kvbench::_ResourceStat_default_instance_._instance,
+  &::kvbench::_SteadyStat_default_instance_._instance,
+  &::kvbench::_TimelinePoint_default_instance_._instance,
+  &::kvbench::_OpStat_default_instance_._instance,
+  &::kvbench::_RatePoint_default_instance_._instance,
+  &::kvbench::_ThreadPoint_default_instance_._instance,
+  &::kvbench::_Stat_default_instance_._instance,
+  &::kvbench::_Stats_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_kvbench_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rkvbench.proto\022\007kvbench\"\206\001\n\020LatencyHist"
+  "ogram\022\027\n\017sub_bucket_bits\030\001 \001(\005\022\r\n\005count\030"
+  "\002 \001(\004\022\013\n\003sum\030\003 \001(\004\022\013\n\003min\030\004 \001(\004\022\013\n\003max\030\005"
+  " \001(\004\022\r\n\005index\030\006 \003(\r\022\024\n\014bucket_count\030\007 \003("
+  "\004\"\371\001\n\014ResourceStat\022\021\n\tuser_time\030\001 \001(\001\022\020\n"
+  "\010sys_time\030\002 \001(\001\022\024\n\014minor_faults\030\003 \001(\004\022\024\n"
+  "\014major_faults\030\004 \001(\004\022\032\n\022voluntary_switche"
+  "s\030\005 \001(\004\022\034\n\024involuntary_switches\030\006 \001(\004\022\021\n"
+  "\trss_begin\030\007 \001(\004\022\017\n\007rss_end\030\010 \001(\004\022\020\n\010rss"
+  "_peak\030\t \001(\004\022\021\n\tlive_keys\030\n \001(\004\022\025\n\rbytes_"
+  "per_key\030\013 \001(\001\"\255\001\n\nSteadyStat\022\016\n\006warmup\030\001"
+  " \001(\001\022\r\n\005total\030\002 \001(\004\022\022\n\nthroughput\030\003 \001(\001\022"
+  "\027\n\017average_latency\030\004 \001(\001\022\023\n\013max_latency\030"
+  "\005 \001(\001\022\023\n\013p50_latency\030\006 \001(\001\022\023\n\013p99_latenc"
+  "y\030\007 \001(\001\022\024\n\014p999_latency\030\010 \001(\001\"W\n\rTimelin"
+  "ePoint\022\014\n\004time\030\001 \001(\001\022\022\n\nthroughput\030\002 \001(\001"
+  "\022\027\n\017average_latency\030\003 \001(\001\022\013\n\003ops\030\004 \001(\004\"\342"
+  "\001\n\006OpStat\022\n\n\002op\030\001 \001(\t\022\r\n\005ratio\030\002 \001(\001\022\r\n\005"
+  "total\030\003 \001(\004\022\022\n\nthroughput\030\004 \001(\001\022\027\n\017avera"
+  "ge_latency\030\005 \001(\001\022\023\n\013max_latency\030\006 \001(\001\022\023\n"
+  "\013p50_latency\030\007 \001(\001\022\023\n\013p99_latency\030\010 \001(\001\022"
+  "\024\n\014p999_latency\030\t \001(\001\022,\n\thistogram\030\n \001(\013"
+  "2\031.kvbench.LatencyHistogram\"\243\001\n\tRatePoin"
+  "t\022\024\n\014offered_rate\030\001 \001(\001\022\022\n\nthroughput\030\002 "
+  "\001(\001\022\027\n\017average_latency\030\003 \001(\001\022\023\n\013max_late"
+  "ncy\030\004 \001(\001\022\023\n\013p50_latency\030\005 \001(\001\022\023\n\013p99_la"
+  "tency\030\006 \001(\001\022\024\n\014p999_latency\030\007 \001(\001\"\260\001\n\013Th"
+  "readPoint\022\017\n\007threads\030\001 \001(\005\022\022\n\nthroughput"
+  "\030\002 \001(\001\022\017\n\007speedup\030\003 \001(\001\022\022\n\nefficiency\030\004 "
+  "\001(\001\022\027\n\017average_latency\030\005 \001(\001\022\023\n\013p50_late"
+  "ncy\030\006 \001(\001\022\023\n\013p99_latency\030\007 \001(\001\022\024\n\014p999_l"
+  "atency\030\010 \001(\001\"\326\007\n\004Stat\022\020\n\010duration\030\001 \001(\001\022"
+  "\027\n\017average_latency\030\002 \001(\001\022\023\n\013max_latency\030"
+  "\003 \001(\001\022\022\n\nthroughput\030\004 \001(\001\022\017\n\007latency\030\005 \003"
+  "(\001\022\016\n\006failed\030\006 \001(\005\022\r\n\005total\030\007 \001(\003\022\024\n\014buf"
+  "fer_bytes\030\010 \001(\004\022,\n\thistogram\030\t \001(\0132\031.kvb"
+  "ench.LatencyHistogram\022\023\n\013p50_latency\030\n \001"
+  "(\001\022\023\n\013p90_latency\030\013 \001(\001\022\023\n\013p99_latency\030\014"
+  " \001(\001\022\024\n\014p999_latency\030\r \001(\001\022\025\n\rp9999_late"
+  "ncy\030\016 \001(\001\022\025\n\rlatency_batch\030\017 \001(\004\0222\n\017batc"
+  "h_histogram\030\020 \001(\0132\031.kvbench.LatencyHisto"
+  "gram\022\013\n\003cpu\030\021 \003(\005\022#\n\006steady\030\022 \001(\0132\023.kvbe"
+  "nch.SteadyStat\022(\n\010timeline\030\023 \003(\0132\026.kvben"
+  "ch.TimelinePoint\022\013\n\003mix\030\024 \001(\t\022 \n\007op_stat"
+  "\030\025 \003(\0132\017.kvbench.OpStat\022\024\n\014offered_rate\030"
+  "\026 \001(\001\022\017\n\007arrival\030\027 \001(\t\022&\n\nrate_curve\030\030 \003"
+  "(\0132\022.kvbench.RatePoint\022\022\n\nscan_items\030\031 \001"
+  "(\004\022\034\n\024scan_item_throughput\030\032 \001(\001\022\r\n\005batc"
+  "h\030\033 \001(\004\022\022\n\ninterleave\030\034 \001(\004\022\020\n\010key_size\030"
+  "\035 \001(\t\022\022\n\nvalue_size\030\036 \001(\t\022\017\n\007threads\030\037 \001"
+  "(\005\022*\n\014thread_curve\030  \003(\0132\024.kvbench.Threa"
+  "dPoint\022\032\n\022phase_end_duration\030! \001(\001\022\024\n\014pm"
+  "em_flushes\030\" \001(\004\022\023\n\013pmem_fences\030# \001(\004\022\'\n"
+  "\010resource\030$ \001(\0132\025.kvbench.ResourceStat\022\033"
+  "\n\023key_average_latency\030% \001(\001\0220\n\rkey_histo"
+  "gram\030& \001(\0132\031.kvbench.LatencyHistogram\"\354\001"
+  "\n\005Stats\022\033\n\004stat\030\001 \003(\0132\r.kvbench.Stat\022\014\n\004"
+  "seed\030\002 \001(\004\022\024\n\014clock_source\030\003 \001(\t\022\027\n\017cloc"
+  "k_frequency\030\004 \001(\001\022\026\n\016timer_overhead\030\005 \001("
+  "\001\022\023\n\013numa_policy\030\006 \001(\t\022\022\n\nmem_policy\030\007 \001"
+  "(\t\022\020\n\010pmem_dir\030\010 \001(\t\022\032\n\022pmem_flush_laten"
+  "cy\030\t \001(\001\022\032\n\022pmem_fence_latency\030\n \001(\001b\006pr"
+  "oto3"
+  ;
+static ::_pbi::once_flag descriptor_table_kvbench_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_kvbench_2eproto = {
+    false, false, 2484, descriptor_table_protodef_kvbench_2eproto,
+    "kvbench.proto",
+    &descriptor_table_kvbench_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_kvbench_2eproto::offsets,
+    file_level_metadata_kvbench_2eproto, file_level_enum_descriptors_kvbench_2eproto,
+    file_level_service_descriptors_kvbench_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_kvbench_2eproto_getter() {
+  return &descriptor_table_kvbench_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_kvbench_2eproto(&descriptor_table_kvbench_2eproto);
 namespace kvbench {
-class StatDefaultTypeInternal {
+
+// ===================================================================
+
+class LatencyHistogram::_Internal {
  public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Stat>
-      _instance;
-} _Stat_default_instance_;
-class StatsDefaultTypeInternal {
+};
+
+LatencyHistogram::LatencyHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.LatencyHistogram)
+}
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyHistogram* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_){from._impl_.index_}
+    , /*decltype(_impl_._index_cached_byte_size_)*/{0}
+    , decltype(_impl_.bucket_count_){from._impl_.bucket_count_}
+    , /*decltype(_impl_._bucket_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.sum_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.sub_bucket_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sub_bucket_bits_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.sub_bucket_bits_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.LatencyHistogram)
+}
+
+inline void LatencyHistogram::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_){arena}
+    , /*decltype(_impl_._index_cached_byte_size_)*/{0}
+    , decltype(_impl_.bucket_count_){arena}
+    , /*decltype(_impl_._bucket_count_cached_byte_size_)*/{0}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.sum_){uint64_t{0u}}
+    , decltype(_impl_.min_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , decltype(_impl_.sub_bucket_bits_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyHistogram::~LatencyHistogram() {
+  // @@protoc_insertion_point(destructor:kvbench.LatencyHistogram)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyHistogram::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.index_.~RepeatedField();
+  _impl_.bucket_count_.~RepeatedField();
+}
+
+void LatencyHistogram::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyHistogram::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.LatencyHistogram)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.index_.Clear();
+  _impl_.bucket_count_.Clear();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sub_bucket_bits_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.sub_bucket_bits_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyHistogram::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 sub_bucket_bits = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sub_bucket_bits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 min = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 index = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_index(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 bucket_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_bucket_count(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_bucket_count(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyHistogram::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.LatencyHistogram)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 sub_bucket_bits = 1;
+  if (this->_internal_sub_bucket_bits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_sub_bucket_bits(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint64 sum = 3;
+  if (this->_internal_sum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sum(), target);
+  }
+
+  // uint64 min = 4;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_min(), target);
+  }
+
+  // uint64 max = 5;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_max(), target);
+  }
+
+  // repeated uint32 index = 6;
+  {
+    int byte_size = _impl_._index_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_index(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 bucket_count = 7;
+  {
+    int byte_size = _impl_._bucket_count_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          7, _internal_bucket_count(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.LatencyHistogram)
+  return target;
+}
+
+size_t LatencyHistogram::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.LatencyHistogram)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 index = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.index_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._index_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 bucket_count = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.bucket_count_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bucket_count_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 sum = 3;
+  if (this->_internal_sum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sum());
+  }
+
+  // uint64 min = 4;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min());
+  }
+
+  // uint64 max = 5;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  // int32 sub_bucket_bits = 1;
+  if (this->_internal_sub_bucket_bits() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sub_bucket_bits());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyHistogram::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyHistogram::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyHistogram::GetClassData() const { return &_class_data_; }
+
+
+void LatencyHistogram::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyHistogram*>(&to_msg);
+  auto& from = static_cast<const LatencyHistogram&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.LatencyHistogram)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.index_.MergeFrom(from._impl_.index_);
+  _this->_impl_.bucket_count_.MergeFrom(from._impl_.bucket_count_);
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_sum() != 0) {
+    _this->_internal_set_sum(from._internal_sum());
+  }
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  if (from._internal_sub_bucket_bits() != 0) {
+    _this->_internal_set_sub_bucket_bits(from._internal_sub_bucket_bits());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyHistogram::CopyFrom(const LatencyHistogram& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.LatencyHistogram)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyHistogram::IsInitialized() const {
+  return true;
+}
+
+void LatencyHistogram::InternalSwap(LatencyHistogram* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.index_.InternalSwap(&other->_impl_.index_);
+  _impl_.bucket_count_.InternalSwap(&other->_impl_.bucket_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyHistogram, _impl_.sub_bucket_bits_)
+      + sizeof(LatencyHistogram::_impl_.sub_bucket_bits_)
+      - PROTOBUF_FIELD_OFFSET(LatencyHistogram, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyHistogram::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[0]);
+}
+
+// ===================================================================
+
+class ResourceStat::_Internal {
  public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Stats>
-      _instance;
-} _Stats_default_instance_;
-}  // namespace kvbench
-namespace protobuf_kvbench_2eproto {
-static void InitDefaultsStat() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+};
+
+ResourceStat::ResourceStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.ResourceStat)
+}
+ResourceStat::ResourceStat(const ResourceStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourceStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_time_){}
+    , decltype(_impl_.sys_time_){}
+    , decltype(_impl_.minor_faults_){}
+    , decltype(_impl_.major_faults_){}
+    , decltype(_impl_.voluntary_switches_){}
+    , decltype(_impl_.involuntary_switches_){}
+    , decltype(_impl_.rss_begin_){}
+    , decltype(_impl_.rss_end_){}
+    , decltype(_impl_.rss_peak_){}
+    , decltype(_impl_.live_keys_){}
+    , decltype(_impl_.bytes_per_key_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.user_time_, &from._impl_.user_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bytes_per_key_) -
+    reinterpret_cast<char*>(&_impl_.user_time_)) + sizeof(_impl_.bytes_per_key_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.ResourceStat)
+}
+
+inline void ResourceStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.user_time_){0}
+    , decltype(_impl_.sys_time_){0}
+    , decltype(_impl_.minor_faults_){uint64_t{0u}}
+    , decltype(_impl_.major_faults_){uint64_t{0u}}
+    , decltype(_impl_.voluntary_switches_){uint64_t{0u}}
+    , decltype(_impl_.involuntary_switches_){uint64_t{0u}}
+    , decltype(_impl_.rss_begin_){uint64_t{0u}}
+    , decltype(_impl_.rss_end_){uint64_t{0u}}
+    , decltype(_impl_.rss_peak_){uint64_t{0u}}
+    , decltype(_impl_.live_keys_){uint64_t{0u}}
+    , decltype(_impl_.bytes_per_key_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResourceStat::~ResourceStat() {
+  // @@protoc_insertion_point(destructor:kvbench.ResourceStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResourceStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ResourceStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResourceStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.ResourceStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.user_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bytes_per_key_) -
+      reinterpret_cast<char*>(&_impl_.user_time_)) + sizeof(_impl_.bytes_per_key_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResourceStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double user_time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.user_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double sys_time = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.sys_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 minor_faults = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.minor_faults_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 major_faults = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.major_faults_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 voluntary_switches = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.voluntary_switches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 involuntary_switches = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.involuntary_switches_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 rss_begin = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.rss_begin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 rss_end = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.rss_end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 rss_peak = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.rss_peak_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 live_keys = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.live_keys_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double bytes_per_key = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _impl_.bytes_per_key_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResourceStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.ResourceStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double user_time = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_user_time = this->_internal_user_time();
+  uint64_t raw_user_time;
+  memcpy(&raw_user_time, &tmp_user_time, sizeof(tmp_user_time));
+  if (raw_user_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_user_time(), target);
+  }
+
+  // double sys_time = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sys_time = this->_internal_sys_time();
+  uint64_t raw_sys_time;
+  memcpy(&raw_sys_time, &tmp_sys_time, sizeof(tmp_sys_time));
+  if (raw_sys_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_sys_time(), target);
+  }
+
+  // uint64 minor_faults = 3;
+  if (this->_internal_minor_faults() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_minor_faults(), target);
+  }
+
+  // uint64 major_faults = 4;
+  if (this->_internal_major_faults() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_major_faults(), target);
+  }
+
+  // uint64 voluntary_switches = 5;
+  if (this->_internal_voluntary_switches() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_voluntary_switches(), target);
+  }
+
+  // uint64 involuntary_switches = 6;
+  if (this->_internal_involuntary_switches() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_involuntary_switches(), target);
+  }
+
+  // uint64 rss_begin = 7;
+  if (this->_internal_rss_begin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_rss_begin(), target);
+  }
+
+  // uint64 rss_end = 8;
+  if (this->_internal_rss_end() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_rss_end(), target);
+  }
+
+  // uint64 rss_peak = 9;
+  if (this->_internal_rss_peak() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_rss_peak(), target);
+  }
+
+  // uint64 live_keys = 10;
+  if (this->_internal_live_keys() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_live_keys(), target);
+  }
+
+  // double bytes_per_key = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_key = this->_internal_bytes_per_key();
+  uint64_t raw_bytes_per_key;
+  memcpy(&raw_bytes_per_key, &tmp_bytes_per_key, sizeof(tmp_bytes_per_key));
+  if (raw_bytes_per_key != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_bytes_per_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.ResourceStat)
+  return target;
+}
+
+size_t ResourceStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.ResourceStat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double user_time = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_user_time = this->_internal_user_time();
+  uint64_t raw_user_time;
+  memcpy(&raw_user_time, &tmp_user_time, sizeof(tmp_user_time));
+  if (raw_user_time != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double sys_time = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sys_time = this->_internal_sys_time();
+  uint64_t raw_sys_time;
+  memcpy(&raw_sys_time, &tmp_sys_time, sizeof(tmp_sys_time));
+  if (raw_sys_time != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 minor_faults = 3;
+  if (this->_internal_minor_faults() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_minor_faults());
+  }
+
+  // uint64 major_faults = 4;
+  if (this->_internal_major_faults() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_major_faults());
+  }
+
+  // uint64 voluntary_switches = 5;
+  if (this->_internal_voluntary_switches() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_voluntary_switches());
+  }
+
+  // uint64 involuntary_switches = 6;
+  if (this->_internal_involuntary_switches() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_involuntary_switches());
+  }
+
+  // uint64 rss_begin = 7;
+  if (this->_internal_rss_begin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_rss_begin());
+  }
+
+  // uint64 rss_end = 8;
+  if (this->_internal_rss_end() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_rss_end());
+  }
+
+  // uint64 rss_peak = 9;
+  if (this->_internal_rss_peak() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_rss_peak());
+  }
+
+  // uint64 live_keys = 10;
+  if (this->_internal_live_keys() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_live_keys());
+  }
+
+  // double bytes_per_key = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_key = this->_internal_bytes_per_key();
+  uint64_t raw_bytes_per_key;
+  memcpy(&raw_bytes_per_key, &tmp_bytes_per_key, sizeof(tmp_bytes_per_key));
+  if (raw_bytes_per_key != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourceStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourceStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourceStat::GetClassData() const { return &_class_data_; }
+
+
+void ResourceStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourceStat*>(&to_msg);
+  auto& from = static_cast<const ResourceStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.ResourceStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_user_time = from._internal_user_time();
+  uint64_t raw_user_time;
+  memcpy(&raw_user_time, &tmp_user_time, sizeof(tmp_user_time));
+  if (raw_user_time != 0) {
+    _this->_internal_set_user_time(from._internal_user_time());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_sys_time = from._internal_sys_time();
+  uint64_t raw_sys_time;
+  memcpy(&raw_sys_time, &tmp_sys_time, sizeof(tmp_sys_time));
+  if (raw_sys_time != 0) {
+    _this->_internal_set_sys_time(from._internal_sys_time());
+  }
+  if (from._internal_minor_faults() != 0) {
+    _this->_internal_set_minor_faults(from._internal_minor_faults());
+  }
+  if (from._internal_major_faults() != 0) {
+    _this->_internal_set_major_faults(from._internal_major_faults());
+  }
+  if (from._internal_voluntary_switches() != 0) {
+    _this->_internal_set_voluntary_switches(from._internal_voluntary_switches());
+  }
+  if (from._internal_involuntary_switches() != 0) {
+    _this->_internal_set_involuntary_switches(from._internal_involuntary_switches());
+  }
+  if (from._internal_rss_begin() != 0) {
+    _this->_internal_set_rss_begin(from._internal_rss_begin());
+  }
+  if (from._internal_rss_end() != 0) {
+    _this->_internal_set_rss_end(from._internal_rss_end());
+  }
+  if (from._internal_rss_peak() != 0) {
+    _this->_internal_set_rss_peak(from._internal_rss_peak());
+  }
+  if (from._internal_live_keys() != 0) {
+    _this->_internal_set_live_keys(from._internal_live_keys());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_key = from._internal_bytes_per_key();
+  uint64_t raw_bytes_per_key;
+  memcpy(&raw_bytes_per_key, &tmp_bytes_per_key, sizeof(tmp_bytes_per_key));
+  if (raw_bytes_per_key != 0) {
+    _this->_internal_set_bytes_per_key(from._internal_bytes_per_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResourceStat::CopyFrom(const ResourceStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.ResourceStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResourceStat::IsInitialized() const {
+  return true;
+}
+
+void ResourceStat::InternalSwap(ResourceStat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResourceStat, _impl_.bytes_per_key_)
+      + sizeof(ResourceStat::_impl_.bytes_per_key_)
+      - PROTOBUF_FIELD_OFFSET(ResourceStat, _impl_.user_time_)>(
+          reinterpret_cast<char*>(&_impl_.user_time_),
+          reinterpret_cast<char*>(&other->_impl_.user_time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResourceStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[1]);
+}
+
+// ===================================================================
+
+class SteadyStat::_Internal {
+ public:
+};
+
+SteadyStat::SteadyStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.SteadyStat)
+}
+SteadyStat::SteadyStat(const SteadyStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SteadyStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.warmup_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.throughput_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.max_latency_){}
+    , decltype(_impl_.p50_latency_){}
+    , decltype(_impl_.p99_latency_){}
+    , decltype(_impl_.p999_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.warmup_, &from._impl_.warmup_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p999_latency_) -
+    reinterpret_cast<char*>(&_impl_.warmup_)) + sizeof(_impl_.p999_latency_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.SteadyStat)
+}
+
+inline void SteadyStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.warmup_){0}
+    , decltype(_impl_.total_){uint64_t{0u}}
+    , decltype(_impl_.throughput_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.max_latency_){0}
+    , decltype(_impl_.p50_latency_){0}
+    , decltype(_impl_.p99_latency_){0}
+    , decltype(_impl_.p999_latency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SteadyStat::~SteadyStat() {
+  // @@protoc_insertion_point(destructor:kvbench.SteadyStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SteadyStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SteadyStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SteadyStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.SteadyStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.warmup_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.p999_latency_) -
+      reinterpret_cast<char*>(&_impl_.warmup_)) + sizeof(_impl_.p999_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SteadyStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double warmup = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.warmup_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double average_latency = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_latency = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.max_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50_latency = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.p50_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99_latency = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.p99_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p999_latency = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.p999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SteadyStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.SteadyStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double warmup = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_warmup = this->_internal_warmup();
+  uint64_t raw_warmup;
+  memcpy(&raw_warmup, &tmp_warmup, sizeof(tmp_warmup));
+  if (raw_warmup != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_warmup(), target);
+  }
+
+  // uint64 total = 2;
+  if (this->_internal_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_total(), target);
+  }
+
+  // double throughput = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_throughput(), target);
+  }
+
+  // double average_latency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_average_latency(), target);
+  }
+
+  // double max_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_max_latency(), target);
+  }
+
+  // double p50_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p50_latency(), target);
+  }
+
+  // double p99_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_p99_latency(), target);
+  }
+
+  // double p999_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p999_latency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.SteadyStat)
+  return target;
+}
+
+size_t SteadyStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.SteadyStat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double warmup = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_warmup = this->_internal_warmup();
+  uint64_t raw_warmup;
+  memcpy(&raw_warmup, &tmp_warmup, sizeof(tmp_warmup));
+  if (raw_warmup != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 total = 2;
+  if (this->_internal_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total());
+  }
+
+  // double throughput = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double average_latency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double max_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p50_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p999_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SteadyStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SteadyStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SteadyStat::GetClassData() const { return &_class_data_; }
+
+
+void SteadyStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SteadyStat*>(&to_msg);
+  auto& from = static_cast<const SteadyStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.SteadyStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_warmup = from._internal_warmup();
+  uint64_t raw_warmup;
+  memcpy(&raw_warmup, &tmp_warmup, sizeof(tmp_warmup));
+  if (raw_warmup != 0) {
+    _this->_internal_set_warmup(from._internal_warmup());
+  }
+  if (from._internal_total() != 0) {
+    _this->_internal_set_total(from._internal_total());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = from._internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    _this->_internal_set_max_latency(from._internal_max_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = from._internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    _this->_internal_set_p50_latency(from._internal_p50_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = from._internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    _this->_internal_set_p99_latency(from._internal_p99_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = from._internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    _this->_internal_set_p999_latency(from._internal_p999_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SteadyStat::CopyFrom(const SteadyStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.SteadyStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SteadyStat::IsInitialized() const {
+  return true;
+}
+
+void SteadyStat::InternalSwap(SteadyStat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SteadyStat, _impl_.p999_latency_)
+      + sizeof(SteadyStat::_impl_.p999_latency_)
+      - PROTOBUF_FIELD_OFFSET(SteadyStat, _impl_.warmup_)>(
+          reinterpret_cast<char*>(&_impl_.warmup_),
+          reinterpret_cast<char*>(&other->_impl_.warmup_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SteadyStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[2]);
+}
+
+// ===================================================================
+
+class TimelinePoint::_Internal {
+ public:
+};
+
+TimelinePoint::TimelinePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.TimelinePoint)
+}
+TimelinePoint::TimelinePoint(const TimelinePoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TimelinePoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){}
+    , decltype(_impl_.throughput_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.ops_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.time_, &from._impl_.time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ops_) -
+    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.ops_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.TimelinePoint)
+}
+
+inline void TimelinePoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_){0}
+    , decltype(_impl_.throughput_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.ops_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimelinePoint::~TimelinePoint() {
+  // @@protoc_insertion_point(destructor:kvbench.TimelinePoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TimelinePoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TimelinePoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TimelinePoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.TimelinePoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ops_) -
+      reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.ops_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TimelinePoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double average_latency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ops = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ops_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TimelinePoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.TimelinePoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double time = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = this->_internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_time(), target);
+  }
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_throughput(), target);
+  }
+
+  // double average_latency = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_average_latency(), target);
+  }
+
+  // uint64 ops = 4;
+  if (this->_internal_ops() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_ops(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.TimelinePoint)
+  return target;
+}
+
+size_t TimelinePoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.TimelinePoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double time = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = this->_internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double average_latency = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 ops = 4;
+  if (this->_internal_ops() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ops());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimelinePoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimelinePoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimelinePoint::GetClassData() const { return &_class_data_; }
+
+
+void TimelinePoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimelinePoint*>(&to_msg);
+  auto& from = static_cast<const TimelinePoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.TimelinePoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = from._internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
+  }
+  if (from._internal_ops() != 0) {
+    _this->_internal_set_ops(from._internal_ops());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TimelinePoint::CopyFrom(const TimelinePoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.TimelinePoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimelinePoint::IsInitialized() const {
+  return true;
+}
+
+void TimelinePoint::InternalSwap(TimelinePoint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TimelinePoint, _impl_.ops_)
+      + sizeof(TimelinePoint::_impl_.ops_)
+      - PROTOBUF_FIELD_OFFSET(TimelinePoint, _impl_.time_)>(
+          reinterpret_cast<char*>(&_impl_.time_),
+          reinterpret_cast<char*>(&other->_impl_.time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TimelinePoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[3]);
+}
+
+// ===================================================================
+
+class OpStat::_Internal {
+ public:
+  static const ::kvbench::LatencyHistogram& histogram(const OpStat* msg);
+};
+
+const ::kvbench::LatencyHistogram&
+OpStat::_Internal::histogram(const OpStat* msg) {
+  return *msg->_impl_.histogram_;
+}
+OpStat::OpStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.OpStat)
+}
+OpStat::OpStat(const OpStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OpStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.histogram_){nullptr}
+    , decltype(_impl_.ratio_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.throughput_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.max_latency_){}
+    , decltype(_impl_.p50_latency_){}
+    , decltype(_impl_.p99_latency_){}
+    , decltype(_impl_.p999_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_op().empty()) {
+    _this->_impl_.op_.Set(from._internal_op(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_histogram()) {
+    _this->_impl_.histogram_ = new ::kvbench::LatencyHistogram(*from._impl_.histogram_);
+  }
+  ::memcpy(&_impl_.ratio_, &from._impl_.ratio_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p999_latency_) -
+    reinterpret_cast<char*>(&_impl_.ratio_)) + sizeof(_impl_.p999_latency_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.OpStat)
+}
+
+inline void OpStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , decltype(_impl_.histogram_){nullptr}
+    , decltype(_impl_.ratio_){0}
+    , decltype(_impl_.total_){uint64_t{0u}}
+    , decltype(_impl_.throughput_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.max_latency_){0}
+    , decltype(_impl_.p50_latency_){0}
+    , decltype(_impl_.p99_latency_){0}
+    , decltype(_impl_.p999_latency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.op_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.op_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OpStat::~OpStat() {
+  // @@protoc_insertion_point(destructor:kvbench.OpStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OpStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.op_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.histogram_;
+}
+
+void OpStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OpStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.OpStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.op_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.histogram_ != nullptr) {
+    delete _impl_.histogram_;
+  }
+  _impl_.histogram_ = nullptr;
+  ::memset(&_impl_.ratio_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.p999_latency_) -
+      reinterpret_cast<char*>(&_impl_.ratio_)) + sizeof(_impl_.p999_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OpStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string op = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_op();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.OpStat.op"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double ratio = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double average_latency = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_latency = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.max_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50_latency = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.p50_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99_latency = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.p99_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p999_latency = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.p999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.LatencyHistogram histogram = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OpStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.OpStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (!this->_internal_op().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_op().data(), static_cast<int>(this->_internal_op().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.OpStat.op");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_op(), target);
+  }
+
+  // double ratio = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ratio = this->_internal_ratio();
+  uint64_t raw_ratio;
+  memcpy(&raw_ratio, &tmp_ratio, sizeof(tmp_ratio));
+  if (raw_ratio != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_ratio(), target);
+  }
+
+  // uint64 total = 3;
+  if (this->_internal_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_total(), target);
+  }
+
+  // double throughput = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_throughput(), target);
+  }
+
+  // double average_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_average_latency(), target);
+  }
+
+  // double max_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_max_latency(), target);
+  }
+
+  // double p50_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_p50_latency(), target);
+  }
+
+  // double p99_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p99_latency(), target);
+  }
+
+  // double p999_latency = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_p999_latency(), target);
+  }
+
+  // .kvbench.LatencyHistogram histogram = 10;
+  if (this->_internal_has_histogram()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::histogram(this),
+        _Internal::histogram(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.OpStat)
+  return target;
+}
+
+size_t OpStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.OpStat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string op = 1;
+  if (!this->_internal_op().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_op());
+  }
+
+  // .kvbench.LatencyHistogram histogram = 10;
+  if (this->_internal_has_histogram()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.histogram_);
+  }
+
+  // double ratio = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ratio = this->_internal_ratio();
+  uint64_t raw_ratio;
+  memcpy(&raw_ratio, &tmp_ratio, sizeof(tmp_ratio));
+  if (raw_ratio != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 total = 3;
+  if (this->_internal_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total());
+  }
+
+  // double throughput = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double average_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double max_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p50_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p999_latency = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OpStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OpStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OpStat::GetClassData() const { return &_class_data_; }
+
+
+void OpStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OpStat*>(&to_msg);
+  auto& from = static_cast<const OpStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.OpStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_op().empty()) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  if (from._internal_has_histogram()) {
+    _this->_internal_mutable_histogram()->::kvbench::LatencyHistogram::MergeFrom(
+        from._internal_histogram());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ratio = from._internal_ratio();
+  uint64_t raw_ratio;
+  memcpy(&raw_ratio, &tmp_ratio, sizeof(tmp_ratio));
+  if (raw_ratio != 0) {
+    _this->_internal_set_ratio(from._internal_ratio());
+  }
+  if (from._internal_total() != 0) {
+    _this->_internal_set_total(from._internal_total());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = from._internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    _this->_internal_set_max_latency(from._internal_max_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = from._internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    _this->_internal_set_p50_latency(from._internal_p50_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = from._internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    _this->_internal_set_p99_latency(from._internal_p99_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = from._internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    _this->_internal_set_p999_latency(from._internal_p999_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OpStat::CopyFrom(const OpStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.OpStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OpStat::IsInitialized() const {
+  return true;
+}
+
+void OpStat::InternalSwap(OpStat* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.op_, lhs_arena,
+      &other->_impl_.op_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OpStat, _impl_.p999_latency_)
+      + sizeof(OpStat::_impl_.p999_latency_)
+      - PROTOBUF_FIELD_OFFSET(OpStat, _impl_.histogram_)>(
+          reinterpret_cast<char*>(&_impl_.histogram_),
+          reinterpret_cast<char*>(&other->_impl_.histogram_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OpStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[4]);
+}
+
+// ===================================================================
+
+class RatePoint::_Internal {
+ public:
+};
+
+RatePoint::RatePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.RatePoint)
+}
+RatePoint::RatePoint(const RatePoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RatePoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offered_rate_){}
+    , decltype(_impl_.throughput_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.max_latency_){}
+    , decltype(_impl_.p50_latency_){}
+    , decltype(_impl_.p99_latency_){}
+    , decltype(_impl_.p999_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offered_rate_, &from._impl_.offered_rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p999_latency_) -
+    reinterpret_cast<char*>(&_impl_.offered_rate_)) + sizeof(_impl_.p999_latency_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.RatePoint)
+}
+
+inline void RatePoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offered_rate_){0}
+    , decltype(_impl_.throughput_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.max_latency_){0}
+    , decltype(_impl_.p50_latency_){0}
+    , decltype(_impl_.p99_latency_){0}
+    , decltype(_impl_.p999_latency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RatePoint::~RatePoint() {
+  // @@protoc_insertion_point(destructor:kvbench.RatePoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RatePoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RatePoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RatePoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.RatePoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.offered_rate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.p999_latency_) -
+      reinterpret_cast<char*>(&_impl_.offered_rate_)) + sizeof(_impl_.p999_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RatePoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double offered_rate = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.offered_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double average_latency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_latency = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.max_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50_latency = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.p50_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99_latency = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.p99_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p999_latency = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.p999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RatePoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.RatePoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double offered_rate = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = this->_internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_offered_rate(), target);
+  }
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_throughput(), target);
+  }
+
+  // double average_latency = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_average_latency(), target);
+  }
+
+  // double max_latency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_max_latency(), target);
+  }
+
+  // double p50_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_p50_latency(), target);
+  }
+
+  // double p99_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p99_latency(), target);
+  }
+
+  // double p999_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_p999_latency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.RatePoint)
+  return target;
+}
+
+size_t RatePoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.RatePoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double offered_rate = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = this->_internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double average_latency = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double max_latency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    total_size += 1 + 8;
+  }
 
-  {
-    void* ptr = &::kvbench::_Stat_default_instance_;
-    new (ptr) ::kvbench::Stat();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+  // double p50_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p999_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    total_size += 1 + 8;
   }
-  ::kvbench::Stat::InitAsDefaultInstance();
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-::google::protobuf::internal::SCCInfo<0> scc_info_Stat =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsStat}, {}};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RatePoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RatePoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RatePoint::GetClassData() const { return &_class_data_; }
 
-static void InitDefaultsStats() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::kvbench::_Stats_default_instance_;
-    new (ptr) ::kvbench::Stats();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
+void RatePoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RatePoint*>(&to_msg);
+  auto& from = static_cast<const RatePoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.RatePoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = from._internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    _this->_internal_set_offered_rate(from._internal_offered_rate());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
   }
-  ::kvbench::Stats::InitAsDefaultInstance();
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = from._internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    _this->_internal_set_max_latency(from._internal_max_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = from._internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    _this->_internal_set_p50_latency(from._internal_p50_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = from._internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    _this->_internal_set_p99_latency(from._internal_p99_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = from._internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    _this->_internal_set_p999_latency(from._internal_p999_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-::google::protobuf::internal::SCCInfo<1> scc_info_Stats =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsStats}, {
-      &protobuf_kvbench_2eproto::scc_info_Stat.base,}};
+void RatePoint::CopyFrom(const RatePoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.RatePoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_Stat.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Stats.base);
+bool RatePoint::IsInitialized() const {
+  return true;
 }
 
-::google::protobuf::Metadata file_level_metadata[2];
+void RatePoint::InternalSwap(RatePoint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RatePoint, _impl_.p999_latency_)
+      + sizeof(RatePoint::_impl_.p999_latency_)
+      - PROTOBUF_FIELD_OFFSET(RatePoint, _impl_.offered_rate_)>(
+          reinterpret_cast<char*>(&_impl_.offered_rate_),
+          reinterpret_cast<char*>(&other->_impl_.offered_rate_));
+}
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, duration_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, average_latency_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, max_latency_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, throughput_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, latency_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, failed_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stat, total_),
-  ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stats, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::kvbench::Stats, stat_),
-};
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::kvbench::Stat)},
-  { 12, -1, sizeof(::kvbench::Stats)},
-};
+::PROTOBUF_NAMESPACE_ID::Metadata RatePoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[5]);
+}
+
+// ===================================================================
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kvbench::_Stat_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::kvbench::_Stats_default_instance_),
+class ThreadPoint::_Internal {
+ public:
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "kvbench.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
+ThreadPoint::ThreadPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.ThreadPoint)
 }
+ThreadPoint::ThreadPoint(const ThreadPoint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ThreadPoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.throughput_){}
+    , decltype(_impl_.speedup_){}
+    , decltype(_impl_.efficiency_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.p50_latency_){}
+    , decltype(_impl_.p99_latency_){}
+    , decltype(_impl_.p999_latency_){}
+    , decltype(_impl_.threads_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.throughput_, &from._impl_.throughput_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.threads_) -
+    reinterpret_cast<char*>(&_impl_.throughput_)) + sizeof(_impl_.threads_));
+  // @@protoc_insertion_point(copy_constructor:kvbench.ThreadPoint)
 }
 
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 2);
+inline void ThreadPoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.throughput_){0}
+    , decltype(_impl_.speedup_){0}
+    , decltype(_impl_.efficiency_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.p50_latency_){0}
+    , decltype(_impl_.p99_latency_){0}
+    , decltype(_impl_.p999_latency_){0}
+    , decltype(_impl_.threads_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\rkvbench.proto\022\007kvbench\"\212\001\n\004Stat\022\020\n\010dur"
-      "ation\030\001 \001(\001\022\027\n\017average_latency\030\002 \001(\001\022\023\n\013"
-      "max_latency\030\003 \001(\001\022\022\n\nthroughput\030\004 \001(\001\022\017\n"
-      "\007latency\030\005 \003(\001\022\016\n\006failed\030\006 \001(\005\022\r\n\005total\030"
-      "\007 \001(\005\"$\n\005Stats\022\033\n\004stat\030\001 \003(\0132\r.kvbench.S"
-      "tatb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 211);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "kvbench.proto", &protobuf_RegisterTypes);
+ThreadPoint::~ThreadPoint() {
+  // @@protoc_insertion_point(destructor:kvbench.ThreadPoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ThreadPoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ThreadPoint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ThreadPoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:kvbench.ThreadPoint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.throughput_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.threads_) -
+      reinterpret_cast<char*>(&_impl_.throughput_)) + sizeof(_impl_.threads_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ThreadPoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 threads = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double speedup = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.speedup_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double efficiency = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.efficiency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double average_latency = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50_latency = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.p50_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99_latency = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.p99_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p999_latency = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.p999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
+uint8_t* ThreadPoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.ThreadPoint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 threads = 1;
+  if (this->_internal_threads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_threads(), target);
+  }
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_throughput(), target);
+  }
+
+  // double speedup = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_speedup = this->_internal_speedup();
+  uint64_t raw_speedup;
+  memcpy(&raw_speedup, &tmp_speedup, sizeof(tmp_speedup));
+  if (raw_speedup != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_speedup(), target);
+  }
+
+  // double efficiency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_efficiency = this->_internal_efficiency();
+  uint64_t raw_efficiency;
+  memcpy(&raw_efficiency, &tmp_efficiency, sizeof(tmp_efficiency));
+  if (raw_efficiency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_efficiency(), target);
+  }
+
+  // double average_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_average_latency(), target);
+  }
+
+  // double p50_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p50_latency(), target);
+  }
+
+  // double p99_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_p99_latency(), target);
+  }
+
+  // double p999_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p999_latency(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kvbench.ThreadPoint)
+  return target;
 }
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
+
+size_t ThreadPoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kvbench.ThreadPoint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double throughput = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
   }
-} static_descriptor_initializer;
-}  // namespace protobuf_kvbench_2eproto
-namespace kvbench {
+
+  // double speedup = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_speedup = this->_internal_speedup();
+  uint64_t raw_speedup;
+  memcpy(&raw_speedup, &tmp_speedup, sizeof(tmp_speedup));
+  if (raw_speedup != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double efficiency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_efficiency = this->_internal_efficiency();
+  uint64_t raw_efficiency;
+  memcpy(&raw_efficiency, &tmp_efficiency, sizeof(tmp_efficiency));
+  if (raw_efficiency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double average_latency = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p50_latency = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99_latency = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p999_latency = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 threads = 1;
+  if (this->_internal_threads() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_threads());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ThreadPoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ThreadPoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ThreadPoint::GetClassData() const { return &_class_data_; }
+
+
+void ThreadPoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ThreadPoint*>(&to_msg);
+  auto& from = static_cast<const ThreadPoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.ThreadPoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_speedup = from._internal_speedup();
+  uint64_t raw_speedup;
+  memcpy(&raw_speedup, &tmp_speedup, sizeof(tmp_speedup));
+  if (raw_speedup != 0) {
+    _this->_internal_set_speedup(from._internal_speedup());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_efficiency = from._internal_efficiency();
+  uint64_t raw_efficiency;
+  memcpy(&raw_efficiency, &tmp_efficiency, sizeof(tmp_efficiency));
+  if (raw_efficiency != 0) {
+    _this->_internal_set_efficiency(from._internal_efficiency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = from._internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    _this->_internal_set_p50_latency(from._internal_p50_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = from._internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    _this->_internal_set_p99_latency(from._internal_p99_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = from._internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    _this->_internal_set_p999_latency(from._internal_p999_latency());
+  }
+  if (from._internal_threads() != 0) {
+    _this->_internal_set_threads(from._internal_threads());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ThreadPoint::CopyFrom(const ThreadPoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kvbench.ThreadPoint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ThreadPoint::IsInitialized() const {
+  return true;
+}
+
+void ThreadPoint::InternalSwap(ThreadPoint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ThreadPoint, _impl_.threads_)
+      + sizeof(ThreadPoint::_impl_.threads_)
+      - PROTOBUF_FIELD_OFFSET(ThreadPoint, _impl_.throughput_)>(
+          reinterpret_cast<char*>(&_impl_.throughput_),
+          reinterpret_cast<char*>(&other->_impl_.throughput_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ThreadPoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[6]);
+}
 
 // ===================================================================
 
-void Stat::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Stat::kDurationFieldNumber;
-const int Stat::kAverageLatencyFieldNumber;
-const int Stat::kMaxLatencyFieldNumber;
-const int Stat::kThroughputFieldNumber;
-const int Stat::kLatencyFieldNumber;
-const int Stat::kFailedFieldNumber;
-const int Stat::kTotalFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Stat::Stat()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_kvbench_2eproto::scc_info_Stat.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kvbench.Stat)
+class Stat::_Internal {
+ public:
+  static const ::kvbench::LatencyHistogram& histogram(const Stat* msg);
+  static const ::kvbench::LatencyHistogram& batch_histogram(const Stat* msg);
+  static const ::kvbench::SteadyStat& steady(const Stat* msg);
+  static const ::kvbench::ResourceStat& resource(const Stat* msg);
+  static const ::kvbench::LatencyHistogram& key_histogram(const Stat* msg);
+};
+
+const ::kvbench::LatencyHistogram&
+Stat::_Internal::histogram(const Stat* msg) {
+  return *msg->_impl_.histogram_;
+}
+const ::kvbench::LatencyHistogram&
+Stat::_Internal::batch_histogram(const Stat* msg) {
+  return *msg->_impl_.batch_histogram_;
+}
+const ::kvbench::SteadyStat&
+Stat::_Internal::steady(const Stat* msg) {
+  return *msg->_impl_.steady_;
+}
+const ::kvbench::ResourceStat&
+Stat::_Internal::resource(const Stat* msg) {
+  return *msg->_impl_.resource_;
+}
+const ::kvbench::LatencyHistogram&
+Stat::_Internal::key_histogram(const Stat* msg) {
+  return *msg->_impl_.key_histogram_;
+}
+Stat::Stat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.Stat)
 }
 Stat::Stat(const Stat& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      latency_(from.latency_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&duration_, &from.duration_,
-    static_cast<size_t>(reinterpret_cast<char*>(&total_) -
-    reinterpret_cast<char*>(&duration_)) + sizeof(total_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_){from._impl_.latency_}
+    , decltype(_impl_.cpu_){from._impl_.cpu_}
+    , /*decltype(_impl_._cpu_cached_byte_size_)*/{0}
+    , decltype(_impl_.timeline_){from._impl_.timeline_}
+    , decltype(_impl_.op_stat_){from._impl_.op_stat_}
+    , decltype(_impl_.rate_curve_){from._impl_.rate_curve_}
+    , decltype(_impl_.thread_curve_){from._impl_.thread_curve_}
+    , decltype(_impl_.mix_){}
+    , decltype(_impl_.arrival_){}
+    , decltype(_impl_.key_size_){}
+    , decltype(_impl_.value_size_){}
+    , decltype(_impl_.histogram_){nullptr}
+    , decltype(_impl_.batch_histogram_){nullptr}
+    , decltype(_impl_.steady_){nullptr}
+    , decltype(_impl_.resource_){nullptr}
+    , decltype(_impl_.key_histogram_){nullptr}
+    , decltype(_impl_.duration_){}
+    , decltype(_impl_.average_latency_){}
+    , decltype(_impl_.max_latency_){}
+    , decltype(_impl_.throughput_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.buffer_bytes_){}
+    , decltype(_impl_.p50_latency_){}
+    , decltype(_impl_.p90_latency_){}
+    , decltype(_impl_.p99_latency_){}
+    , decltype(_impl_.p999_latency_){}
+    , decltype(_impl_.p9999_latency_){}
+    , decltype(_impl_.latency_batch_){}
+    , decltype(_impl_.failed_){}
+    , decltype(_impl_.threads_){}
+    , decltype(_impl_.offered_rate_){}
+    , decltype(_impl_.scan_items_){}
+    , decltype(_impl_.scan_item_throughput_){}
+    , decltype(_impl_.batch_){}
+    , decltype(_impl_.interleave_){}
+    , decltype(_impl_.phase_end_duration_){}
+    , decltype(_impl_.pmem_flushes_){}
+    , decltype(_impl_.pmem_fences_){}
+    , decltype(_impl_.key_average_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.mix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mix().empty()) {
+    _this->_impl_.mix_.Set(from._internal_mix(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.arrival_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arrival_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_arrival().empty()) {
+    _this->_impl_.arrival_.Set(from._internal_arrival(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_size_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_size_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key_size().empty()) {
+    _this->_impl_.key_size_.Set(from._internal_key_size(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_size_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_size_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value_size().empty()) {
+    _this->_impl_.value_size_.Set(from._internal_value_size(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_histogram()) {
+    _this->_impl_.histogram_ = new ::kvbench::LatencyHistogram(*from._impl_.histogram_);
+  }
+  if (from._internal_has_batch_histogram()) {
+    _this->_impl_.batch_histogram_ = new ::kvbench::LatencyHistogram(*from._impl_.batch_histogram_);
+  }
+  if (from._internal_has_steady()) {
+    _this->_impl_.steady_ = new ::kvbench::SteadyStat(*from._impl_.steady_);
+  }
+  if (from._internal_has_resource()) {
+    _this->_impl_.resource_ = new ::kvbench::ResourceStat(*from._impl_.resource_);
+  }
+  if (from._internal_has_key_histogram()) {
+    _this->_impl_.key_histogram_ = new ::kvbench::LatencyHistogram(*from._impl_.key_histogram_);
+  }
+  ::memcpy(&_impl_.duration_, &from._impl_.duration_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.key_average_latency_) -
+    reinterpret_cast<char*>(&_impl_.duration_)) + sizeof(_impl_.key_average_latency_));
   // @@protoc_insertion_point(copy_constructor:kvbench.Stat)
 }
 
-void Stat::SharedCtor() {
-  ::memset(&duration_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&total_) -
-      reinterpret_cast<char*>(&duration_)) + sizeof(total_));
+inline void Stat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_){arena}
+    , decltype(_impl_.cpu_){arena}
+    , /*decltype(_impl_._cpu_cached_byte_size_)*/{0}
+    , decltype(_impl_.timeline_){arena}
+    , decltype(_impl_.op_stat_){arena}
+    , decltype(_impl_.rate_curve_){arena}
+    , decltype(_impl_.thread_curve_){arena}
+    , decltype(_impl_.mix_){}
+    , decltype(_impl_.arrival_){}
+    , decltype(_impl_.key_size_){}
+    , decltype(_impl_.value_size_){}
+    , decltype(_impl_.histogram_){nullptr}
+    , decltype(_impl_.batch_histogram_){nullptr}
+    , decltype(_impl_.steady_){nullptr}
+    , decltype(_impl_.resource_){nullptr}
+    , decltype(_impl_.key_histogram_){nullptr}
+    , decltype(_impl_.duration_){0}
+    , decltype(_impl_.average_latency_){0}
+    , decltype(_impl_.max_latency_){0}
+    , decltype(_impl_.throughput_){0}
+    , decltype(_impl_.total_){int64_t{0}}
+    , decltype(_impl_.buffer_bytes_){uint64_t{0u}}
+    , decltype(_impl_.p50_latency_){0}
+    , decltype(_impl_.p90_latency_){0}
+    , decltype(_impl_.p99_latency_){0}
+    , decltype(_impl_.p999_latency_){0}
+    , decltype(_impl_.p9999_latency_){0}
+    , decltype(_impl_.latency_batch_){uint64_t{0u}}
+    , decltype(_impl_.failed_){0}
+    , decltype(_impl_.threads_){0}
+    , decltype(_impl_.offered_rate_){0}
+    , decltype(_impl_.scan_items_){uint64_t{0u}}
+    , decltype(_impl_.scan_item_throughput_){0}
+    , decltype(_impl_.batch_){uint64_t{0u}}
+    , decltype(_impl_.interleave_){uint64_t{0u}}
+    , decltype(_impl_.phase_end_duration_){0}
+    , decltype(_impl_.pmem_flushes_){uint64_t{0u}}
+    , decltype(_impl_.pmem_fences_){uint64_t{0u}}
+    , decltype(_impl_.key_average_latency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.mix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.arrival_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arrival_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_size_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_size_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_size_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_size_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Stat::~Stat() {
   // @@protoc_insertion_point(destructor:kvbench.Stat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Stat::SharedDtor() {
+inline void Stat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.latency_.~RepeatedField();
+  _impl_.cpu_.~RepeatedField();
+  _impl_.timeline_.~RepeatedPtrField();
+  _impl_.op_stat_.~RepeatedPtrField();
+  _impl_.rate_curve_.~RepeatedPtrField();
+  _impl_.thread_curve_.~RepeatedPtrField();
+  _impl_.mix_.Destroy();
+  _impl_.arrival_.Destroy();
+  _impl_.key_size_.Destroy();
+  _impl_.value_size_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.histogram_;
+  if (this != internal_default_instance()) delete _impl_.batch_histogram_;
+  if (this != internal_default_instance()) delete _impl_.steady_;
+  if (this != internal_default_instance()) delete _impl_.resource_;
+  if (this != internal_default_instance()) delete _impl_.key_histogram_;
 }
 
 void Stat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Stat::descriptor() {
-  ::protobuf_kvbench_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_kvbench_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Stat& Stat::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_kvbench_2eproto::scc_info_Stat.base);
-  return *internal_default_instance();
-}
-
 
 void Stat::Clear() {
 // @@protoc_insertion_point(message_clear_start:kvbench.Stat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  latency_.Clear();
-  ::memset(&duration_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&total_) -
-      reinterpret_cast<char*>(&duration_)) + sizeof(total_));
-  _internal_metadata_.Clear();
+  _impl_.latency_.Clear();
+  _impl_.cpu_.Clear();
+  _impl_.timeline_.Clear();
+  _impl_.op_stat_.Clear();
+  _impl_.rate_curve_.Clear();
+  _impl_.thread_curve_.Clear();
+  _impl_.mix_.ClearToEmpty();
+  _impl_.arrival_.ClearToEmpty();
+  _impl_.key_size_.ClearToEmpty();
+  _impl_.value_size_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.histogram_ != nullptr) {
+    delete _impl_.histogram_;
+  }
+  _impl_.histogram_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.batch_histogram_ != nullptr) {
+    delete _impl_.batch_histogram_;
+  }
+  _impl_.batch_histogram_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.steady_ != nullptr) {
+    delete _impl_.steady_;
+  }
+  _impl_.steady_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.resource_ != nullptr) {
+    delete _impl_.resource_;
+  }
+  _impl_.resource_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.key_histogram_ != nullptr) {
+    delete _impl_.key_histogram_;
+  }
+  _impl_.key_histogram_ = nullptr;
+  ::memset(&_impl_.duration_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.key_average_latency_) -
+      reinterpret_cast<char*>(&_impl_.duration_)) + sizeof(_impl_.key_average_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Stat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kvbench.Stat)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Stat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // double duration = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(9u /* 9 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &duration_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double average_latency = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(17u /* 17 & 0xFF */)) {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_latency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.max_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double throughput = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double latency = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_latency(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 41) {
+          _internal_add_latency(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 failed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 total = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 buffer_bytes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.buffer_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.LatencyHistogram histogram = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p50_latency = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _impl_.p50_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p90_latency = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _impl_.p90_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p99_latency = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _impl_.p99_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p999_latency = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _impl_.p999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p9999_latency = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _impl_.p9999_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 latency_batch = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.latency_batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.LatencyHistogram batch_histogram = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 cpu = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_cpu(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 136) {
+          _internal_add_cpu(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.SteadyStat steady = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_steady(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvbench.TimelinePoint timeline = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_timeline(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<154>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string mix = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          auto str = _internal_mutable_mix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stat.mix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvbench.OpStat op_stat = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_op_stat(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<170>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // double offered_rate = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 177)) {
+          _impl_.offered_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string arrival = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          auto str = _internal_mutable_arrival();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stat.arrival"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvbench.RatePoint rate_curve = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_rate_curve(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<194>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 scan_items = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          _impl_.scan_items_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double scan_item_throughput = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 209)) {
+          _impl_.scan_item_throughput_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 batch = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
+          _impl_.batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 interleave = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 224)) {
+          _impl_.interleave_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string key_size = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 234)) {
+          auto str = _internal_mutable_key_size();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stat.key_size"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string value_size = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          auto str = _internal_mutable_value_size();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stat.value_size"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 threads = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 248)) {
+          _impl_.threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kvbench.ThreadPoint thread_curve = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_thread_curve(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<258>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // double phase_end_duration = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.phase_end_duration_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 pmem_flushes = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.pmem_flushes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 pmem_fences = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.pmem_fences_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.ResourceStat resource = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resource(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double key_average_latency = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.key_average_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kvbench.LatencyHistogram key_histogram = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_histogram(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Stat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.Stat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double duration = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_duration = this->_internal_duration();
+  uint64_t raw_duration;
+  memcpy(&raw_duration, &tmp_duration, sizeof(tmp_duration));
+  if (raw_duration != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_duration(), target);
+  }
+
+  // double average_latency = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_average_latency(), target);
+  }
+
+  // double max_latency = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_max_latency(), target);
+  }
+
+  // double throughput = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_throughput(), target);
+  }
+
+  // repeated double latency = 5;
+  if (this->_internal_latency_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_latency(), target);
+  }
+
+  // int32 failed = 6;
+  if (this->_internal_failed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_failed(), target);
+  }
+
+  // int64 total = 7;
+  if (this->_internal_total() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_total(), target);
+  }
+
+  // uint64 buffer_bytes = 8;
+  if (this->_internal_buffer_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_buffer_bytes(), target);
+  }
+
+  // .kvbench.LatencyHistogram histogram = 9;
+  if (this->_internal_has_histogram()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::histogram(this),
+        _Internal::histogram(this).GetCachedSize(), target, stream);
+  }
+
+  // double p50_latency = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_p50_latency(), target);
+  }
+
+  // double p90_latency = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90_latency = this->_internal_p90_latency();
+  uint64_t raw_p90_latency;
+  memcpy(&raw_p90_latency, &tmp_p90_latency, sizeof(tmp_p90_latency));
+  if (raw_p90_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_p90_latency(), target);
+  }
+
+  // double p99_latency = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_p99_latency(), target);
+  }
+
+  // double p999_latency = 13;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_p999_latency(), target);
+  }
+
+  // double p9999_latency = 14;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p9999_latency = this->_internal_p9999_latency();
+  uint64_t raw_p9999_latency;
+  memcpy(&raw_p9999_latency, &tmp_p9999_latency, sizeof(tmp_p9999_latency));
+  if (raw_p9999_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(14, this->_internal_p9999_latency(), target);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &average_latency_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // uint64 latency_batch = 15;
+  if (this->_internal_latency_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_latency_batch(), target);
+  }
 
-      // double max_latency = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(25u /* 25 & 0xFF */)) {
+  // .kvbench.LatencyHistogram batch_histogram = 16;
+  if (this->_internal_has_batch_histogram()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::batch_histogram(this),
+        _Internal::batch_histogram(this).GetCachedSize(), target, stream);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &max_latency_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated int32 cpu = 17;
+  {
+    int byte_size = _impl_._cpu_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          17, _internal_cpu(), byte_size, target);
+    }
+  }
 
-      // double throughput = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(33u /* 33 & 0xFF */)) {
+  // .kvbench.SteadyStat steady = 18;
+  if (this->_internal_has_steady()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::steady(this),
+        _Internal::steady(this).GetCachedSize(), target, stream);
+  }
 
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &throughput_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated .kvbench.TimelinePoint timeline = 19;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_timeline_size()); i < n; i++) {
+    const auto& repfield = this->_internal_timeline(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(19, repfield, repfield.GetCachedSize(), target, stream);
+  }
 
-      // repeated double latency = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, this->mutable_latency())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(41u /* 41 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 1, 42u, input, this->mutable_latency())));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // string mix = 20;
+  if (!this->_internal_mix().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mix().data(), static_cast<int>(this->_internal_mix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stat.mix");
+    target = stream->WriteStringMaybeAliased(
+        20, this->_internal_mix(), target);
+  }
 
-      // int32 failed = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &failed_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 total = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(56u /* 56 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &total_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // repeated .kvbench.OpStat op_stat = 21;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_op_stat_size()); i < n; i++) {
+    const auto& repfield = this->_internal_op_stat(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(21, repfield, repfield.GetCachedSize(), target, stream);
   }
-success:
-  // @@protoc_insertion_point(parse_success:kvbench.Stat)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:kvbench.Stat)
-  return false;
-#undef DO_
-}
 
-void Stat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kvbench.Stat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // double offered_rate = 22;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = this->_internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(22, this->_internal_offered_rate(), target);
+  }
 
-  // double duration = 1;
-  if (this->duration() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(1, this->duration(), output);
+  // string arrival = 23;
+  if (!this->_internal_arrival().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_arrival().data(), static_cast<int>(this->_internal_arrival().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stat.arrival");
+    target = stream->WriteStringMaybeAliased(
+        23, this->_internal_arrival(), target);
   }
 
-  // double average_latency = 2;
-  if (this->average_latency() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->average_latency(), output);
+  // repeated .kvbench.RatePoint rate_curve = 24;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rate_curve_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rate_curve(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(24, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // double max_latency = 3;
-  if (this->max_latency() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(3, this->max_latency(), output);
+  // uint64 scan_items = 25;
+  if (this->_internal_scan_items() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(25, this->_internal_scan_items(), target);
   }
 
-  // double throughput = 4;
-  if (this->throughput() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(4, this->throughput(), output);
+  // double scan_item_throughput = 26;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scan_item_throughput = this->_internal_scan_item_throughput();
+  uint64_t raw_scan_item_throughput;
+  memcpy(&raw_scan_item_throughput, &tmp_scan_item_throughput, sizeof(tmp_scan_item_throughput));
+  if (raw_scan_item_throughput != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(26, this->_internal_scan_item_throughput(), target);
   }
 
-  // repeated double latency = 5;
-  if (this->latency_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(5, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _latency_cached_byte_size_));
-    ::google::protobuf::internal::WireFormatLite::WriteDoubleArray(
-      this->latency().data(), this->latency_size(), output);
+  // uint64 batch = 27;
+  if (this->_internal_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(27, this->_internal_batch(), target);
   }
 
-  // int32 failed = 6;
-  if (this->failed() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->failed(), output);
+  // uint64 interleave = 28;
+  if (this->_internal_interleave() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(28, this->_internal_interleave(), target);
   }
 
-  // int32 total = 7;
-  if (this->total() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->total(), output);
+  // string key_size = 29;
+  if (!this->_internal_key_size().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key_size().data(), static_cast<int>(this->_internal_key_size().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stat.key_size");
+    target = stream->WriteStringMaybeAliased(
+        29, this->_internal_key_size(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // string value_size = 30;
+  if (!this->_internal_value_size().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value_size().data(), static_cast<int>(this->_internal_value_size().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stat.value_size");
+    target = stream->WriteStringMaybeAliased(
+        30, this->_internal_value_size(), target);
   }
-  // @@protoc_insertion_point(serialize_end:kvbench.Stat)
-}
 
-::google::protobuf::uint8* Stat::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:kvbench.Stat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 threads = 31;
+  if (this->_internal_threads() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(31, this->_internal_threads(), target);
+  }
 
-  // double duration = 1;
-  if (this->duration() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(1, this->duration(), target);
+  // repeated .kvbench.ThreadPoint thread_curve = 32;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_thread_curve_size()); i < n; i++) {
+    const auto& repfield = this->_internal_thread_curve(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(32, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // double average_latency = 2;
-  if (this->average_latency() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->average_latency(), target);
+  // double phase_end_duration = 33;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_phase_end_duration = this->_internal_phase_end_duration();
+  uint64_t raw_phase_end_duration;
+  memcpy(&raw_phase_end_duration, &tmp_phase_end_duration, sizeof(tmp_phase_end_duration));
+  if (raw_phase_end_duration != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(33, this->_internal_phase_end_duration(), target);
   }
 
-  // double max_latency = 3;
-  if (this->max_latency() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(3, this->max_latency(), target);
+  // uint64 pmem_flushes = 34;
+  if (this->_internal_pmem_flushes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(34, this->_internal_pmem_flushes(), target);
   }
 
-  // double throughput = 4;
-  if (this->throughput() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(4, this->throughput(), target);
+  // uint64 pmem_fences = 35;
+  if (this->_internal_pmem_fences() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(35, this->_internal_pmem_fences(), target);
   }
 
-  // repeated double latency = 5;
-  if (this->latency_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      5,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _latency_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteDoubleNoTagToArray(this->latency_, target);
+  // .kvbench.ResourceStat resource = 36;
+  if (this->_internal_has_resource()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(36, _Internal::resource(this),
+        _Internal::resource(this).GetCachedSize(), target, stream);
   }
 
-  // int32 failed = 6;
-  if (this->failed() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->failed(), target);
+  // double key_average_latency = 37;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_key_average_latency = this->_internal_key_average_latency();
+  uint64_t raw_key_average_latency;
+  memcpy(&raw_key_average_latency, &tmp_key_average_latency, sizeof(tmp_key_average_latency));
+  if (raw_key_average_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(37, this->_internal_key_average_latency(), target);
   }
 
-  // int32 total = 7;
-  if (this->total() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->total(), target);
+  // .kvbench.LatencyHistogram key_histogram = 38;
+  if (this->_internal_has_key_histogram()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(38, _Internal::key_histogram(this),
+        _Internal::key_histogram(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kvbench.Stat)
   return target;
@@ -468,114 +4425,483 @@ size_t Stat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kvbench.Stat)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated double latency = 5;
   {
-    unsigned int count = static_cast<unsigned int>(this->latency_size());
+    unsigned int count = static_cast<unsigned int>(this->_internal_latency_size());
     size_t data_size = 8UL * count;
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int32 cpu = 17;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.cpu_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _latency_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._cpu_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
+  // repeated .kvbench.TimelinePoint timeline = 19;
+  total_size += 2UL * this->_internal_timeline_size();
+  for (const auto& msg : this->_impl_.timeline_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvbench.OpStat op_stat = 21;
+  total_size += 2UL * this->_internal_op_stat_size();
+  for (const auto& msg : this->_impl_.op_stat_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvbench.RatePoint rate_curve = 24;
+  total_size += 2UL * this->_internal_rate_curve_size();
+  for (const auto& msg : this->_impl_.rate_curve_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .kvbench.ThreadPoint thread_curve = 32;
+  total_size += 2UL * this->_internal_thread_curve_size();
+  for (const auto& msg : this->_impl_.thread_curve_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string mix = 20;
+  if (!this->_internal_mix().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mix());
+  }
+
+  // string arrival = 23;
+  if (!this->_internal_arrival().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_arrival());
+  }
+
+  // string key_size = 29;
+  if (!this->_internal_key_size().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key_size());
+  }
+
+  // string value_size = 30;
+  if (!this->_internal_value_size().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value_size());
+  }
+
+  // .kvbench.LatencyHistogram histogram = 9;
+  if (this->_internal_has_histogram()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.histogram_);
+  }
+
+  // .kvbench.LatencyHistogram batch_histogram = 16;
+  if (this->_internal_has_batch_histogram()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.batch_histogram_);
+  }
+
+  // .kvbench.SteadyStat steady = 18;
+  if (this->_internal_has_steady()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.steady_);
+  }
+
+  // .kvbench.ResourceStat resource = 36;
+  if (this->_internal_has_resource()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.resource_);
+  }
+
+  // .kvbench.LatencyHistogram key_histogram = 38;
+  if (this->_internal_has_key_histogram()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_histogram_);
+  }
+
   // double duration = 1;
-  if (this->duration() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_duration = this->_internal_duration();
+  uint64_t raw_duration;
+  memcpy(&raw_duration, &tmp_duration, sizeof(tmp_duration));
+  if (raw_duration != 0) {
     total_size += 1 + 8;
   }
 
   // double average_latency = 2;
-  if (this->average_latency() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = this->_internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
     total_size += 1 + 8;
   }
 
   // double max_latency = 3;
-  if (this->max_latency() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = this->_internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
     total_size += 1 + 8;
   }
 
   // double throughput = 4;
-  if (this->throughput() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = this->_internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int64 total = 7;
+  if (this->_internal_total() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total());
+  }
+
+  // uint64 buffer_bytes = 8;
+  if (this->_internal_buffer_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_buffer_bytes());
+  }
+
+  // double p50_latency = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = this->_internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p90_latency = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90_latency = this->_internal_p90_latency();
+  uint64_t raw_p90_latency;
+  memcpy(&raw_p90_latency, &tmp_p90_latency, sizeof(tmp_p90_latency));
+  if (raw_p90_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p99_latency = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = this->_internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p999_latency = 13;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = this->_internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p9999_latency = 14;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p9999_latency = this->_internal_p9999_latency();
+  uint64_t raw_p9999_latency;
+  memcpy(&raw_p9999_latency, &tmp_p9999_latency, sizeof(tmp_p9999_latency));
+  if (raw_p9999_latency != 0) {
     total_size += 1 + 8;
   }
 
+  // uint64 latency_batch = 15;
+  if (this->_internal_latency_batch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_latency_batch());
+  }
+
   // int32 failed = 6;
-  if (this->failed() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->failed());
+  if (this->_internal_failed() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_failed());
   }
 
-  // int32 total = 7;
-  if (this->total() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->total());
+  // int32 threads = 31;
+  if (this->_internal_threads() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_threads());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // double offered_rate = 22;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = this->_internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    total_size += 2 + 8;
+  }
 
-void Stat::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kvbench.Stat)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Stat* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Stat>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvbench.Stat)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvbench.Stat)
-    MergeFrom(*source);
+  // uint64 scan_items = 25;
+  if (this->_internal_scan_items() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_scan_items());
   }
-}
 
-void Stat::MergeFrom(const Stat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kvbench.Stat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // double scan_item_throughput = 26;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scan_item_throughput = this->_internal_scan_item_throughput();
+  uint64_t raw_scan_item_throughput;
+  memcpy(&raw_scan_item_throughput, &tmp_scan_item_throughput, sizeof(tmp_scan_item_throughput));
+  if (raw_scan_item_throughput != 0) {
+    total_size += 2 + 8;
+  }
 
-  latency_.MergeFrom(from.latency_);
-  if (from.duration() != 0) {
-    set_duration(from.duration());
+  // uint64 batch = 27;
+  if (this->_internal_batch() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_batch());
   }
-  if (from.average_latency() != 0) {
-    set_average_latency(from.average_latency());
+
+  // uint64 interleave = 28;
+  if (this->_internal_interleave() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_interleave());
   }
-  if (from.max_latency() != 0) {
-    set_max_latency(from.max_latency());
+
+  // double phase_end_duration = 33;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_phase_end_duration = this->_internal_phase_end_duration();
+  uint64_t raw_phase_end_duration;
+  memcpy(&raw_phase_end_duration, &tmp_phase_end_duration, sizeof(tmp_phase_end_duration));
+  if (raw_phase_end_duration != 0) {
+    total_size += 2 + 8;
   }
-  if (from.throughput() != 0) {
-    set_throughput(from.throughput());
+
+  // uint64 pmem_flushes = 34;
+  if (this->_internal_pmem_flushes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_pmem_flushes());
   }
-  if (from.failed() != 0) {
-    set_failed(from.failed());
+
+  // uint64 pmem_fences = 35;
+  if (this->_internal_pmem_fences() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_pmem_fences());
   }
-  if (from.total() != 0) {
-    set_total(from.total());
+
+  // double key_average_latency = 37;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_key_average_latency = this->_internal_key_average_latency();
+  uint64_t raw_key_average_latency;
+  memcpy(&raw_key_average_latency, &tmp_key_average_latency, sizeof(tmp_key_average_latency));
+  if (raw_key_average_latency != 0) {
+    total_size += 2 + 8;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Stat::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kvbench.Stat)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stat::GetClassData() const { return &_class_data_; }
+
+
+void Stat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stat*>(&to_msg);
+  auto& from = static_cast<const Stat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.Stat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.latency_.MergeFrom(from._impl_.latency_);
+  _this->_impl_.cpu_.MergeFrom(from._impl_.cpu_);
+  _this->_impl_.timeline_.MergeFrom(from._impl_.timeline_);
+  _this->_impl_.op_stat_.MergeFrom(from._impl_.op_stat_);
+  _this->_impl_.rate_curve_.MergeFrom(from._impl_.rate_curve_);
+  _this->_impl_.thread_curve_.MergeFrom(from._impl_.thread_curve_);
+  if (!from._internal_mix().empty()) {
+    _this->_internal_set_mix(from._internal_mix());
+  }
+  if (!from._internal_arrival().empty()) {
+    _this->_internal_set_arrival(from._internal_arrival());
+  }
+  if (!from._internal_key_size().empty()) {
+    _this->_internal_set_key_size(from._internal_key_size());
+  }
+  if (!from._internal_value_size().empty()) {
+    _this->_internal_set_value_size(from._internal_value_size());
+  }
+  if (from._internal_has_histogram()) {
+    _this->_internal_mutable_histogram()->::kvbench::LatencyHistogram::MergeFrom(
+        from._internal_histogram());
+  }
+  if (from._internal_has_batch_histogram()) {
+    _this->_internal_mutable_batch_histogram()->::kvbench::LatencyHistogram::MergeFrom(
+        from._internal_batch_histogram());
+  }
+  if (from._internal_has_steady()) {
+    _this->_internal_mutable_steady()->::kvbench::SteadyStat::MergeFrom(
+        from._internal_steady());
+  }
+  if (from._internal_has_resource()) {
+    _this->_internal_mutable_resource()->::kvbench::ResourceStat::MergeFrom(
+        from._internal_resource());
+  }
+  if (from._internal_has_key_histogram()) {
+    _this->_internal_mutable_key_histogram()->::kvbench::LatencyHistogram::MergeFrom(
+        from._internal_key_histogram());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_duration = from._internal_duration();
+  uint64_t raw_duration;
+  memcpy(&raw_duration, &tmp_duration, sizeof(tmp_duration));
+  if (raw_duration != 0) {
+    _this->_internal_set_duration(from._internal_duration());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_average_latency = from._internal_average_latency();
+  uint64_t raw_average_latency;
+  memcpy(&raw_average_latency, &tmp_average_latency, sizeof(tmp_average_latency));
+  if (raw_average_latency != 0) {
+    _this->_internal_set_average_latency(from._internal_average_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_latency = from._internal_max_latency();
+  uint64_t raw_max_latency;
+  memcpy(&raw_max_latency, &tmp_max_latency, sizeof(tmp_max_latency));
+  if (raw_max_latency != 0) {
+    _this->_internal_set_max_latency(from._internal_max_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_throughput = from._internal_throughput();
+  uint64_t raw_throughput;
+  memcpy(&raw_throughput, &tmp_throughput, sizeof(tmp_throughput));
+  if (raw_throughput != 0) {
+    _this->_internal_set_throughput(from._internal_throughput());
+  }
+  if (from._internal_total() != 0) {
+    _this->_internal_set_total(from._internal_total());
+  }
+  if (from._internal_buffer_bytes() != 0) {
+    _this->_internal_set_buffer_bytes(from._internal_buffer_bytes());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p50_latency = from._internal_p50_latency();
+  uint64_t raw_p50_latency;
+  memcpy(&raw_p50_latency, &tmp_p50_latency, sizeof(tmp_p50_latency));
+  if (raw_p50_latency != 0) {
+    _this->_internal_set_p50_latency(from._internal_p50_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p90_latency = from._internal_p90_latency();
+  uint64_t raw_p90_latency;
+  memcpy(&raw_p90_latency, &tmp_p90_latency, sizeof(tmp_p90_latency));
+  if (raw_p90_latency != 0) {
+    _this->_internal_set_p90_latency(from._internal_p90_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p99_latency = from._internal_p99_latency();
+  uint64_t raw_p99_latency;
+  memcpy(&raw_p99_latency, &tmp_p99_latency, sizeof(tmp_p99_latency));
+  if (raw_p99_latency != 0) {
+    _this->_internal_set_p99_latency(from._internal_p99_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p999_latency = from._internal_p999_latency();
+  uint64_t raw_p999_latency;
+  memcpy(&raw_p999_latency, &tmp_p999_latency, sizeof(tmp_p999_latency));
+  if (raw_p999_latency != 0) {
+    _this->_internal_set_p999_latency(from._internal_p999_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p9999_latency = from._internal_p9999_latency();
+  uint64_t raw_p9999_latency;
+  memcpy(&raw_p9999_latency, &tmp_p9999_latency, sizeof(tmp_p9999_latency));
+  if (raw_p9999_latency != 0) {
+    _this->_internal_set_p9999_latency(from._internal_p9999_latency());
+  }
+  if (from._internal_latency_batch() != 0) {
+    _this->_internal_set_latency_batch(from._internal_latency_batch());
+  }
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
+  }
+  if (from._internal_threads() != 0) {
+    _this->_internal_set_threads(from._internal_threads());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_offered_rate = from._internal_offered_rate();
+  uint64_t raw_offered_rate;
+  memcpy(&raw_offered_rate, &tmp_offered_rate, sizeof(tmp_offered_rate));
+  if (raw_offered_rate != 0) {
+    _this->_internal_set_offered_rate(from._internal_offered_rate());
+  }
+  if (from._internal_scan_items() != 0) {
+    _this->_internal_set_scan_items(from._internal_scan_items());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_scan_item_throughput = from._internal_scan_item_throughput();
+  uint64_t raw_scan_item_throughput;
+  memcpy(&raw_scan_item_throughput, &tmp_scan_item_throughput, sizeof(tmp_scan_item_throughput));
+  if (raw_scan_item_throughput != 0) {
+    _this->_internal_set_scan_item_throughput(from._internal_scan_item_throughput());
+  }
+  if (from._internal_batch() != 0) {
+    _this->_internal_set_batch(from._internal_batch());
+  }
+  if (from._internal_interleave() != 0) {
+    _this->_internal_set_interleave(from._internal_interleave());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_phase_end_duration = from._internal_phase_end_duration();
+  uint64_t raw_phase_end_duration;
+  memcpy(&raw_phase_end_duration, &tmp_phase_end_duration, sizeof(tmp_phase_end_duration));
+  if (raw_phase_end_duration != 0) {
+    _this->_internal_set_phase_end_duration(from._internal_phase_end_duration());
+  }
+  if (from._internal_pmem_flushes() != 0) {
+    _this->_internal_set_pmem_flushes(from._internal_pmem_flushes());
+  }
+  if (from._internal_pmem_fences() != 0) {
+    _this->_internal_set_pmem_fences(from._internal_pmem_fences());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_key_average_latency = from._internal_key_average_latency();
+  uint64_t raw_key_average_latency;
+  memcpy(&raw_key_average_latency, &tmp_key_average_latency, sizeof(tmp_key_average_latency));
+  if (raw_key_average_latency != 0) {
+    _this->_internal_set_key_average_latency(from._internal_key_average_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Stat::CopyFrom(const Stat& from) {
@@ -589,168 +4915,413 @@ bool Stat::IsInitialized() const {
   return true;
 }
 
-void Stat::Swap(Stat* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Stat::InternalSwap(Stat* other) {
   using std::swap;
-  latency_.InternalSwap(&other->latency_);
-  swap(duration_, other->duration_);
-  swap(average_latency_, other->average_latency_);
-  swap(max_latency_, other->max_latency_);
-  swap(throughput_, other->throughput_);
-  swap(failed_, other->failed_);
-  swap(total_, other->total_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.latency_.InternalSwap(&other->_impl_.latency_);
+  _impl_.cpu_.InternalSwap(&other->_impl_.cpu_);
+  _impl_.timeline_.InternalSwap(&other->_impl_.timeline_);
+  _impl_.op_stat_.InternalSwap(&other->_impl_.op_stat_);
+  _impl_.rate_curve_.InternalSwap(&other->_impl_.rate_curve_);
+  _impl_.thread_curve_.InternalSwap(&other->_impl_.thread_curve_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mix_, lhs_arena,
+      &other->_impl_.mix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.arrival_, lhs_arena,
+      &other->_impl_.arrival_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_size_, lhs_arena,
+      &other->_impl_.key_size_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_size_, lhs_arena,
+      &other->_impl_.value_size_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stat, _impl_.key_average_latency_)
+      + sizeof(Stat::_impl_.key_average_latency_)
+      - PROTOBUF_FIELD_OFFSET(Stat, _impl_.histogram_)>(
+          reinterpret_cast<char*>(&_impl_.histogram_),
+          reinterpret_cast<char*>(&other->_impl_.histogram_));
 }
 
-::google::protobuf::Metadata Stat::GetMetadata() const {
-  protobuf_kvbench_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_kvbench_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Stat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void Stats::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Stats::kStatFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Stats::_Internal {
+ public:
+};
 
-Stats::Stats()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_kvbench_2eproto::scc_info_Stats.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kvbench.Stats)
+Stats::Stats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kvbench.Stats)
 }
 Stats::Stats(const Stats& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      stat_(from.stat_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stat_){from._impl_.stat_}
+    , decltype(_impl_.clock_source_){}
+    , decltype(_impl_.numa_policy_){}
+    , decltype(_impl_.mem_policy_){}
+    , decltype(_impl_.pmem_dir_){}
+    , decltype(_impl_.seed_){}
+    , decltype(_impl_.clock_frequency_){}
+    , decltype(_impl_.timer_overhead_){}
+    , decltype(_impl_.pmem_flush_latency_){}
+    , decltype(_impl_.pmem_fence_latency_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clock_source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clock_source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clock_source().empty()) {
+    _this->_impl_.clock_source_.Set(from._internal_clock_source(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.numa_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.numa_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_numa_policy().empty()) {
+    _this->_impl_.numa_policy_.Set(from._internal_numa_policy(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.mem_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mem_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_mem_policy().empty()) {
+    _this->_impl_.mem_policy_.Set(from._internal_mem_policy(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.pmem_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pmem_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_pmem_dir().empty()) {
+    _this->_impl_.pmem_dir_.Set(from._internal_pmem_dir(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.seed_, &from._impl_.seed_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pmem_fence_latency_) -
+    reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.pmem_fence_latency_));
   // @@protoc_insertion_point(copy_constructor:kvbench.Stats)
 }
 
-void Stats::SharedCtor() {
+inline void Stats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stat_){arena}
+    , decltype(_impl_.clock_source_){}
+    , decltype(_impl_.numa_policy_){}
+    , decltype(_impl_.mem_policy_){}
+    , decltype(_impl_.pmem_dir_){}
+    , decltype(_impl_.seed_){uint64_t{0u}}
+    , decltype(_impl_.clock_frequency_){0}
+    , decltype(_impl_.timer_overhead_){0}
+    , decltype(_impl_.pmem_flush_latency_){0}
+    , decltype(_impl_.pmem_fence_latency_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clock_source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clock_source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.numa_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.numa_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.mem_policy_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.mem_policy_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.pmem_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.pmem_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Stats::~Stats() {
   // @@protoc_insertion_point(destructor:kvbench.Stats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Stats::SharedDtor() {
+inline void Stats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stat_.~RepeatedPtrField();
+  _impl_.clock_source_.Destroy();
+  _impl_.numa_policy_.Destroy();
+  _impl_.mem_policy_.Destroy();
+  _impl_.pmem_dir_.Destroy();
 }
 
 void Stats::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Stats::descriptor() {
-  ::protobuf_kvbench_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_kvbench_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Stats& Stats::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_kvbench_2eproto::scc_info_Stats.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Stats::Clear() {
 // @@protoc_insertion_point(message_clear_start:kvbench.Stats)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stat_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.stat_.Clear();
+  _impl_.clock_source_.ClearToEmpty();
+  _impl_.numa_policy_.ClearToEmpty();
+  _impl_.mem_policy_.ClearToEmpty();
+  _impl_.pmem_dir_.ClearToEmpty();
+  ::memset(&_impl_.seed_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pmem_fence_latency_) -
+      reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.pmem_fence_latency_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Stats::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:kvbench.Stats)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Stats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .kvbench.Stat stat = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_stat()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stat(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 seed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string clock_source = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_clock_source();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stats.clock_source"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double clock_frequency = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.clock_frequency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double timer_overhead = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.timer_overhead_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // string numa_policy = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_numa_policy();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stats.numa_policy"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string mem_policy = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_mem_policy();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stats.mem_policy"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string pmem_dir = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_pmem_dir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kvbench.Stats.pmem_dir"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double pmem_flush_latency = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.pmem_flush_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double pmem_fence_latency = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _impl_.pmem_fence_latency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:kvbench.Stats)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:kvbench.Stats)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Stats::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:kvbench.Stats)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Stats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kvbench.Stats)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .kvbench.Stat stat = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->stat_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->stat(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stat_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stat(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // uint64 seed = 2;
+  if (this->_internal_seed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seed(), target);
   }
-  // @@protoc_insertion_point(serialize_end:kvbench.Stats)
-}
 
-::google::protobuf::uint8* Stats::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:kvbench.Stats)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // string clock_source = 3;
+  if (!this->_internal_clock_source().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_clock_source().data(), static_cast<int>(this->_internal_clock_source().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stats.clock_source");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_clock_source(), target);
+  }
 
-  // repeated .kvbench.Stat stat = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->stat_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->stat(static_cast<int>(i)), deterministic, target);
+  // double clock_frequency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clock_frequency = this->_internal_clock_frequency();
+  uint64_t raw_clock_frequency;
+  memcpy(&raw_clock_frequency, &tmp_clock_frequency, sizeof(tmp_clock_frequency));
+  if (raw_clock_frequency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_clock_frequency(), target);
+  }
+
+  // double timer_overhead = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timer_overhead = this->_internal_timer_overhead();
+  uint64_t raw_timer_overhead;
+  memcpy(&raw_timer_overhead, &tmp_timer_overhead, sizeof(tmp_timer_overhead));
+  if (raw_timer_overhead != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_timer_overhead(), target);
+  }
+
+  // string numa_policy = 6;
+  if (!this->_internal_numa_policy().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_numa_policy().data(), static_cast<int>(this->_internal_numa_policy().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stats.numa_policy");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_numa_policy(), target);
+  }
+
+  // string mem_policy = 7;
+  if (!this->_internal_mem_policy().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mem_policy().data(), static_cast<int>(this->_internal_mem_policy().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stats.mem_policy");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_mem_policy(), target);
+  }
+
+  // string pmem_dir = 8;
+  if (!this->_internal_pmem_dir().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_pmem_dir().data(), static_cast<int>(this->_internal_pmem_dir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kvbench.Stats.pmem_dir");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_pmem_dir(), target);
+  }
+
+  // double pmem_flush_latency = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_flush_latency = this->_internal_pmem_flush_latency();
+  uint64_t raw_pmem_flush_latency;
+  memcpy(&raw_pmem_flush_latency, &tmp_pmem_flush_latency, sizeof(tmp_pmem_flush_latency));
+  if (raw_pmem_flush_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_pmem_flush_latency(), target);
+  }
+
+  // double pmem_fence_latency = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_fence_latency = this->_internal_pmem_fence_latency();
+  uint64_t raw_pmem_fence_latency;
+  memcpy(&raw_pmem_fence_latency, &tmp_pmem_fence_latency, sizeof(tmp_pmem_fence_latency));
+  if (raw_pmem_fence_latency != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_pmem_fence_latency(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kvbench.Stats)
   return target;
@@ -760,57 +5331,149 @@ size_t Stats::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kvbench.Stats)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .kvbench.Stat stat = 1;
+  total_size += 1UL * this->_internal_stat_size();
+  for (const auto& msg : this->_impl_.stat_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // repeated .kvbench.Stat stat = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->stat_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->stat(static_cast<int>(i)));
-    }
+
+  // string clock_source = 3;
+  if (!this->_internal_clock_source().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_clock_source());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // string numa_policy = 6;
+  if (!this->_internal_numa_policy().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_numa_policy());
+  }
 
-void Stats::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kvbench.Stats)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Stats* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Stats>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kvbench.Stats)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kvbench.Stats)
-    MergeFrom(*source);
+  // string mem_policy = 7;
+  if (!this->_internal_mem_policy().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mem_policy());
   }
-}
 
-void Stats::MergeFrom(const Stats& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kvbench.Stats)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // string pmem_dir = 8;
+  if (!this->_internal_pmem_dir().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_pmem_dir());
+  }
+
+  // uint64 seed = 2;
+  if (this->_internal_seed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seed());
+  }
+
+  // double clock_frequency = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clock_frequency = this->_internal_clock_frequency();
+  uint64_t raw_clock_frequency;
+  memcpy(&raw_clock_frequency, &tmp_clock_frequency, sizeof(tmp_clock_frequency));
+  if (raw_clock_frequency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double timer_overhead = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timer_overhead = this->_internal_timer_overhead();
+  uint64_t raw_timer_overhead;
+  memcpy(&raw_timer_overhead, &tmp_timer_overhead, sizeof(tmp_timer_overhead));
+  if (raw_timer_overhead != 0) {
+    total_size += 1 + 8;
+  }
 
-  stat_.MergeFrom(from.stat_);
+  // double pmem_flush_latency = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_flush_latency = this->_internal_pmem_flush_latency();
+  uint64_t raw_pmem_flush_latency;
+  memcpy(&raw_pmem_flush_latency, &tmp_pmem_flush_latency, sizeof(tmp_pmem_flush_latency));
+  if (raw_pmem_flush_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double pmem_fence_latency = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_fence_latency = this->_internal_pmem_fence_latency();
+  uint64_t raw_pmem_fence_latency;
+  memcpy(&raw_pmem_fence_latency, &tmp_pmem_fence_latency, sizeof(tmp_pmem_fence_latency));
+  if (raw_pmem_fence_latency != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Stats::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kvbench.Stats)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stats::GetClassData() const { return &_class_data_; }
+
+
+void Stats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stats*>(&to_msg);
+  auto& from = static_cast<const Stats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kvbench.Stats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stat_.MergeFrom(from._impl_.stat_);
+  if (!from._internal_clock_source().empty()) {
+    _this->_internal_set_clock_source(from._internal_clock_source());
+  }
+  if (!from._internal_numa_policy().empty()) {
+    _this->_internal_set_numa_policy(from._internal_numa_policy());
+  }
+  if (!from._internal_mem_policy().empty()) {
+    _this->_internal_set_mem_policy(from._internal_mem_policy());
+  }
+  if (!from._internal_pmem_dir().empty()) {
+    _this->_internal_set_pmem_dir(from._internal_pmem_dir());
+  }
+  if (from._internal_seed() != 0) {
+    _this->_internal_set_seed(from._internal_seed());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_clock_frequency = from._internal_clock_frequency();
+  uint64_t raw_clock_frequency;
+  memcpy(&raw_clock_frequency, &tmp_clock_frequency, sizeof(tmp_clock_frequency));
+  if (raw_clock_frequency != 0) {
+    _this->_internal_set_clock_frequency(from._internal_clock_frequency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timer_overhead = from._internal_timer_overhead();
+  uint64_t raw_timer_overhead;
+  memcpy(&raw_timer_overhead, &tmp_timer_overhead, sizeof(tmp_timer_overhead));
+  if (raw_timer_overhead != 0) {
+    _this->_internal_set_timer_overhead(from._internal_timer_overhead());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_flush_latency = from._internal_pmem_flush_latency();
+  uint64_t raw_pmem_flush_latency;
+  memcpy(&raw_pmem_flush_latency, &tmp_pmem_flush_latency, sizeof(tmp_pmem_flush_latency));
+  if (raw_pmem_flush_latency != 0) {
+    _this->_internal_set_pmem_flush_latency(from._internal_pmem_flush_latency());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pmem_fence_latency = from._internal_pmem_fence_latency();
+  uint64_t raw_pmem_fence_latency;
+  memcpy(&raw_pmem_fence_latency, &tmp_pmem_fence_latency, sizeof(tmp_pmem_fence_latency));
+  if (raw_pmem_fence_latency != 0) {
+    _this->_internal_set_pmem_fence_latency(from._internal_pmem_fence_latency());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Stats::CopyFrom(const Stats& from) {
@@ -824,33 +5487,82 @@ bool Stats::IsInitialized() const {
   return true;
 }
 
-void Stats::Swap(Stats* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Stats::InternalSwap(Stats* other) {
   using std::swap;
-  CastToBase(&stat_)->InternalSwap(CastToBase(&other->stat_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stat_.InternalSwap(&other->_impl_.stat_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clock_source_, lhs_arena,
+      &other->_impl_.clock_source_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.numa_policy_, lhs_arena,
+      &other->_impl_.numa_policy_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.mem_policy_, lhs_arena,
+      &other->_impl_.mem_policy_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.pmem_dir_, lhs_arena,
+      &other->_impl_.pmem_dir_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stats, _impl_.pmem_fence_latency_)
+      + sizeof(Stats::_impl_.pmem_fence_latency_)
+      - PROTOBUF_FIELD_OFFSET(Stats, _impl_.seed_)>(
+          reinterpret_cast<char*>(&_impl_.seed_),
+          reinterpret_cast<char*>(&other->_impl_.seed_));
 }
 
-::google::protobuf::Metadata Stats::GetMetadata() const {
-  protobuf_kvbench_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_kvbench_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Stats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvbench_2eproto_getter, &descriptor_table_kvbench_2eproto_once,
+      file_level_metadata_kvbench_2eproto[8]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace kvbench
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::kvbench::Stat* Arena::CreateMaybeMessage< ::kvbench::Stat >(Arena* arena) {
-  return Arena::CreateInternal< ::kvbench::Stat >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::kvbench::LatencyHistogram*
+Arena::CreateMaybeMessage< ::kvbench::LatencyHistogram >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::LatencyHistogram >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::ResourceStat*
+Arena::CreateMaybeMessage< ::kvbench::ResourceStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::ResourceStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::SteadyStat*
+Arena::CreateMaybeMessage< ::kvbench::SteadyStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::SteadyStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::TimelinePoint*
+Arena::CreateMaybeMessage< ::kvbench::TimelinePoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::TimelinePoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::OpStat*
+Arena::CreateMaybeMessage< ::kvbench::OpStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::OpStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::RatePoint*
+Arena::CreateMaybeMessage< ::kvbench::RatePoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::RatePoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::ThreadPoint*
+Arena::CreateMaybeMessage< ::kvbench::ThreadPoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::ThreadPoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kvbench::Stat*
+Arena::CreateMaybeMessage< ::kvbench::Stat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::Stat >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::kvbench::Stats* Arena::CreateMaybeMessage< ::kvbench::Stats >(Arena* arena) {
-  return Arena::CreateInternal< ::kvbench::Stats >(arena);
+template<> PROTOBUF_NOINLINE ::kvbench::Stats*
+Arena::CreateMaybeMessage< ::kvbench::Stats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kvbench::Stats >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,489 +1,5674 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: kvbench.proto
 
-#ifndef PROTOBUF_INCLUDED_kvbench_2eproto
-#define PROTOBUF_INCLUDED_kvbench_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_kvbench_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_kvbench_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_kvbench_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_kvbench_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_kvbench_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[2];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_kvbench_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_kvbench_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kvbench_2eproto;
 namespace kvbench {
+class LatencyHistogram;
+struct LatencyHistogramDefaultTypeInternal;
+extern LatencyHistogramDefaultTypeInternal _LatencyHistogram_default_instance_;
+class OpStat;
+struct OpStatDefaultTypeInternal;
+extern OpStatDefaultTypeInternal _OpStat_default_instance_;
+class RatePoint;
+struct RatePointDefaultTypeInternal;
+extern RatePointDefaultTypeInternal _RatePoint_default_instance_;
+class ResourceStat;
+struct ResourceStatDefaultTypeInternal;
+extern ResourceStatDefaultTypeInternal _ResourceStat_default_instance_;
 class Stat;
-class StatDefaultTypeInternal;
+struct StatDefaultTypeInternal;
 extern StatDefaultTypeInternal _Stat_default_instance_;
 class Stats;
-class StatsDefaultTypeInternal;
+struct StatsDefaultTypeInternal;
 extern StatsDefaultTypeInternal _Stats_default_instance_;
+class SteadyStat;
+struct SteadyStatDefaultTypeInternal;
+extern SteadyStatDefaultTypeInternal _SteadyStat_default_instance_;
+class ThreadPoint;
+struct ThreadPointDefaultTypeInternal;
+extern ThreadPointDefaultTypeInternal _ThreadPoint_default_instance_;
+class TimelinePoint;
+struct TimelinePointDefaultTypeInternal;
+extern TimelinePointDefaultTypeInternal _TimelinePoint_default_instance_;
 }  // namespace kvbench
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::kvbench::LatencyHistogram* Arena::CreateMaybeMessage<::kvbench::LatencyHistogram>(Arena*);
+template<> ::kvbench::OpStat* Arena::CreateMaybeMessage<::kvbench::OpStat>(Arena*);
+template<> ::kvbench::RatePoint* Arena::CreateMaybeMessage<::kvbench::RatePoint>(Arena*);
+template<> ::kvbench::ResourceStat* Arena::CreateMaybeMessage<::kvbench::ResourceStat>(Arena*);
 template<> ::kvbench::Stat* Arena::CreateMaybeMessage<::kvbench::Stat>(Arena*);
 template<> ::kvbench::Stats* Arena::CreateMaybeMessage<::kvbench::Stats>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::kvbench::SteadyStat* Arena::CreateMaybeMessage<::kvbench::SteadyStat>(Arena*);
+template<> ::kvbench::ThreadPoint* Arena::CreateMaybeMessage<::kvbench::ThreadPoint>(Arena*);
+template<> ::kvbench::TimelinePoint* Arena::CreateMaybeMessage<::kvbench::TimelinePoint>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace kvbench {
 
 // ===================================================================
 
-class Stat : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvbench.Stat) */ {
+class LatencyHistogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.LatencyHistogram) */ {
  public:
-  Stat();
-  virtual ~Stat();
+  inline LatencyHistogram() : LatencyHistogram(nullptr) {}
+  ~LatencyHistogram() override;
+  explicit PROTOBUF_CONSTEXPR LatencyHistogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Stat(const Stat& from);
+  LatencyHistogram(const LatencyHistogram& from);
+  LatencyHistogram(LatencyHistogram&& from) noexcept
+    : LatencyHistogram() {
+    *this = ::std::move(from);
+  }
 
-  inline Stat& operator=(const Stat& from) {
+  inline LatencyHistogram& operator=(const LatencyHistogram& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Stat(Stat&& from) noexcept
-    : Stat() {
-    *this = ::std::move(from);
-  }
-
-  inline Stat& operator=(Stat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline LatencyHistogram& operator=(LatencyHistogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Stat* internal_default_instance() {
-    return reinterpret_cast<const Stat*>(
-               &_Stat_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyHistogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyHistogram* internal_default_instance() {
+    return reinterpret_cast<const LatencyHistogram*>(
+               &_LatencyHistogram_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Stat* other);
-  friend void swap(Stat& a, Stat& b) {
+  friend void swap(LatencyHistogram& a, LatencyHistogram& b) {
     a.Swap(&b);
   }
+  inline void Swap(LatencyHistogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyHistogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Stat* New() const final {
-    return CreateMaybeMessage<Stat>(NULL);
+  LatencyHistogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyHistogram>(arena);
   }
-
-  Stat* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Stat>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyHistogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyHistogram& from) {
+    LatencyHistogram::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const Stat& from);
-  void MergeFrom(const Stat& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Stat* other);
+  void InternalSwap(LatencyHistogram* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.LatencyHistogram";
   }
+  protected:
+  explicit LatencyHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated double latency = 5;
-  int latency_size() const;
-  void clear_latency();
-  static const int kLatencyFieldNumber = 5;
-  double latency(int index) const;
-  void set_latency(int index, double value);
-  void add_latency(double value);
-  const ::google::protobuf::RepeatedField< double >&
-      latency() const;
-  ::google::protobuf::RepeatedField< double >*
-      mutable_latency();
+  enum : int {
+    kIndexFieldNumber = 6,
+    kBucketCountFieldNumber = 7,
+    kCountFieldNumber = 2,
+    kSumFieldNumber = 3,
+    kMinFieldNumber = 4,
+    kMaxFieldNumber = 5,
+    kSubBucketBitsFieldNumber = 1,
+  };
+  // repeated uint32 index = 6;
+  int index_size() const;
+  private:
+  int _internal_index_size() const;
+  public:
+  void clear_index();
+  private:
+  uint32_t _internal_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_index() const;
+  void _internal_add_index(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_index();
+  public:
+  uint32_t index(int index) const;
+  void set_index(int index, uint32_t value);
+  void add_index(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_index();
 
-  // double duration = 1;
-  void clear_duration();
-  static const int kDurationFieldNumber = 1;
-  double duration() const;
-  void set_duration(double value);
+  // repeated uint64 bucket_count = 7;
+  int bucket_count_size() const;
+  private:
+  int _internal_bucket_count_size() const;
+  public:
+  void clear_bucket_count();
+  private:
+  uint64_t _internal_bucket_count(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_bucket_count() const;
+  void _internal_add_bucket_count(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_bucket_count();
+  public:
+  uint64_t bucket_count(int index) const;
+  void set_bucket_count(int index, uint64_t value);
+  void add_bucket_count(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      bucket_count() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_bucket_count();
 
-  // double average_latency = 2;
-  void clear_average_latency();
-  static const int kAverageLatencyFieldNumber = 2;
-  double average_latency() const;
-  void set_average_latency(double value);
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
 
-  // double max_latency = 3;
-  void clear_max_latency();
-  static const int kMaxLatencyFieldNumber = 3;
-  double max_latency() const;
-  void set_max_latency(double value);
+  // uint64 sum = 3;
+  void clear_sum();
+  uint64_t sum() const;
+  void set_sum(uint64_t value);
+  private:
+  uint64_t _internal_sum() const;
+  void _internal_set_sum(uint64_t value);
+  public:
 
-  // double throughput = 4;
-  void clear_throughput();
-  static const int kThroughputFieldNumber = 4;
-  double throughput() const;
-  void set_throughput(double value);
+  // uint64 min = 4;
+  void clear_min();
+  uint64_t min() const;
+  void set_min(uint64_t value);
+  private:
+  uint64_t _internal_min() const;
+  void _internal_set_min(uint64_t value);
+  public:
 
-  // int32 failed = 6;
-  void clear_failed();
-  static const int kFailedFieldNumber = 6;
-  ::google::protobuf::int32 failed() const;
-  void set_failed(::google::protobuf::int32 value);
+  // uint64 max = 5;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
 
-  // int32 total = 7;
-  void clear_total();
-  static const int kTotalFieldNumber = 7;
-  ::google::protobuf::int32 total() const;
-  void set_total(::google::protobuf::int32 value);
+  // int32 sub_bucket_bits = 1;
+  void clear_sub_bucket_bits();
+  int32_t sub_bucket_bits() const;
+  void set_sub_bucket_bits(int32_t value);
+  private:
+  int32_t _internal_sub_bucket_bits() const;
+  void _internal_set_sub_bucket_bits(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:kvbench.Stat)
+  // @@protoc_insertion_point(class_scope:kvbench.LatencyHistogram)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< double > latency_;
-  mutable int _latency_cached_byte_size_;
-  double duration_;
-  double average_latency_;
-  double max_latency_;
-  double throughput_;
-  ::google::protobuf::int32 failed_;
-  ::google::protobuf::int32 total_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_kvbench_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > index_;
+    mutable std::atomic<int> _index_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > bucket_count_;
+    mutable std::atomic<int> _bucket_count_cached_byte_size_;
+    uint64_t count_;
+    uint64_t sum_;
+    uint64_t min_;
+    uint64_t max_;
+    int32_t sub_bucket_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Stats : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:kvbench.Stats) */ {
+class ResourceStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.ResourceStat) */ {
  public:
-  Stats();
-  virtual ~Stats();
+  inline ResourceStat() : ResourceStat(nullptr) {}
+  ~ResourceStat() override;
+  explicit PROTOBUF_CONSTEXPR ResourceStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Stats(const Stats& from);
+  ResourceStat(const ResourceStat& from);
+  ResourceStat(ResourceStat&& from) noexcept
+    : ResourceStat() {
+    *this = ::std::move(from);
+  }
 
-  inline Stats& operator=(const Stats& from) {
+  inline ResourceStat& operator=(const ResourceStat& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  Stats(Stats&& from) noexcept
-    : Stats() {
-    *this = ::std::move(from);
-  }
-
-  inline Stats& operator=(Stats&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ResourceStat& operator=(ResourceStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stats& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Stats* internal_default_instance() {
-    return reinterpret_cast<const Stats*>(
-               &_Stats_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourceStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceStat* internal_default_instance() {
+    return reinterpret_cast<const ResourceStat*>(
+               &_ResourceStat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(Stats* other);
-  friend void swap(Stats& a, Stats& b) {
+  friend void swap(ResourceStat& a, ResourceStat& b) {
     a.Swap(&b);
   }
+  inline void Swap(ResourceStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Stats* New() const final {
-    return CreateMaybeMessage<Stats>(NULL);
+  ResourceStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceStat>(arena);
   }
-
-  Stats* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Stats>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceStat& from) {
+    ResourceStat::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const Stats& from);
-  void MergeFrom(const Stats& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Stats* other);
+  void InternalSwap(ResourceStat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.ResourceStat";
   }
+  protected:
+  explicit ResourceStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .kvbench.Stat stat = 1;
-  int stat_size() const;
-  void clear_stat();
-  static const int kStatFieldNumber = 1;
-  ::kvbench::Stat* mutable_stat(int index);
-  ::google::protobuf::RepeatedPtrField< ::kvbench::Stat >*
-      mutable_stat();
-  const ::kvbench::Stat& stat(int index) const;
-  ::kvbench::Stat* add_stat();
-  const ::google::protobuf::RepeatedPtrField< ::kvbench::Stat >&
-      stat() const;
-
-  // @@protoc_insertion_point(class_scope:kvbench.Stats)
- private:
+  enum : int {
+    kUserTimeFieldNumber = 1,
+    kSysTimeFieldNumber = 2,
+    kMinorFaultsFieldNumber = 3,
+    kMajorFaultsFieldNumber = 4,
+    kVoluntarySwitchesFieldNumber = 5,
+    kInvoluntarySwitchesFieldNumber = 6,
+    kRssBeginFieldNumber = 7,
+    kRssEndFieldNumber = 8,
+    kRssPeakFieldNumber = 9,
+    kLiveKeysFieldNumber = 10,
+    kBytesPerKeyFieldNumber = 11,
+  };
+  // double user_time = 1;
+  void clear_user_time();
+  double user_time() const;
+  void set_user_time(double value);
+  private:
+  double _internal_user_time() const;
+  void _internal_set_user_time(double value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::kvbench::Stat > stat_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_kvbench_2eproto::TableStruct;
-};
-// ===================================================================
+  // double sys_time = 2;
+  void clear_sys_time();
+  double sys_time() const;
+  void set_sys_time(double value);
+  private:
+  double _internal_sys_time() const;
+  void _internal_set_sys_time(double value);
+  public:
 
+  // uint64 minor_faults = 3;
+  void clear_minor_faults();
+  uint64_t minor_faults() const;
+  void set_minor_faults(uint64_t value);
+  private:
+  uint64_t _internal_minor_faults() const;
+  void _internal_set_minor_faults(uint64_t value);
+  public:
 
-// ===================================================================
+  // uint64 major_faults = 4;
+  void clear_major_faults();
+  uint64_t major_faults() const;
+  void set_major_faults(uint64_t value);
+  private:
+  uint64_t _internal_major_faults() const;
+  void _internal_set_major_faults(uint64_t value);
+  public:
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Stat
+  // uint64 voluntary_switches = 5;
+  void clear_voluntary_switches();
+  uint64_t voluntary_switches() const;
+  void set_voluntary_switches(uint64_t value);
+  private:
+  uint64_t _internal_voluntary_switches() const;
+  void _internal_set_voluntary_switches(uint64_t value);
+  public:
 
-// double duration = 1;
-inline void Stat::clear_duration() {
-  duration_ = 0;
-}
-inline double Stat::duration() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.duration)
-  return duration_;
-}
-inline void Stat::set_duration(double value) {
-  
-  duration_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.duration)
-}
+  // uint64 involuntary_switches = 6;
+  void clear_involuntary_switches();
+  uint64_t involuntary_switches() const;
+  void set_involuntary_switches(uint64_t value);
+  private:
+  uint64_t _internal_involuntary_switches() const;
+  void _internal_set_involuntary_switches(uint64_t value);
+  public:
 
-// double average_latency = 2;
-inline void Stat::clear_average_latency() {
-  average_latency_ = 0;
-}
-inline double Stat::average_latency() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.average_latency)
-  return average_latency_;
-}
-inline void Stat::set_average_latency(double value) {
-  
-  average_latency_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.average_latency)
-}
+  // uint64 rss_begin = 7;
+  void clear_rss_begin();
+  uint64_t rss_begin() const;
+  void set_rss_begin(uint64_t value);
+  private:
+  uint64_t _internal_rss_begin() const;
+  void _internal_set_rss_begin(uint64_t value);
+  public:
 
-// double max_latency = 3;
-inline void Stat::clear_max_latency() {
-  max_latency_ = 0;
-}
-inline double Stat::max_latency() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.max_latency)
-  return max_latency_;
-}
-inline void Stat::set_max_latency(double value) {
-  
-  max_latency_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.max_latency)
-}
+  // uint64 rss_end = 8;
+  void clear_rss_end();
+  uint64_t rss_end() const;
+  void set_rss_end(uint64_t value);
+  private:
+  uint64_t _internal_rss_end() const;
+  void _internal_set_rss_end(uint64_t value);
+  public:
 
-// double throughput = 4;
-inline void Stat::clear_throughput() {
-  throughput_ = 0;
-}
-inline double Stat::throughput() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.throughput)
-  return throughput_;
-}
-inline void Stat::set_throughput(double value) {
-  
-  throughput_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.throughput)
-}
+  // uint64 rss_peak = 9;
+  void clear_rss_peak();
+  uint64_t rss_peak() const;
+  void set_rss_peak(uint64_t value);
+  private:
+  uint64_t _internal_rss_peak() const;
+  void _internal_set_rss_peak(uint64_t value);
+  public:
 
-// repeated double latency = 5;
-inline int Stat::latency_size() const {
-  return latency_.size();
-}
-inline void Stat::clear_latency() {
-  latency_.Clear();
-}
-inline double Stat::latency(int index) const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.latency)
-  return latency_.Get(index);
-}
-inline void Stat::set_latency(int index, double value) {
-  latency_.Set(index, value);
-  // @@protoc_insertion_point(field_set:kvbench.Stat.latency)
-}
-inline void Stat::add_latency(double value) {
-  latency_.Add(value);
-  // @@protoc_insertion_point(field_add:kvbench.Stat.latency)
-}
-inline const ::google::protobuf::RepeatedField< double >&
-Stat::latency() const {
-  // @@protoc_insertion_point(field_list:kvbench.Stat.latency)
-  return latency_;
-}
-inline ::google::protobuf::RepeatedField< double >*
-Stat::mutable_latency() {
-  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.latency)
-  return &latency_;
-}
+  // uint64 live_keys = 10;
+  void clear_live_keys();
+  uint64_t live_keys() const;
+  void set_live_keys(uint64_t value);
+  private:
+  uint64_t _internal_live_keys() const;
+  void _internal_set_live_keys(uint64_t value);
+  public:
 
-// int32 failed = 6;
-inline void Stat::clear_failed() {
-  failed_ = 0;
-}
-inline ::google::protobuf::int32 Stat::failed() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.failed)
-  return failed_;
-}
-inline void Stat::set_failed(::google::protobuf::int32 value) {
-  
-  failed_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.failed)
-}
+  // double bytes_per_key = 11;
+  void clear_bytes_per_key();
+  double bytes_per_key() const;
+  void set_bytes_per_key(double value);
+  private:
+  double _internal_bytes_per_key() const;
+  void _internal_set_bytes_per_key(double value);
+  public:
 
-// int32 total = 7;
-inline void Stat::clear_total() {
-  total_ = 0;
-}
-inline ::google::protobuf::int32 Stat::total() const {
-  // @@protoc_insertion_point(field_get:kvbench.Stat.total)
-  return total_;
-}
-inline void Stat::set_total(::google::protobuf::int32 value) {
-  
-  total_ = value;
-  // @@protoc_insertion_point(field_set:kvbench.Stat.total)
-}
+  // @@protoc_insertion_point(class_scope:kvbench.ResourceStat)
+ private:
+  class _Internal;
 
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double user_time_;
+    double sys_time_;
+    uint64_t minor_faults_;
+    uint64_t major_faults_;
+    uint64_t voluntary_switches_;
+    uint64_t involuntary_switches_;
+    uint64_t rss_begin_;
+    uint64_t rss_end_;
+    uint64_t rss_peak_;
+    uint64_t live_keys_;
+    double bytes_per_key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
 // -------------------------------------------------------------------
 
-// Stats
+class SteadyStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.SteadyStat) */ {
+ public:
+  inline SteadyStat() : SteadyStat(nullptr) {}
+  ~SteadyStat() override;
+  explicit PROTOBUF_CONSTEXPR SteadyStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// repeated .kvbench.Stat stat = 1;
-inline int Stats::stat_size() const {
-  return stat_.size();
-}
-inline void Stats::clear_stat() {
-  stat_.Clear();
-}
-inline ::kvbench::Stat* Stats::mutable_stat(int index) {
-  // @@protoc_insertion_point(field_mutable:kvbench.Stats.stat)
-  return stat_.Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField< ::kvbench::Stat >*
-Stats::mutable_stat() {
-  // @@protoc_insertion_point(field_mutable_list:kvbench.Stats.stat)
-  return &stat_;
-}
-inline const ::kvbench::Stat& Stats::stat(int index) const {
-  // @@protoc_insertion_point(field_get:kvbench.Stats.stat)
-  return stat_.Get(index);
-}
-inline ::kvbench::Stat* Stats::add_stat() {
-  // @@protoc_insertion_point(field_add:kvbench.Stats.stat)
-  return stat_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::kvbench::Stat >&
-Stats::stat() const {
-  // @@protoc_insertion_point(field_list:kvbench.Stats.stat)
-  return stat_;
-}
+  SteadyStat(const SteadyStat& from);
+  SteadyStat(SteadyStat&& from) noexcept
+    : SteadyStat() {
+    *this = ::std::move(from);
+  }
+
+  inline SteadyStat& operator=(const SteadyStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SteadyStat& operator=(SteadyStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SteadyStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SteadyStat* internal_default_instance() {
+    return reinterpret_cast<const SteadyStat*>(
+               &_SteadyStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SteadyStat& a, SteadyStat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SteadyStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SteadyStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SteadyStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SteadyStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SteadyStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SteadyStat& from) {
+    SteadyStat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SteadyStat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.SteadyStat";
+  }
+  protected:
+  explicit SteadyStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWarmupFieldNumber = 1,
+    kTotalFieldNumber = 2,
+    kThroughputFieldNumber = 3,
+    kAverageLatencyFieldNumber = 4,
+    kMaxLatencyFieldNumber = 5,
+    kP50LatencyFieldNumber = 6,
+    kP99LatencyFieldNumber = 7,
+    kP999LatencyFieldNumber = 8,
+  };
+  // double warmup = 1;
+  void clear_warmup();
+  double warmup() const;
+  void set_warmup(double value);
+  private:
+  double _internal_warmup() const;
+  void _internal_set_warmup(double value);
+  public:
+
+  // uint64 total = 2;
+  void clear_total();
+  uint64_t total() const;
+  void set_total(uint64_t value);
+  private:
+  uint64_t _internal_total() const;
+  void _internal_set_total(uint64_t value);
+  public:
+
+  // double throughput = 3;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // double average_latency = 4;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // double max_latency = 5;
+  void clear_max_latency();
+  double max_latency() const;
+  void set_max_latency(double value);
+  private:
+  double _internal_max_latency() const;
+  void _internal_set_max_latency(double value);
+  public:
+
+  // double p50_latency = 6;
+  void clear_p50_latency();
+  double p50_latency() const;
+  void set_p50_latency(double value);
+  private:
+  double _internal_p50_latency() const;
+  void _internal_set_p50_latency(double value);
+  public:
+
+  // double p99_latency = 7;
+  void clear_p99_latency();
+  double p99_latency() const;
+  void set_p99_latency(double value);
+  private:
+  double _internal_p99_latency() const;
+  void _internal_set_p99_latency(double value);
+  public:
+
+  // double p999_latency = 8;
+  void clear_p999_latency();
+  double p999_latency() const;
+  void set_p999_latency(double value);
+  private:
+  double _internal_p999_latency() const;
+  void _internal_set_p999_latency(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.SteadyStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double warmup_;
+    uint64_t total_;
+    double throughput_;
+    double average_latency_;
+    double max_latency_;
+    double p50_latency_;
+    double p99_latency_;
+    double p999_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimelinePoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.TimelinePoint) */ {
+ public:
+  inline TimelinePoint() : TimelinePoint(nullptr) {}
+  ~TimelinePoint() override;
+  explicit PROTOBUF_CONSTEXPR TimelinePoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimelinePoint(const TimelinePoint& from);
+  TimelinePoint(TimelinePoint&& from) noexcept
+    : TimelinePoint() {
+    *this = ::std::move(from);
+  }
+
+  inline TimelinePoint& operator=(const TimelinePoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimelinePoint& operator=(TimelinePoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimelinePoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimelinePoint* internal_default_instance() {
+    return reinterpret_cast<const TimelinePoint*>(
+               &_TimelinePoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TimelinePoint& a, TimelinePoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimelinePoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimelinePoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimelinePoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimelinePoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimelinePoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimelinePoint& from) {
+    TimelinePoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimelinePoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.TimelinePoint";
+  }
+  protected:
+  explicit TimelinePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+    kThroughputFieldNumber = 2,
+    kAverageLatencyFieldNumber = 3,
+    kOpsFieldNumber = 4,
+  };
+  // double time = 1;
+  void clear_time();
+  double time() const;
+  void set_time(double value);
+  private:
+  double _internal_time() const;
+  void _internal_set_time(double value);
+  public:
+
+  // double throughput = 2;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // double average_latency = 3;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // uint64 ops = 4;
+  void clear_ops();
+  uint64_t ops() const;
+  void set_ops(uint64_t value);
+  private:
+  uint64_t _internal_ops() const;
+  void _internal_set_ops(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.TimelinePoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double time_;
+    double throughput_;
+    double average_latency_;
+    uint64_t ops_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.OpStat) */ {
+ public:
+  inline OpStat() : OpStat(nullptr) {}
+  ~OpStat() override;
+  explicit PROTOBUF_CONSTEXPR OpStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpStat(const OpStat& from);
+  OpStat(OpStat&& from) noexcept
+    : OpStat() {
+    *this = ::std::move(from);
+  }
+
+  inline OpStat& operator=(const OpStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpStat& operator=(OpStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OpStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpStat* internal_default_instance() {
+    return reinterpret_cast<const OpStat*>(
+               &_OpStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(OpStat& a, OpStat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OpStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OpStat& from) {
+    OpStat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OpStat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.OpStat";
+  }
+  protected:
+  explicit OpStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOpFieldNumber = 1,
+    kHistogramFieldNumber = 10,
+    kRatioFieldNumber = 2,
+    kTotalFieldNumber = 3,
+    kThroughputFieldNumber = 4,
+    kAverageLatencyFieldNumber = 5,
+    kMaxLatencyFieldNumber = 6,
+    kP50LatencyFieldNumber = 7,
+    kP99LatencyFieldNumber = 8,
+    kP999LatencyFieldNumber = 9,
+  };
+  // string op = 1;
+  void clear_op();
+  const std::string& op() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_op();
+  PROTOBUF_NODISCARD std::string* release_op();
+  void set_allocated_op(std::string* op);
+  private:
+  const std::string& _internal_op() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op(const std::string& value);
+  std::string* _internal_mutable_op();
+  public:
+
+  // .kvbench.LatencyHistogram histogram = 10;
+  bool has_histogram() const;
+  private:
+  bool _internal_has_histogram() const;
+  public:
+  void clear_histogram();
+  const ::kvbench::LatencyHistogram& histogram() const;
+  PROTOBUF_NODISCARD ::kvbench::LatencyHistogram* release_histogram();
+  ::kvbench::LatencyHistogram* mutable_histogram();
+  void set_allocated_histogram(::kvbench::LatencyHistogram* histogram);
+  private:
+  const ::kvbench::LatencyHistogram& _internal_histogram() const;
+  ::kvbench::LatencyHistogram* _internal_mutable_histogram();
+  public:
+  void unsafe_arena_set_allocated_histogram(
+      ::kvbench::LatencyHistogram* histogram);
+  ::kvbench::LatencyHistogram* unsafe_arena_release_histogram();
+
+  // double ratio = 2;
+  void clear_ratio();
+  double ratio() const;
+  void set_ratio(double value);
+  private:
+  double _internal_ratio() const;
+  void _internal_set_ratio(double value);
+  public:
+
+  // uint64 total = 3;
+  void clear_total();
+  uint64_t total() const;
+  void set_total(uint64_t value);
+  private:
+  uint64_t _internal_total() const;
+  void _internal_set_total(uint64_t value);
+  public:
+
+  // double throughput = 4;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // double average_latency = 5;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // double max_latency = 6;
+  void clear_max_latency();
+  double max_latency() const;
+  void set_max_latency(double value);
+  private:
+  double _internal_max_latency() const;
+  void _internal_set_max_latency(double value);
+  public:
+
+  // double p50_latency = 7;
+  void clear_p50_latency();
+  double p50_latency() const;
+  void set_p50_latency(double value);
+  private:
+  double _internal_p50_latency() const;
+  void _internal_set_p50_latency(double value);
+  public:
+
+  // double p99_latency = 8;
+  void clear_p99_latency();
+  double p99_latency() const;
+  void set_p99_latency(double value);
+  private:
+  double _internal_p99_latency() const;
+  void _internal_set_p99_latency(double value);
+  public:
+
+  // double p999_latency = 9;
+  void clear_p999_latency();
+  double p999_latency() const;
+  void set_p999_latency(double value);
+  private:
+  double _internal_p999_latency() const;
+  void _internal_set_p999_latency(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.OpStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_;
+    ::kvbench::LatencyHistogram* histogram_;
+    double ratio_;
+    uint64_t total_;
+    double throughput_;
+    double average_latency_;
+    double max_latency_;
+    double p50_latency_;
+    double p99_latency_;
+    double p999_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RatePoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.RatePoint) */ {
+ public:
+  inline RatePoint() : RatePoint(nullptr) {}
+  ~RatePoint() override;
+  explicit PROTOBUF_CONSTEXPR RatePoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RatePoint(const RatePoint& from);
+  RatePoint(RatePoint&& from) noexcept
+    : RatePoint() {
+    *this = ::std::move(from);
+  }
+
+  inline RatePoint& operator=(const RatePoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RatePoint& operator=(RatePoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RatePoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RatePoint* internal_default_instance() {
+    return reinterpret_cast<const RatePoint*>(
+               &_RatePoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(RatePoint& a, RatePoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RatePoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RatePoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RatePoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RatePoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RatePoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RatePoint& from) {
+    RatePoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RatePoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.RatePoint";
+  }
+  protected:
+  explicit RatePoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOfferedRateFieldNumber = 1,
+    kThroughputFieldNumber = 2,
+    kAverageLatencyFieldNumber = 3,
+    kMaxLatencyFieldNumber = 4,
+    kP50LatencyFieldNumber = 5,
+    kP99LatencyFieldNumber = 6,
+    kP999LatencyFieldNumber = 7,
+  };
+  // double offered_rate = 1;
+  void clear_offered_rate();
+  double offered_rate() const;
+  void set_offered_rate(double value);
+  private:
+  double _internal_offered_rate() const;
+  void _internal_set_offered_rate(double value);
+  public:
+
+  // double throughput = 2;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // double average_latency = 3;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // double max_latency = 4;
+  void clear_max_latency();
+  double max_latency() const;
+  void set_max_latency(double value);
+  private:
+  double _internal_max_latency() const;
+  void _internal_set_max_latency(double value);
+  public:
+
+  // double p50_latency = 5;
+  void clear_p50_latency();
+  double p50_latency() const;
+  void set_p50_latency(double value);
+  private:
+  double _internal_p50_latency() const;
+  void _internal_set_p50_latency(double value);
+  public:
+
+  // double p99_latency = 6;
+  void clear_p99_latency();
+  double p99_latency() const;
+  void set_p99_latency(double value);
+  private:
+  double _internal_p99_latency() const;
+  void _internal_set_p99_latency(double value);
+  public:
+
+  // double p999_latency = 7;
+  void clear_p999_latency();
+  double p999_latency() const;
+  void set_p999_latency(double value);
+  private:
+  double _internal_p999_latency() const;
+  void _internal_set_p999_latency(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.RatePoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double offered_rate_;
+    double throughput_;
+    double average_latency_;
+    double max_latency_;
+    double p50_latency_;
+    double p99_latency_;
+    double p999_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ThreadPoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.ThreadPoint) */ {
+ public:
+  inline ThreadPoint() : ThreadPoint(nullptr) {}
+  ~ThreadPoint() override;
+  explicit PROTOBUF_CONSTEXPR ThreadPoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ThreadPoint(const ThreadPoint& from);
+  ThreadPoint(ThreadPoint&& from) noexcept
+    : ThreadPoint() {
+    *this = ::std::move(from);
+  }
+
+  inline ThreadPoint& operator=(const ThreadPoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ThreadPoint& operator=(ThreadPoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ThreadPoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ThreadPoint* internal_default_instance() {
+    return reinterpret_cast<const ThreadPoint*>(
+               &_ThreadPoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ThreadPoint& a, ThreadPoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ThreadPoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ThreadPoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ThreadPoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ThreadPoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ThreadPoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ThreadPoint& from) {
+    ThreadPoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ThreadPoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.ThreadPoint";
+  }
+  protected:
+  explicit ThreadPoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kThroughputFieldNumber = 2,
+    kSpeedupFieldNumber = 3,
+    kEfficiencyFieldNumber = 4,
+    kAverageLatencyFieldNumber = 5,
+    kP50LatencyFieldNumber = 6,
+    kP99LatencyFieldNumber = 7,
+    kP999LatencyFieldNumber = 8,
+    kThreadsFieldNumber = 1,
+  };
+  // double throughput = 2;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // double speedup = 3;
+  void clear_speedup();
+  double speedup() const;
+  void set_speedup(double value);
+  private:
+  double _internal_speedup() const;
+  void _internal_set_speedup(double value);
+  public:
+
+  // double efficiency = 4;
+  void clear_efficiency();
+  double efficiency() const;
+  void set_efficiency(double value);
+  private:
+  double _internal_efficiency() const;
+  void _internal_set_efficiency(double value);
+  public:
+
+  // double average_latency = 5;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // double p50_latency = 6;
+  void clear_p50_latency();
+  double p50_latency() const;
+  void set_p50_latency(double value);
+  private:
+  double _internal_p50_latency() const;
+  void _internal_set_p50_latency(double value);
+  public:
+
+  // double p99_latency = 7;
+  void clear_p99_latency();
+  double p99_latency() const;
+  void set_p99_latency(double value);
+  private:
+  double _internal_p99_latency() const;
+  void _internal_set_p99_latency(double value);
+  public:
+
+  // double p999_latency = 8;
+  void clear_p999_latency();
+  double p999_latency() const;
+  void set_p999_latency(double value);
+  private:
+  double _internal_p999_latency() const;
+  void _internal_set_p999_latency(double value);
+  public:
+
+  // int32 threads = 1;
+  void clear_threads();
+  int32_t threads() const;
+  void set_threads(int32_t value);
+  private:
+  int32_t _internal_threads() const;
+  void _internal_set_threads(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.ThreadPoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double throughput_;
+    double speedup_;
+    double efficiency_;
+    double average_latency_;
+    double p50_latency_;
+    double p99_latency_;
+    double p999_latency_;
+    int32_t threads_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Stat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.Stat) */ {
+ public:
+  inline Stat() : Stat(nullptr) {}
+  ~Stat() override;
+  explicit PROTOBUF_CONSTEXPR Stat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Stat(const Stat& from);
+  Stat(Stat&& from) noexcept
+    : Stat() {
+    *this = ::std::move(from);
+  }
+
+  inline Stat& operator=(const Stat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Stat& operator=(Stat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stat* internal_default_instance() {
+    return reinterpret_cast<const Stat*>(
+               &_Stat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Stat& a, Stat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Stat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stat& from) {
+    Stat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.Stat";
+  }
+  protected:
+  explicit Stat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatencyFieldNumber = 5,
+    kCpuFieldNumber = 17,
+    kTimelineFieldNumber = 19,
+    kOpStatFieldNumber = 21,
+    kRateCurveFieldNumber = 24,
+    kThreadCurveFieldNumber = 32,
+    kMixFieldNumber = 20,
+    kArrivalFieldNumber = 23,
+    kKeySizeFieldNumber = 29,
+    kValueSizeFieldNumber = 30,
+    kHistogramFieldNumber = 9,
+    kBatchHistogramFieldNumber = 16,
+    kSteadyFieldNumber = 18,
+    kResourceFieldNumber = 36,
+    kKeyHistogramFieldNumber = 38,
+    kDurationFieldNumber = 1,
+    kAverageLatencyFieldNumber = 2,
+    kMaxLatencyFieldNumber = 3,
+    kThroughputFieldNumber = 4,
+    kTotalFieldNumber = 7,
+    kBufferBytesFieldNumber = 8,
+    kP50LatencyFieldNumber = 10,
+    kP90LatencyFieldNumber = 11,
+    kP99LatencyFieldNumber = 12,
+    kP999LatencyFieldNumber = 13,
+    kP9999LatencyFieldNumber = 14,
+    kLatencyBatchFieldNumber = 15,
+    kFailedFieldNumber = 6,
+    kThreadsFieldNumber = 31,
+    kOfferedRateFieldNumber = 22,
+    kScanItemsFieldNumber = 25,
+    kScanItemThroughputFieldNumber = 26,
+    kBatchFieldNumber = 27,
+    kInterleaveFieldNumber = 28,
+    kPhaseEndDurationFieldNumber = 33,
+    kPmemFlushesFieldNumber = 34,
+    kPmemFencesFieldNumber = 35,
+    kKeyAverageLatencyFieldNumber = 37,
+  };
+  // repeated double latency = 5;
+  int latency_size() const;
+  private:
+  int _internal_latency_size() const;
+  public:
+  void clear_latency();
+  private:
+  double _internal_latency(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_latency() const;
+  void _internal_add_latency(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_latency();
+  public:
+  double latency(int index) const;
+  void set_latency(int index, double value);
+  void add_latency(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      latency() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_latency();
+
+  // repeated int32 cpu = 17;
+  int cpu_size() const;
+  private:
+  int _internal_cpu_size() const;
+  public:
+  void clear_cpu();
+  private:
+  int32_t _internal_cpu(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_cpu() const;
+  void _internal_add_cpu(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_cpu();
+  public:
+  int32_t cpu(int index) const;
+  void set_cpu(int index, int32_t value);
+  void add_cpu(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      cpu() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_cpu();
+
+  // repeated .kvbench.TimelinePoint timeline = 19;
+  int timeline_size() const;
+  private:
+  int _internal_timeline_size() const;
+  public:
+  void clear_timeline();
+  ::kvbench::TimelinePoint* mutable_timeline(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::TimelinePoint >*
+      mutable_timeline();
+  private:
+  const ::kvbench::TimelinePoint& _internal_timeline(int index) const;
+  ::kvbench::TimelinePoint* _internal_add_timeline();
+  public:
+  const ::kvbench::TimelinePoint& timeline(int index) const;
+  ::kvbench::TimelinePoint* add_timeline();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::TimelinePoint >&
+      timeline() const;
+
+  // repeated .kvbench.OpStat op_stat = 21;
+  int op_stat_size() const;
+  private:
+  int _internal_op_stat_size() const;
+  public:
+  void clear_op_stat();
+  ::kvbench::OpStat* mutable_op_stat(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::OpStat >*
+      mutable_op_stat();
+  private:
+  const ::kvbench::OpStat& _internal_op_stat(int index) const;
+  ::kvbench::OpStat* _internal_add_op_stat();
+  public:
+  const ::kvbench::OpStat& op_stat(int index) const;
+  ::kvbench::OpStat* add_op_stat();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::OpStat >&
+      op_stat() const;
+
+  // repeated .kvbench.RatePoint rate_curve = 24;
+  int rate_curve_size() const;
+  private:
+  int _internal_rate_curve_size() const;
+  public:
+  void clear_rate_curve();
+  ::kvbench::RatePoint* mutable_rate_curve(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::RatePoint >*
+      mutable_rate_curve();
+  private:
+  const ::kvbench::RatePoint& _internal_rate_curve(int index) const;
+  ::kvbench::RatePoint* _internal_add_rate_curve();
+  public:
+  const ::kvbench::RatePoint& rate_curve(int index) const;
+  ::kvbench::RatePoint* add_rate_curve();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::RatePoint >&
+      rate_curve() const;
+
+  // repeated .kvbench.ThreadPoint thread_curve = 32;
+  int thread_curve_size() const;
+  private:
+  int _internal_thread_curve_size() const;
+  public:
+  void clear_thread_curve();
+  ::kvbench::ThreadPoint* mutable_thread_curve(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::ThreadPoint >*
+      mutable_thread_curve();
+  private:
+  const ::kvbench::ThreadPoint& _internal_thread_curve(int index) const;
+  ::kvbench::ThreadPoint* _internal_add_thread_curve();
+  public:
+  const ::kvbench::ThreadPoint& thread_curve(int index) const;
+  ::kvbench::ThreadPoint* add_thread_curve();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::ThreadPoint >&
+      thread_curve() const;
+
+  // string mix = 20;
+  void clear_mix();
+  const std::string& mix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mix();
+  PROTOBUF_NODISCARD std::string* release_mix();
+  void set_allocated_mix(std::string* mix);
+  private:
+  const std::string& _internal_mix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mix(const std::string& value);
+  std::string* _internal_mutable_mix();
+  public:
+
+  // string arrival = 23;
+  void clear_arrival();
+  const std::string& arrival() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arrival(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arrival();
+  PROTOBUF_NODISCARD std::string* release_arrival();
+  void set_allocated_arrival(std::string* arrival);
+  private:
+  const std::string& _internal_arrival() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arrival(const std::string& value);
+  std::string* _internal_mutable_arrival();
+  public:
+
+  // string key_size = 29;
+  void clear_key_size();
+  const std::string& key_size() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key_size(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key_size();
+  PROTOBUF_NODISCARD std::string* release_key_size();
+  void set_allocated_key_size(std::string* key_size);
+  private:
+  const std::string& _internal_key_size() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key_size(const std::string& value);
+  std::string* _internal_mutable_key_size();
+  public:
+
+  // string value_size = 30;
+  void clear_value_size();
+  const std::string& value_size() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value_size(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value_size();
+  PROTOBUF_NODISCARD std::string* release_value_size();
+  void set_allocated_value_size(std::string* value_size);
+  private:
+  const std::string& _internal_value_size() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value_size(const std::string& value);
+  std::string* _internal_mutable_value_size();
+  public:
+
+  // .kvbench.LatencyHistogram histogram = 9;
+  bool has_histogram() const;
+  private:
+  bool _internal_has_histogram() const;
+  public:
+  void clear_histogram();
+  const ::kvbench::LatencyHistogram& histogram() const;
+  PROTOBUF_NODISCARD ::kvbench::LatencyHistogram* release_histogram();
+  ::kvbench::LatencyHistogram* mutable_histogram();
+  void set_allocated_histogram(::kvbench::LatencyHistogram* histogram);
+  private:
+  const ::kvbench::LatencyHistogram& _internal_histogram() const;
+  ::kvbench::LatencyHistogram* _internal_mutable_histogram();
+  public:
+  void unsafe_arena_set_allocated_histogram(
+      ::kvbench::LatencyHistogram* histogram);
+  ::kvbench::LatencyHistogram* unsafe_arena_release_histogram();
+
+  // .kvbench.LatencyHistogram batch_histogram = 16;
+  bool has_batch_histogram() const;
+  private:
+  bool _internal_has_batch_histogram() const;
+  public:
+  void clear_batch_histogram();
+  const ::kvbench::LatencyHistogram& batch_histogram() const;
+  PROTOBUF_NODISCARD ::kvbench::LatencyHistogram* release_batch_histogram();
+  ::kvbench::LatencyHistogram* mutable_batch_histogram();
+  void set_allocated_batch_histogram(::kvbench::LatencyHistogram* batch_histogram);
+  private:
+  const ::kvbench::LatencyHistogram& _internal_batch_histogram() const;
+  ::kvbench::LatencyHistogram* _internal_mutable_batch_histogram();
+  public:
+  void unsafe_arena_set_allocated_batch_histogram(
+      ::kvbench::LatencyHistogram* batch_histogram);
+  ::kvbench::LatencyHistogram* unsafe_arena_release_batch_histogram();
+
+  // .kvbench.SteadyStat steady = 18;
+  bool has_steady() const;
+  private:
+  bool _internal_has_steady() const;
+  public:
+  void clear_steady();
+  const ::kvbench::SteadyStat& steady() const;
+  PROTOBUF_NODISCARD ::kvbench::SteadyStat* release_steady();
+  ::kvbench::SteadyStat* mutable_steady();
+  void set_allocated_steady(::kvbench::SteadyStat* steady);
+  private:
+  const ::kvbench::SteadyStat& _internal_steady() const;
+  ::kvbench::SteadyStat* _internal_mutable_steady();
+  public:
+  void unsafe_arena_set_allocated_steady(
+      ::kvbench::SteadyStat* steady);
+  ::kvbench::SteadyStat* unsafe_arena_release_steady();
+
+  // .kvbench.ResourceStat resource = 36;
+  bool has_resource() const;
+  private:
+  bool _internal_has_resource() const;
+  public:
+  void clear_resource();
+  const ::kvbench::ResourceStat& resource() const;
+  PROTOBUF_NODISCARD ::kvbench::ResourceStat* release_resource();
+  ::kvbench::ResourceStat* mutable_resource();
+  void set_allocated_resource(::kvbench::ResourceStat* resource);
+  private:
+  const ::kvbench::ResourceStat& _internal_resource() const;
+  ::kvbench::ResourceStat* _internal_mutable_resource();
+  public:
+  void unsafe_arena_set_allocated_resource(
+      ::kvbench::ResourceStat* resource);
+  ::kvbench::ResourceStat* unsafe_arena_release_resource();
+
+  // .kvbench.LatencyHistogram key_histogram = 38;
+  bool has_key_histogram() const;
+  private:
+  bool _internal_has_key_histogram() const;
+  public:
+  void clear_key_histogram();
+  const ::kvbench::LatencyHistogram& key_histogram() const;
+  PROTOBUF_NODISCARD ::kvbench::LatencyHistogram* release_key_histogram();
+  ::kvbench::LatencyHistogram* mutable_key_histogram();
+  void set_allocated_key_histogram(::kvbench::LatencyHistogram* key_histogram);
+  private:
+  const ::kvbench::LatencyHistogram& _internal_key_histogram() const;
+  ::kvbench::LatencyHistogram* _internal_mutable_key_histogram();
+  public:
+  void unsafe_arena_set_allocated_key_histogram(
+      ::kvbench::LatencyHistogram* key_histogram);
+  ::kvbench::LatencyHistogram* unsafe_arena_release_key_histogram();
+
+  // double duration = 1;
+  void clear_duration();
+  double duration() const;
+  void set_duration(double value);
+  private:
+  double _internal_duration() const;
+  void _internal_set_duration(double value);
+  public:
+
+  // double average_latency = 2;
+  void clear_average_latency();
+  double average_latency() const;
+  void set_average_latency(double value);
+  private:
+  double _internal_average_latency() const;
+  void _internal_set_average_latency(double value);
+  public:
+
+  // double max_latency = 3;
+  void clear_max_latency();
+  double max_latency() const;
+  void set_max_latency(double value);
+  private:
+  double _internal_max_latency() const;
+  void _internal_set_max_latency(double value);
+  public:
+
+  // double throughput = 4;
+  void clear_throughput();
+  double throughput() const;
+  void set_throughput(double value);
+  private:
+  double _internal_throughput() const;
+  void _internal_set_throughput(double value);
+  public:
+
+  // int64 total = 7;
+  void clear_total();
+  int64_t total() const;
+  void set_total(int64_t value);
+  private:
+  int64_t _internal_total() const;
+  void _internal_set_total(int64_t value);
+  public:
+
+  // uint64 buffer_bytes = 8;
+  void clear_buffer_bytes();
+  uint64_t buffer_bytes() const;
+  void set_buffer_bytes(uint64_t value);
+  private:
+  uint64_t _internal_buffer_bytes() const;
+  void _internal_set_buffer_bytes(uint64_t value);
+  public:
+
+  // double p50_latency = 10;
+  void clear_p50_latency();
+  double p50_latency() const;
+  void set_p50_latency(double value);
+  private:
+  double _internal_p50_latency() const;
+  void _internal_set_p50_latency(double value);
+  public:
+
+  // double p90_latency = 11;
+  void clear_p90_latency();
+  double p90_latency() const;
+  void set_p90_latency(double value);
+  private:
+  double _internal_p90_latency() const;
+  void _internal_set_p90_latency(double value);
+  public:
+
+  // double p99_latency = 12;
+  void clear_p99_latency();
+  double p99_latency() const;
+  void set_p99_latency(double value);
+  private:
+  double _internal_p99_latency() const;
+  void _internal_set_p99_latency(double value);
+  public:
+
+  // double p999_latency = 13;
+  void clear_p999_latency();
+  double p999_latency() const;
+  void set_p999_latency(double value);
+  private:
+  double _internal_p999_latency() const;
+  void _internal_set_p999_latency(double value);
+  public:
+
+  // double p9999_latency = 14;
+  void clear_p9999_latency();
+  double p9999_latency() const;
+  void set_p9999_latency(double value);
+  private:
+  double _internal_p9999_latency() const;
+  void _internal_set_p9999_latency(double value);
+  public:
+
+  // uint64 latency_batch = 15;
+  void clear_latency_batch();
+  uint64_t latency_batch() const;
+  void set_latency_batch(uint64_t value);
+  private:
+  uint64_t _internal_latency_batch() const;
+  void _internal_set_latency_batch(uint64_t value);
+  public:
+
+  // int32 failed = 6;
+  void clear_failed();
+  int32_t failed() const;
+  void set_failed(int32_t value);
+  private:
+  int32_t _internal_failed() const;
+  void _internal_set_failed(int32_t value);
+  public:
+
+  // int32 threads = 31;
+  void clear_threads();
+  int32_t threads() const;
+  void set_threads(int32_t value);
+  private:
+  int32_t _internal_threads() const;
+  void _internal_set_threads(int32_t value);
+  public:
+
+  // double offered_rate = 22;
+  void clear_offered_rate();
+  double offered_rate() const;
+  void set_offered_rate(double value);
+  private:
+  double _internal_offered_rate() const;
+  void _internal_set_offered_rate(double value);
+  public:
+
+  // uint64 scan_items = 25;
+  void clear_scan_items();
+  uint64_t scan_items() const;
+  void set_scan_items(uint64_t value);
+  private:
+  uint64_t _internal_scan_items() const;
+  void _internal_set_scan_items(uint64_t value);
+  public:
+
+  // double scan_item_throughput = 26;
+  void clear_scan_item_throughput();
+  double scan_item_throughput() const;
+  void set_scan_item_throughput(double value);
+  private:
+  double _internal_scan_item_throughput() const;
+  void _internal_set_scan_item_throughput(double value);
+  public:
+
+  // uint64 batch = 27;
+  void clear_batch();
+  uint64_t batch() const;
+  void set_batch(uint64_t value);
+  private:
+  uint64_t _internal_batch() const;
+  void _internal_set_batch(uint64_t value);
+  public:
+
+  // uint64 interleave = 28;
+  void clear_interleave();
+  uint64_t interleave() const;
+  void set_interleave(uint64_t value);
+  private:
+  uint64_t _internal_interleave() const;
+  void _internal_set_interleave(uint64_t value);
+  public:
+
+  // double phase_end_duration = 33;
+  void clear_phase_end_duration();
+  double phase_end_duration() const;
+  void set_phase_end_duration(double value);
+  private:
+  double _internal_phase_end_duration() const;
+  void _internal_set_phase_end_duration(double value);
+  public:
+
+  // uint64 pmem_flushes = 34;
+  void clear_pmem_flushes();
+  uint64_t pmem_flushes() const;
+  void set_pmem_flushes(uint64_t value);
+  private:
+  uint64_t _internal_pmem_flushes() const;
+  void _internal_set_pmem_flushes(uint64_t value);
+  public:
+
+  // uint64 pmem_fences = 35;
+  void clear_pmem_fences();
+  uint64_t pmem_fences() const;
+  void set_pmem_fences(uint64_t value);
+  private:
+  uint64_t _internal_pmem_fences() const;
+  void _internal_set_pmem_fences(uint64_t value);
+  public:
+
+  // double key_average_latency = 37;
+  void clear_key_average_latency();
+  double key_average_latency() const;
+  void set_key_average_latency(double value);
+  private:
+  double _internal_key_average_latency() const;
+  void _internal_set_key_average_latency(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.Stat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > latency_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > cpu_;
+    mutable std::atomic<int> _cpu_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::TimelinePoint > timeline_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::OpStat > op_stat_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::RatePoint > rate_curve_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::ThreadPoint > thread_curve_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arrival_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_size_;
+    ::kvbench::LatencyHistogram* histogram_;
+    ::kvbench::LatencyHistogram* batch_histogram_;
+    ::kvbench::SteadyStat* steady_;
+    ::kvbench::ResourceStat* resource_;
+    ::kvbench::LatencyHistogram* key_histogram_;
+    double duration_;
+    double average_latency_;
+    double max_latency_;
+    double throughput_;
+    int64_t total_;
+    uint64_t buffer_bytes_;
+    double p50_latency_;
+    double p90_latency_;
+    double p99_latency_;
+    double p999_latency_;
+    double p9999_latency_;
+    uint64_t latency_batch_;
+    int32_t failed_;
+    int32_t threads_;
+    double offered_rate_;
+    uint64_t scan_items_;
+    double scan_item_throughput_;
+    uint64_t batch_;
+    uint64_t interleave_;
+    double phase_end_duration_;
+    uint64_t pmem_flushes_;
+    uint64_t pmem_fences_;
+    double key_average_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Stats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kvbench.Stats) */ {
+ public:
+  inline Stats() : Stats(nullptr) {}
+  ~Stats() override;
+  explicit PROTOBUF_CONSTEXPR Stats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Stats(const Stats& from);
+  Stats(Stats&& from) noexcept
+    : Stats() {
+    *this = ::std::move(from);
+  }
+
+  inline Stats& operator=(const Stats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Stats& operator=(Stats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stats* internal_default_instance() {
+    return reinterpret_cast<const Stats*>(
+               &_Stats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Stats& a, Stats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Stats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stats& from) {
+    Stats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kvbench.Stats";
+  }
+  protected:
+  explicit Stats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatFieldNumber = 1,
+    kClockSourceFieldNumber = 3,
+    kNumaPolicyFieldNumber = 6,
+    kMemPolicyFieldNumber = 7,
+    kPmemDirFieldNumber = 8,
+    kSeedFieldNumber = 2,
+    kClockFrequencyFieldNumber = 4,
+    kTimerOverheadFieldNumber = 5,
+    kPmemFlushLatencyFieldNumber = 9,
+    kPmemFenceLatencyFieldNumber = 10,
+  };
+  // repeated .kvbench.Stat stat = 1;
+  int stat_size() const;
+  private:
+  int _internal_stat_size() const;
+  public:
+  void clear_stat();
+  ::kvbench::Stat* mutable_stat(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::Stat >*
+      mutable_stat();
+  private:
+  const ::kvbench::Stat& _internal_stat(int index) const;
+  ::kvbench::Stat* _internal_add_stat();
+  public:
+  const ::kvbench::Stat& stat(int index) const;
+  ::kvbench::Stat* add_stat();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::Stat >&
+      stat() const;
+
+  // string clock_source = 3;
+  void clear_clock_source();
+  const std::string& clock_source() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clock_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clock_source();
+  PROTOBUF_NODISCARD std::string* release_clock_source();
+  void set_allocated_clock_source(std::string* clock_source);
+  private:
+  const std::string& _internal_clock_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clock_source(const std::string& value);
+  std::string* _internal_mutable_clock_source();
+  public:
+
+  // string numa_policy = 6;
+  void clear_numa_policy();
+  const std::string& numa_policy() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_numa_policy(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_numa_policy();
+  PROTOBUF_NODISCARD std::string* release_numa_policy();
+  void set_allocated_numa_policy(std::string* numa_policy);
+  private:
+  const std::string& _internal_numa_policy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_numa_policy(const std::string& value);
+  std::string* _internal_mutable_numa_policy();
+  public:
+
+  // string mem_policy = 7;
+  void clear_mem_policy();
+  const std::string& mem_policy() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_mem_policy(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mem_policy();
+  PROTOBUF_NODISCARD std::string* release_mem_policy();
+  void set_allocated_mem_policy(std::string* mem_policy);
+  private:
+  const std::string& _internal_mem_policy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mem_policy(const std::string& value);
+  std::string* _internal_mutable_mem_policy();
+  public:
+
+  // string pmem_dir = 8;
+  void clear_pmem_dir();
+  const std::string& pmem_dir() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pmem_dir(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pmem_dir();
+  PROTOBUF_NODISCARD std::string* release_pmem_dir();
+  void set_allocated_pmem_dir(std::string* pmem_dir);
+  private:
+  const std::string& _internal_pmem_dir() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pmem_dir(const std::string& value);
+  std::string* _internal_mutable_pmem_dir();
+  public:
+
+  // uint64 seed = 2;
+  void clear_seed();
+  uint64_t seed() const;
+  void set_seed(uint64_t value);
+  private:
+  uint64_t _internal_seed() const;
+  void _internal_set_seed(uint64_t value);
+  public:
+
+  // double clock_frequency = 4;
+  void clear_clock_frequency();
+  double clock_frequency() const;
+  void set_clock_frequency(double value);
+  private:
+  double _internal_clock_frequency() const;
+  void _internal_set_clock_frequency(double value);
+  public:
+
+  // double timer_overhead = 5;
+  void clear_timer_overhead();
+  double timer_overhead() const;
+  void set_timer_overhead(double value);
+  private:
+  double _internal_timer_overhead() const;
+  void _internal_set_timer_overhead(double value);
+  public:
+
+  // double pmem_flush_latency = 9;
+  void clear_pmem_flush_latency();
+  double pmem_flush_latency() const;
+  void set_pmem_flush_latency(double value);
+  private:
+  double _internal_pmem_flush_latency() const;
+  void _internal_set_pmem_flush_latency(double value);
+  public:
+
+  // double pmem_fence_latency = 10;
+  void clear_pmem_fence_latency();
+  double pmem_fence_latency() const;
+  void set_pmem_fence_latency(double value);
+  private:
+  double _internal_pmem_fence_latency() const;
+  void _internal_set_pmem_fence_latency(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kvbench.Stats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::Stat > stat_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clock_source_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr numa_policy_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mem_policy_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pmem_dir_;
+    uint64_t seed_;
+    double clock_frequency_;
+    double timer_overhead_;
+    double pmem_flush_latency_;
+    double pmem_fence_latency_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvbench_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LatencyHistogram
+
+// int32 sub_bucket_bits = 1;
+inline void LatencyHistogram::clear_sub_bucket_bits() {
+  _impl_.sub_bucket_bits_ = 0;
+}
+inline int32_t LatencyHistogram::_internal_sub_bucket_bits() const {
+  return _impl_.sub_bucket_bits_;
+}
+inline int32_t LatencyHistogram::sub_bucket_bits() const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.sub_bucket_bits)
+  return _internal_sub_bucket_bits();
+}
+inline void LatencyHistogram::_internal_set_sub_bucket_bits(int32_t value) {
+  
+  _impl_.sub_bucket_bits_ = value;
+}
+inline void LatencyHistogram::set_sub_bucket_bits(int32_t value) {
+  _internal_set_sub_bucket_bits(value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.sub_bucket_bits)
+}
+
+// uint64 count = 2;
+inline void LatencyHistogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencyHistogram::count() const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.count)
+  return _internal_count();
+}
+inline void LatencyHistogram::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencyHistogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.count)
+}
+
+// uint64 sum = 3;
+inline void LatencyHistogram::clear_sum() {
+  _impl_.sum_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline uint64_t LatencyHistogram::sum() const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.sum)
+  return _internal_sum();
+}
+inline void LatencyHistogram::_internal_set_sum(uint64_t value) {
+  
+  _impl_.sum_ = value;
+}
+inline void LatencyHistogram::set_sum(uint64_t value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.sum)
+}
+
+// uint64 min = 4;
+inline void LatencyHistogram::clear_min() {
+  _impl_.min_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_min() const {
+  return _impl_.min_;
+}
+inline uint64_t LatencyHistogram::min() const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.min)
+  return _internal_min();
+}
+inline void LatencyHistogram::_internal_set_min(uint64_t value) {
+  
+  _impl_.min_ = value;
+}
+inline void LatencyHistogram::set_min(uint64_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.min)
+}
+
+// uint64 max = 5;
+inline void LatencyHistogram::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t LatencyHistogram::max() const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.max)
+  return _internal_max();
+}
+inline void LatencyHistogram::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void LatencyHistogram::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.max)
+}
+
+// repeated uint32 index = 6;
+inline int LatencyHistogram::_internal_index_size() const {
+  return _impl_.index_.size();
+}
+inline int LatencyHistogram::index_size() const {
+  return _internal_index_size();
+}
+inline void LatencyHistogram::clear_index() {
+  _impl_.index_.Clear();
+}
+inline uint32_t LatencyHistogram::_internal_index(int index) const {
+  return _impl_.index_.Get(index);
+}
+inline uint32_t LatencyHistogram::index(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.index)
+  return _internal_index(index);
+}
+inline void LatencyHistogram::set_index(int index, uint32_t value) {
+  _impl_.index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.index)
+}
+inline void LatencyHistogram::_internal_add_index(uint32_t value) {
+  _impl_.index_.Add(value);
+}
+inline void LatencyHistogram::add_index(uint32_t value) {
+  _internal_add_index(value);
+  // @@protoc_insertion_point(field_add:kvbench.LatencyHistogram.index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LatencyHistogram::_internal_index() const {
+  return _impl_.index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LatencyHistogram::index() const {
+  // @@protoc_insertion_point(field_list:kvbench.LatencyHistogram.index)
+  return _internal_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LatencyHistogram::_internal_mutable_index() {
+  return &_impl_.index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LatencyHistogram::mutable_index() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.LatencyHistogram.index)
+  return _internal_mutable_index();
+}
+
+// repeated uint64 bucket_count = 7;
+inline int LatencyHistogram::_internal_bucket_count_size() const {
+  return _impl_.bucket_count_.size();
+}
+inline int LatencyHistogram::bucket_count_size() const {
+  return _internal_bucket_count_size();
+}
+inline void LatencyHistogram::clear_bucket_count() {
+  _impl_.bucket_count_.Clear();
+}
+inline uint64_t LatencyHistogram::_internal_bucket_count(int index) const {
+  return _impl_.bucket_count_.Get(index);
+}
+inline uint64_t LatencyHistogram::bucket_count(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.LatencyHistogram.bucket_count)
+  return _internal_bucket_count(index);
+}
+inline void LatencyHistogram::set_bucket_count(int index, uint64_t value) {
+  _impl_.bucket_count_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvbench.LatencyHistogram.bucket_count)
+}
+inline void LatencyHistogram::_internal_add_bucket_count(uint64_t value) {
+  _impl_.bucket_count_.Add(value);
+}
+inline void LatencyHistogram::add_bucket_count(uint64_t value) {
+  _internal_add_bucket_count(value);
+  // @@protoc_insertion_point(field_add:kvbench.LatencyHistogram.bucket_count)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LatencyHistogram::_internal_bucket_count() const {
+  return _impl_.bucket_count_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+LatencyHistogram::bucket_count() const {
+  // @@protoc_insertion_point(field_list:kvbench.LatencyHistogram.bucket_count)
+  return _internal_bucket_count();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LatencyHistogram::_internal_mutable_bucket_count() {
+  return &_impl_.bucket_count_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+LatencyHistogram::mutable_bucket_count() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.LatencyHistogram.bucket_count)
+  return _internal_mutable_bucket_count();
+}
+
+// -------------------------------------------------------------------
+
+// ResourceStat
+
+// double user_time = 1;
+inline void ResourceStat::clear_user_time() {
+  _impl_.user_time_ = 0;
+}
+inline double ResourceStat::_internal_user_time() const {
+  return _impl_.user_time_;
+}
+inline double ResourceStat::user_time() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.user_time)
+  return _internal_user_time();
+}
+inline void ResourceStat::_internal_set_user_time(double value) {
+  
+  _impl_.user_time_ = value;
+}
+inline void ResourceStat::set_user_time(double value) {
+  _internal_set_user_time(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.user_time)
+}
+
+// double sys_time = 2;
+inline void ResourceStat::clear_sys_time() {
+  _impl_.sys_time_ = 0;
+}
+inline double ResourceStat::_internal_sys_time() const {
+  return _impl_.sys_time_;
+}
+inline double ResourceStat::sys_time() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.sys_time)
+  return _internal_sys_time();
+}
+inline void ResourceStat::_internal_set_sys_time(double value) {
+  
+  _impl_.sys_time_ = value;
+}
+inline void ResourceStat::set_sys_time(double value) {
+  _internal_set_sys_time(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.sys_time)
+}
+
+// uint64 minor_faults = 3;
+inline void ResourceStat::clear_minor_faults() {
+  _impl_.minor_faults_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_minor_faults() const {
+  return _impl_.minor_faults_;
+}
+inline uint64_t ResourceStat::minor_faults() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.minor_faults)
+  return _internal_minor_faults();
+}
+inline void ResourceStat::_internal_set_minor_faults(uint64_t value) {
+  
+  _impl_.minor_faults_ = value;
+}
+inline void ResourceStat::set_minor_faults(uint64_t value) {
+  _internal_set_minor_faults(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.minor_faults)
+}
+
+// uint64 major_faults = 4;
+inline void ResourceStat::clear_major_faults() {
+  _impl_.major_faults_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_major_faults() const {
+  return _impl_.major_faults_;
+}
+inline uint64_t ResourceStat::major_faults() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.major_faults)
+  return _internal_major_faults();
+}
+inline void ResourceStat::_internal_set_major_faults(uint64_t value) {
+  
+  _impl_.major_faults_ = value;
+}
+inline void ResourceStat::set_major_faults(uint64_t value) {
+  _internal_set_major_faults(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.major_faults)
+}
+
+// uint64 voluntary_switches = 5;
+inline void ResourceStat::clear_voluntary_switches() {
+  _impl_.voluntary_switches_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_voluntary_switches() const {
+  return _impl_.voluntary_switches_;
+}
+inline uint64_t ResourceStat::voluntary_switches() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.voluntary_switches)
+  return _internal_voluntary_switches();
+}
+inline void ResourceStat::_internal_set_voluntary_switches(uint64_t value) {
+  
+  _impl_.voluntary_switches_ = value;
+}
+inline void ResourceStat::set_voluntary_switches(uint64_t value) {
+  _internal_set_voluntary_switches(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.voluntary_switches)
+}
+
+// uint64 involuntary_switches = 6;
+inline void ResourceStat::clear_involuntary_switches() {
+  _impl_.involuntary_switches_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_involuntary_switches() const {
+  return _impl_.involuntary_switches_;
+}
+inline uint64_t ResourceStat::involuntary_switches() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.involuntary_switches)
+  return _internal_involuntary_switches();
+}
+inline void ResourceStat::_internal_set_involuntary_switches(uint64_t value) {
+  
+  _impl_.involuntary_switches_ = value;
+}
+inline void ResourceStat::set_involuntary_switches(uint64_t value) {
+  _internal_set_involuntary_switches(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.involuntary_switches)
+}
+
+// uint64 rss_begin = 7;
+inline void ResourceStat::clear_rss_begin() {
+  _impl_.rss_begin_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_rss_begin() const {
+  return _impl_.rss_begin_;
+}
+inline uint64_t ResourceStat::rss_begin() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.rss_begin)
+  return _internal_rss_begin();
+}
+inline void ResourceStat::_internal_set_rss_begin(uint64_t value) {
+  
+  _impl_.rss_begin_ = value;
+}
+inline void ResourceStat::set_rss_begin(uint64_t value) {
+  _internal_set_rss_begin(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.rss_begin)
+}
+
+// uint64 rss_end = 8;
+inline void ResourceStat::clear_rss_end() {
+  _impl_.rss_end_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_rss_end() const {
+  return _impl_.rss_end_;
+}
+inline uint64_t ResourceStat::rss_end() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.rss_end)
+  return _internal_rss_end();
+}
+inline void ResourceStat::_internal_set_rss_end(uint64_t value) {
+  
+  _impl_.rss_end_ = value;
+}
+inline void ResourceStat::set_rss_end(uint64_t value) {
+  _internal_set_rss_end(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.rss_end)
+}
+
+// uint64 rss_peak = 9;
+inline void ResourceStat::clear_rss_peak() {
+  _impl_.rss_peak_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_rss_peak() const {
+  return _impl_.rss_peak_;
+}
+inline uint64_t ResourceStat::rss_peak() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.rss_peak)
+  return _internal_rss_peak();
+}
+inline void ResourceStat::_internal_set_rss_peak(uint64_t value) {
+  
+  _impl_.rss_peak_ = value;
+}
+inline void ResourceStat::set_rss_peak(uint64_t value) {
+  _internal_set_rss_peak(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.rss_peak)
+}
+
+// uint64 live_keys = 10;
+inline void ResourceStat::clear_live_keys() {
+  _impl_.live_keys_ = uint64_t{0u};
+}
+inline uint64_t ResourceStat::_internal_live_keys() const {
+  return _impl_.live_keys_;
+}
+inline uint64_t ResourceStat::live_keys() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.live_keys)
+  return _internal_live_keys();
+}
+inline void ResourceStat::_internal_set_live_keys(uint64_t value) {
+  
+  _impl_.live_keys_ = value;
+}
+inline void ResourceStat::set_live_keys(uint64_t value) {
+  _internal_set_live_keys(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.live_keys)
+}
+
+// double bytes_per_key = 11;
+inline void ResourceStat::clear_bytes_per_key() {
+  _impl_.bytes_per_key_ = 0;
+}
+inline double ResourceStat::_internal_bytes_per_key() const {
+  return _impl_.bytes_per_key_;
+}
+inline double ResourceStat::bytes_per_key() const {
+  // @@protoc_insertion_point(field_get:kvbench.ResourceStat.bytes_per_key)
+  return _internal_bytes_per_key();
+}
+inline void ResourceStat::_internal_set_bytes_per_key(double value) {
+  
+  _impl_.bytes_per_key_ = value;
+}
+inline void ResourceStat::set_bytes_per_key(double value) {
+  _internal_set_bytes_per_key(value);
+  // @@protoc_insertion_point(field_set:kvbench.ResourceStat.bytes_per_key)
+}
+
+// -------------------------------------------------------------------
+
+// SteadyStat
+
+// double warmup = 1;
+inline void SteadyStat::clear_warmup() {
+  _impl_.warmup_ = 0;
+}
+inline double SteadyStat::_internal_warmup() const {
+  return _impl_.warmup_;
+}
+inline double SteadyStat::warmup() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.warmup)
+  return _internal_warmup();
+}
+inline void SteadyStat::_internal_set_warmup(double value) {
+  
+  _impl_.warmup_ = value;
+}
+inline void SteadyStat::set_warmup(double value) {
+  _internal_set_warmup(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.warmup)
+}
+
+// uint64 total = 2;
+inline void SteadyStat::clear_total() {
+  _impl_.total_ = uint64_t{0u};
+}
+inline uint64_t SteadyStat::_internal_total() const {
+  return _impl_.total_;
+}
+inline uint64_t SteadyStat::total() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.total)
+  return _internal_total();
+}
+inline void SteadyStat::_internal_set_total(uint64_t value) {
+  
+  _impl_.total_ = value;
+}
+inline void SteadyStat::set_total(uint64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.total)
+}
+
+// double throughput = 3;
+inline void SteadyStat::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double SteadyStat::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double SteadyStat::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.throughput)
+  return _internal_throughput();
+}
+inline void SteadyStat::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void SteadyStat::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.throughput)
+}
+
+// double average_latency = 4;
+inline void SteadyStat::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double SteadyStat::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double SteadyStat::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.average_latency)
+  return _internal_average_latency();
+}
+inline void SteadyStat::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void SteadyStat::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.average_latency)
+}
+
+// double max_latency = 5;
+inline void SteadyStat::clear_max_latency() {
+  _impl_.max_latency_ = 0;
+}
+inline double SteadyStat::_internal_max_latency() const {
+  return _impl_.max_latency_;
+}
+inline double SteadyStat::max_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.max_latency)
+  return _internal_max_latency();
+}
+inline void SteadyStat::_internal_set_max_latency(double value) {
+  
+  _impl_.max_latency_ = value;
+}
+inline void SteadyStat::set_max_latency(double value) {
+  _internal_set_max_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.max_latency)
+}
+
+// double p50_latency = 6;
+inline void SteadyStat::clear_p50_latency() {
+  _impl_.p50_latency_ = 0;
+}
+inline double SteadyStat::_internal_p50_latency() const {
+  return _impl_.p50_latency_;
+}
+inline double SteadyStat::p50_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.p50_latency)
+  return _internal_p50_latency();
+}
+inline void SteadyStat::_internal_set_p50_latency(double value) {
+  
+  _impl_.p50_latency_ = value;
+}
+inline void SteadyStat::set_p50_latency(double value) {
+  _internal_set_p50_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.p50_latency)
+}
+
+// double p99_latency = 7;
+inline void SteadyStat::clear_p99_latency() {
+  _impl_.p99_latency_ = 0;
+}
+inline double SteadyStat::_internal_p99_latency() const {
+  return _impl_.p99_latency_;
+}
+inline double SteadyStat::p99_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.p99_latency)
+  return _internal_p99_latency();
+}
+inline void SteadyStat::_internal_set_p99_latency(double value) {
+  
+  _impl_.p99_latency_ = value;
+}
+inline void SteadyStat::set_p99_latency(double value) {
+  _internal_set_p99_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.p99_latency)
+}
+
+// double p999_latency = 8;
+inline void SteadyStat::clear_p999_latency() {
+  _impl_.p999_latency_ = 0;
+}
+inline double SteadyStat::_internal_p999_latency() const {
+  return _impl_.p999_latency_;
+}
+inline double SteadyStat::p999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.SteadyStat.p999_latency)
+  return _internal_p999_latency();
+}
+inline void SteadyStat::_internal_set_p999_latency(double value) {
+  
+  _impl_.p999_latency_ = value;
+}
+inline void SteadyStat::set_p999_latency(double value) {
+  _internal_set_p999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.SteadyStat.p999_latency)
+}
+
+// -------------------------------------------------------------------
+
+// TimelinePoint
+
+// double time = 1;
+inline void TimelinePoint::clear_time() {
+  _impl_.time_ = 0;
+}
+inline double TimelinePoint::_internal_time() const {
+  return _impl_.time_;
+}
+inline double TimelinePoint::time() const {
+  // @@protoc_insertion_point(field_get:kvbench.TimelinePoint.time)
+  return _internal_time();
+}
+inline void TimelinePoint::_internal_set_time(double value) {
+  
+  _impl_.time_ = value;
+}
+inline void TimelinePoint::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:kvbench.TimelinePoint.time)
+}
+
+// double throughput = 2;
+inline void TimelinePoint::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double TimelinePoint::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double TimelinePoint::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.TimelinePoint.throughput)
+  return _internal_throughput();
+}
+inline void TimelinePoint::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void TimelinePoint::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.TimelinePoint.throughput)
+}
+
+// double average_latency = 3;
+inline void TimelinePoint::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double TimelinePoint::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double TimelinePoint::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.TimelinePoint.average_latency)
+  return _internal_average_latency();
+}
+inline void TimelinePoint::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void TimelinePoint::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.TimelinePoint.average_latency)
+}
+
+// uint64 ops = 4;
+inline void TimelinePoint::clear_ops() {
+  _impl_.ops_ = uint64_t{0u};
+}
+inline uint64_t TimelinePoint::_internal_ops() const {
+  return _impl_.ops_;
+}
+inline uint64_t TimelinePoint::ops() const {
+  // @@protoc_insertion_point(field_get:kvbench.TimelinePoint.ops)
+  return _internal_ops();
+}
+inline void TimelinePoint::_internal_set_ops(uint64_t value) {
+  
+  _impl_.ops_ = value;
+}
+inline void TimelinePoint::set_ops(uint64_t value) {
+  _internal_set_ops(value);
+  // @@protoc_insertion_point(field_set:kvbench.TimelinePoint.ops)
+}
+
+// -------------------------------------------------------------------
+
+// OpStat
+
+// string op = 1;
+inline void OpStat::clear_op() {
+  _impl_.op_.ClearToEmpty();
+}
+inline const std::string& OpStat::op() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.op)
+  return _internal_op();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpStat::set_op(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.op_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.op)
+}
+inline std::string* OpStat::mutable_op() {
+  std::string* _s = _internal_mutable_op();
+  // @@protoc_insertion_point(field_mutable:kvbench.OpStat.op)
+  return _s;
+}
+inline const std::string& OpStat::_internal_op() const {
+  return _impl_.op_.Get();
+}
+inline void OpStat::_internal_set_op(const std::string& value) {
+  
+  _impl_.op_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpStat::_internal_mutable_op() {
+  
+  return _impl_.op_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpStat::release_op() {
+  // @@protoc_insertion_point(field_release:kvbench.OpStat.op)
+  return _impl_.op_.Release();
+}
+inline void OpStat::set_allocated_op(std::string* op) {
+  if (op != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.op_.SetAllocated(op, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_.IsDefault()) {
+    _impl_.op_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.OpStat.op)
+}
+
+// double ratio = 2;
+inline void OpStat::clear_ratio() {
+  _impl_.ratio_ = 0;
+}
+inline double OpStat::_internal_ratio() const {
+  return _impl_.ratio_;
+}
+inline double OpStat::ratio() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.ratio)
+  return _internal_ratio();
+}
+inline void OpStat::_internal_set_ratio(double value) {
+  
+  _impl_.ratio_ = value;
+}
+inline void OpStat::set_ratio(double value) {
+  _internal_set_ratio(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.ratio)
+}
+
+// uint64 total = 3;
+inline void OpStat::clear_total() {
+  _impl_.total_ = uint64_t{0u};
+}
+inline uint64_t OpStat::_internal_total() const {
+  return _impl_.total_;
+}
+inline uint64_t OpStat::total() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.total)
+  return _internal_total();
+}
+inline void OpStat::_internal_set_total(uint64_t value) {
+  
+  _impl_.total_ = value;
+}
+inline void OpStat::set_total(uint64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.total)
+}
+
+// double throughput = 4;
+inline void OpStat::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double OpStat::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double OpStat::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.throughput)
+  return _internal_throughput();
+}
+inline void OpStat::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void OpStat::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.throughput)
+}
+
+// double average_latency = 5;
+inline void OpStat::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double OpStat::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double OpStat::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.average_latency)
+  return _internal_average_latency();
+}
+inline void OpStat::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void OpStat::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.average_latency)
+}
+
+// double max_latency = 6;
+inline void OpStat::clear_max_latency() {
+  _impl_.max_latency_ = 0;
+}
+inline double OpStat::_internal_max_latency() const {
+  return _impl_.max_latency_;
+}
+inline double OpStat::max_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.max_latency)
+  return _internal_max_latency();
+}
+inline void OpStat::_internal_set_max_latency(double value) {
+  
+  _impl_.max_latency_ = value;
+}
+inline void OpStat::set_max_latency(double value) {
+  _internal_set_max_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.max_latency)
+}
+
+// double p50_latency = 7;
+inline void OpStat::clear_p50_latency() {
+  _impl_.p50_latency_ = 0;
+}
+inline double OpStat::_internal_p50_latency() const {
+  return _impl_.p50_latency_;
+}
+inline double OpStat::p50_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.p50_latency)
+  return _internal_p50_latency();
+}
+inline void OpStat::_internal_set_p50_latency(double value) {
+  
+  _impl_.p50_latency_ = value;
+}
+inline void OpStat::set_p50_latency(double value) {
+  _internal_set_p50_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.p50_latency)
+}
+
+// double p99_latency = 8;
+inline void OpStat::clear_p99_latency() {
+  _impl_.p99_latency_ = 0;
+}
+inline double OpStat::_internal_p99_latency() const {
+  return _impl_.p99_latency_;
+}
+inline double OpStat::p99_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.p99_latency)
+  return _internal_p99_latency();
+}
+inline void OpStat::_internal_set_p99_latency(double value) {
+  
+  _impl_.p99_latency_ = value;
+}
+inline void OpStat::set_p99_latency(double value) {
+  _internal_set_p99_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.p99_latency)
+}
+
+// double p999_latency = 9;
+inline void OpStat::clear_p999_latency() {
+  _impl_.p999_latency_ = 0;
+}
+inline double OpStat::_internal_p999_latency() const {
+  return _impl_.p999_latency_;
+}
+inline double OpStat::p999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.p999_latency)
+  return _internal_p999_latency();
+}
+inline void OpStat::_internal_set_p999_latency(double value) {
+  
+  _impl_.p999_latency_ = value;
+}
+inline void OpStat::set_p999_latency(double value) {
+  _internal_set_p999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.OpStat.p999_latency)
+}
+
+// .kvbench.LatencyHistogram histogram = 10;
+inline bool OpStat::_internal_has_histogram() const {
+  return this != internal_default_instance() && _impl_.histogram_ != nullptr;
+}
+inline bool OpStat::has_histogram() const {
+  return _internal_has_histogram();
+}
+inline void OpStat::clear_histogram() {
+  if (GetArenaForAllocation() == nullptr && _impl_.histogram_ != nullptr) {
+    delete _impl_.histogram_;
+  }
+  _impl_.histogram_ = nullptr;
+}
+inline const ::kvbench::LatencyHistogram& OpStat::_internal_histogram() const {
+  const ::kvbench::LatencyHistogram* p = _impl_.histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::LatencyHistogram&>(
+      ::kvbench::_LatencyHistogram_default_instance_);
+}
+inline const ::kvbench::LatencyHistogram& OpStat::histogram() const {
+  // @@protoc_insertion_point(field_get:kvbench.OpStat.histogram)
+  return _internal_histogram();
+}
+inline void OpStat::unsafe_arena_set_allocated_histogram(
+    ::kvbench::LatencyHistogram* histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.histogram_);
+  }
+  _impl_.histogram_ = histogram;
+  if (histogram) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.OpStat.histogram)
+}
+inline ::kvbench::LatencyHistogram* OpStat::release_histogram() {
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.histogram_;
+  _impl_.histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* OpStat::unsafe_arena_release_histogram() {
+  // @@protoc_insertion_point(field_release:kvbench.OpStat.histogram)
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.histogram_;
+  _impl_.histogram_ = nullptr;
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* OpStat::_internal_mutable_histogram() {
+  
+  if (_impl_.histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::LatencyHistogram>(GetArenaForAllocation());
+    _impl_.histogram_ = p;
+  }
+  return _impl_.histogram_;
+}
+inline ::kvbench::LatencyHistogram* OpStat::mutable_histogram() {
+  ::kvbench::LatencyHistogram* _msg = _internal_mutable_histogram();
+  // @@protoc_insertion_point(field_mutable:kvbench.OpStat.histogram)
+  return _msg;
+}
+inline void OpStat::set_allocated_histogram(::kvbench::LatencyHistogram* histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.histogram_;
+  }
+  if (histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(histogram);
+    if (message_arena != submessage_arena) {
+      histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, histogram, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.histogram_ = histogram;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.OpStat.histogram)
+}
+
+// -------------------------------------------------------------------
+
+// RatePoint
+
+// double offered_rate = 1;
+inline void RatePoint::clear_offered_rate() {
+  _impl_.offered_rate_ = 0;
+}
+inline double RatePoint::_internal_offered_rate() const {
+  return _impl_.offered_rate_;
+}
+inline double RatePoint::offered_rate() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.offered_rate)
+  return _internal_offered_rate();
+}
+inline void RatePoint::_internal_set_offered_rate(double value) {
+  
+  _impl_.offered_rate_ = value;
+}
+inline void RatePoint::set_offered_rate(double value) {
+  _internal_set_offered_rate(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.offered_rate)
+}
+
+// double throughput = 2;
+inline void RatePoint::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double RatePoint::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double RatePoint::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.throughput)
+  return _internal_throughput();
+}
+inline void RatePoint::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void RatePoint::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.throughput)
+}
+
+// double average_latency = 3;
+inline void RatePoint::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double RatePoint::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double RatePoint::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.average_latency)
+  return _internal_average_latency();
+}
+inline void RatePoint::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void RatePoint::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.average_latency)
+}
+
+// double max_latency = 4;
+inline void RatePoint::clear_max_latency() {
+  _impl_.max_latency_ = 0;
+}
+inline double RatePoint::_internal_max_latency() const {
+  return _impl_.max_latency_;
+}
+inline double RatePoint::max_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.max_latency)
+  return _internal_max_latency();
+}
+inline void RatePoint::_internal_set_max_latency(double value) {
+  
+  _impl_.max_latency_ = value;
+}
+inline void RatePoint::set_max_latency(double value) {
+  _internal_set_max_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.max_latency)
+}
+
+// double p50_latency = 5;
+inline void RatePoint::clear_p50_latency() {
+  _impl_.p50_latency_ = 0;
+}
+inline double RatePoint::_internal_p50_latency() const {
+  return _impl_.p50_latency_;
+}
+inline double RatePoint::p50_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.p50_latency)
+  return _internal_p50_latency();
+}
+inline void RatePoint::_internal_set_p50_latency(double value) {
+  
+  _impl_.p50_latency_ = value;
+}
+inline void RatePoint::set_p50_latency(double value) {
+  _internal_set_p50_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.p50_latency)
+}
+
+// double p99_latency = 6;
+inline void RatePoint::clear_p99_latency() {
+  _impl_.p99_latency_ = 0;
+}
+inline double RatePoint::_internal_p99_latency() const {
+  return _impl_.p99_latency_;
+}
+inline double RatePoint::p99_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.p99_latency)
+  return _internal_p99_latency();
+}
+inline void RatePoint::_internal_set_p99_latency(double value) {
+  
+  _impl_.p99_latency_ = value;
+}
+inline void RatePoint::set_p99_latency(double value) {
+  _internal_set_p99_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.p99_latency)
+}
+
+// double p999_latency = 7;
+inline void RatePoint::clear_p999_latency() {
+  _impl_.p999_latency_ = 0;
+}
+inline double RatePoint::_internal_p999_latency() const {
+  return _impl_.p999_latency_;
+}
+inline double RatePoint::p999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.RatePoint.p999_latency)
+  return _internal_p999_latency();
+}
+inline void RatePoint::_internal_set_p999_latency(double value) {
+  
+  _impl_.p999_latency_ = value;
+}
+inline void RatePoint::set_p999_latency(double value) {
+  _internal_set_p999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.RatePoint.p999_latency)
+}
+
+// -------------------------------------------------------------------
+
+// ThreadPoint
+
+// int32 threads = 1;
+inline void ThreadPoint::clear_threads() {
+  _impl_.threads_ = 0;
+}
+inline int32_t ThreadPoint::_internal_threads() const {
+  return _impl_.threads_;
+}
+inline int32_t ThreadPoint::threads() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.threads)
+  return _internal_threads();
+}
+inline void ThreadPoint::_internal_set_threads(int32_t value) {
+  
+  _impl_.threads_ = value;
+}
+inline void ThreadPoint::set_threads(int32_t value) {
+  _internal_set_threads(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.threads)
+}
+
+// double throughput = 2;
+inline void ThreadPoint::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double ThreadPoint::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double ThreadPoint::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.throughput)
+  return _internal_throughput();
+}
+inline void ThreadPoint::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void ThreadPoint::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.throughput)
+}
+
+// double speedup = 3;
+inline void ThreadPoint::clear_speedup() {
+  _impl_.speedup_ = 0;
+}
+inline double ThreadPoint::_internal_speedup() const {
+  return _impl_.speedup_;
+}
+inline double ThreadPoint::speedup() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.speedup)
+  return _internal_speedup();
+}
+inline void ThreadPoint::_internal_set_speedup(double value) {
+  
+  _impl_.speedup_ = value;
+}
+inline void ThreadPoint::set_speedup(double value) {
+  _internal_set_speedup(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.speedup)
+}
+
+// double efficiency = 4;
+inline void ThreadPoint::clear_efficiency() {
+  _impl_.efficiency_ = 0;
+}
+inline double ThreadPoint::_internal_efficiency() const {
+  return _impl_.efficiency_;
+}
+inline double ThreadPoint::efficiency() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.efficiency)
+  return _internal_efficiency();
+}
+inline void ThreadPoint::_internal_set_efficiency(double value) {
+  
+  _impl_.efficiency_ = value;
+}
+inline void ThreadPoint::set_efficiency(double value) {
+  _internal_set_efficiency(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.efficiency)
+}
+
+// double average_latency = 5;
+inline void ThreadPoint::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double ThreadPoint::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double ThreadPoint::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.average_latency)
+  return _internal_average_latency();
+}
+inline void ThreadPoint::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void ThreadPoint::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.average_latency)
+}
+
+// double p50_latency = 6;
+inline void ThreadPoint::clear_p50_latency() {
+  _impl_.p50_latency_ = 0;
+}
+inline double ThreadPoint::_internal_p50_latency() const {
+  return _impl_.p50_latency_;
+}
+inline double ThreadPoint::p50_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.p50_latency)
+  return _internal_p50_latency();
+}
+inline void ThreadPoint::_internal_set_p50_latency(double value) {
+  
+  _impl_.p50_latency_ = value;
+}
+inline void ThreadPoint::set_p50_latency(double value) {
+  _internal_set_p50_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.p50_latency)
+}
+
+// double p99_latency = 7;
+inline void ThreadPoint::clear_p99_latency() {
+  _impl_.p99_latency_ = 0;
+}
+inline double ThreadPoint::_internal_p99_latency() const {
+  return _impl_.p99_latency_;
+}
+inline double ThreadPoint::p99_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.p99_latency)
+  return _internal_p99_latency();
+}
+inline void ThreadPoint::_internal_set_p99_latency(double value) {
+  
+  _impl_.p99_latency_ = value;
+}
+inline void ThreadPoint::set_p99_latency(double value) {
+  _internal_set_p99_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.p99_latency)
+}
+
+// double p999_latency = 8;
+inline void ThreadPoint::clear_p999_latency() {
+  _impl_.p999_latency_ = 0;
+}
+inline double ThreadPoint::_internal_p999_latency() const {
+  return _impl_.p999_latency_;
+}
+inline double ThreadPoint::p999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.ThreadPoint.p999_latency)
+  return _internal_p999_latency();
+}
+inline void ThreadPoint::_internal_set_p999_latency(double value) {
+  
+  _impl_.p999_latency_ = value;
+}
+inline void ThreadPoint::set_p999_latency(double value) {
+  _internal_set_p999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.ThreadPoint.p999_latency)
+}
+
+// -------------------------------------------------------------------
+
+// Stat
+
+// double duration = 1;
+inline void Stat::clear_duration() {
+  _impl_.duration_ = 0;
+}
+inline double Stat::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline double Stat::duration() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.duration)
+  return _internal_duration();
+}
+inline void Stat::_internal_set_duration(double value) {
+  
+  _impl_.duration_ = value;
+}
+inline void Stat::set_duration(double value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.duration)
+}
+
+// double average_latency = 2;
+inline void Stat::clear_average_latency() {
+  _impl_.average_latency_ = 0;
+}
+inline double Stat::_internal_average_latency() const {
+  return _impl_.average_latency_;
+}
+inline double Stat::average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.average_latency)
+  return _internal_average_latency();
+}
+inline void Stat::_internal_set_average_latency(double value) {
+  
+  _impl_.average_latency_ = value;
+}
+inline void Stat::set_average_latency(double value) {
+  _internal_set_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.average_latency)
+}
+
+// double max_latency = 3;
+inline void Stat::clear_max_latency() {
+  _impl_.max_latency_ = 0;
+}
+inline double Stat::_internal_max_latency() const {
+  return _impl_.max_latency_;
+}
+inline double Stat::max_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.max_latency)
+  return _internal_max_latency();
+}
+inline void Stat::_internal_set_max_latency(double value) {
+  
+  _impl_.max_latency_ = value;
+}
+inline void Stat::set_max_latency(double value) {
+  _internal_set_max_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.max_latency)
+}
+
+// double throughput = 4;
+inline void Stat::clear_throughput() {
+  _impl_.throughput_ = 0;
+}
+inline double Stat::_internal_throughput() const {
+  return _impl_.throughput_;
+}
+inline double Stat::throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.throughput)
+  return _internal_throughput();
+}
+inline void Stat::_internal_set_throughput(double value) {
+  
+  _impl_.throughput_ = value;
+}
+inline void Stat::set_throughput(double value) {
+  _internal_set_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.throughput)
+}
+
+// repeated double latency = 5;
+inline int Stat::_internal_latency_size() const {
+  return _impl_.latency_.size();
+}
+inline int Stat::latency_size() const {
+  return _internal_latency_size();
+}
+inline void Stat::clear_latency() {
+  _impl_.latency_.Clear();
+}
+inline double Stat::_internal_latency(int index) const {
+  return _impl_.latency_.Get(index);
+}
+inline double Stat::latency(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.latency)
+  return _internal_latency(index);
+}
+inline void Stat::set_latency(int index, double value) {
+  _impl_.latency_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.latency)
+}
+inline void Stat::_internal_add_latency(double value) {
+  _impl_.latency_.Add(value);
+}
+inline void Stat::add_latency(double value) {
+  _internal_add_latency(value);
+  // @@protoc_insertion_point(field_add:kvbench.Stat.latency)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Stat::_internal_latency() const {
+  return _impl_.latency_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Stat::latency() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.latency)
+  return _internal_latency();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Stat::_internal_mutable_latency() {
+  return &_impl_.latency_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Stat::mutable_latency() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.latency)
+  return _internal_mutable_latency();
+}
+
+// int32 failed = 6;
+inline void Stat::clear_failed() {
+  _impl_.failed_ = 0;
+}
+inline int32_t Stat::_internal_failed() const {
+  return _impl_.failed_;
+}
+inline int32_t Stat::failed() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.failed)
+  return _internal_failed();
+}
+inline void Stat::_internal_set_failed(int32_t value) {
+  
+  _impl_.failed_ = value;
+}
+inline void Stat::set_failed(int32_t value) {
+  _internal_set_failed(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.failed)
+}
+
+// int64 total = 7;
+inline void Stat::clear_total() {
+  _impl_.total_ = int64_t{0};
+}
+inline int64_t Stat::_internal_total() const {
+  return _impl_.total_;
+}
+inline int64_t Stat::total() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.total)
+  return _internal_total();
+}
+inline void Stat::_internal_set_total(int64_t value) {
+  
+  _impl_.total_ = value;
+}
+inline void Stat::set_total(int64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.total)
+}
+
+// uint64 buffer_bytes = 8;
+inline void Stat::clear_buffer_bytes() {
+  _impl_.buffer_bytes_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_buffer_bytes() const {
+  return _impl_.buffer_bytes_;
+}
+inline uint64_t Stat::buffer_bytes() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.buffer_bytes)
+  return _internal_buffer_bytes();
+}
+inline void Stat::_internal_set_buffer_bytes(uint64_t value) {
+  
+  _impl_.buffer_bytes_ = value;
+}
+inline void Stat::set_buffer_bytes(uint64_t value) {
+  _internal_set_buffer_bytes(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.buffer_bytes)
+}
+
+// .kvbench.LatencyHistogram histogram = 9;
+inline bool Stat::_internal_has_histogram() const {
+  return this != internal_default_instance() && _impl_.histogram_ != nullptr;
+}
+inline bool Stat::has_histogram() const {
+  return _internal_has_histogram();
+}
+inline void Stat::clear_histogram() {
+  if (GetArenaForAllocation() == nullptr && _impl_.histogram_ != nullptr) {
+    delete _impl_.histogram_;
+  }
+  _impl_.histogram_ = nullptr;
+}
+inline const ::kvbench::LatencyHistogram& Stat::_internal_histogram() const {
+  const ::kvbench::LatencyHistogram* p = _impl_.histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::LatencyHistogram&>(
+      ::kvbench::_LatencyHistogram_default_instance_);
+}
+inline const ::kvbench::LatencyHistogram& Stat::histogram() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.histogram)
+  return _internal_histogram();
+}
+inline void Stat::unsafe_arena_set_allocated_histogram(
+    ::kvbench::LatencyHistogram* histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.histogram_);
+  }
+  _impl_.histogram_ = histogram;
+  if (histogram) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.Stat.histogram)
+}
+inline ::kvbench::LatencyHistogram* Stat::release_histogram() {
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.histogram_;
+  _impl_.histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::unsafe_arena_release_histogram() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.histogram)
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.histogram_;
+  _impl_.histogram_ = nullptr;
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::_internal_mutable_histogram() {
+  
+  if (_impl_.histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::LatencyHistogram>(GetArenaForAllocation());
+    _impl_.histogram_ = p;
+  }
+  return _impl_.histogram_;
+}
+inline ::kvbench::LatencyHistogram* Stat::mutable_histogram() {
+  ::kvbench::LatencyHistogram* _msg = _internal_mutable_histogram();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.histogram)
+  return _msg;
+}
+inline void Stat::set_allocated_histogram(::kvbench::LatencyHistogram* histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.histogram_;
+  }
+  if (histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(histogram);
+    if (message_arena != submessage_arena) {
+      histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, histogram, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.histogram_ = histogram;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.histogram)
+}
+
+// double p50_latency = 10;
+inline void Stat::clear_p50_latency() {
+  _impl_.p50_latency_ = 0;
+}
+inline double Stat::_internal_p50_latency() const {
+  return _impl_.p50_latency_;
+}
+inline double Stat::p50_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.p50_latency)
+  return _internal_p50_latency();
+}
+inline void Stat::_internal_set_p50_latency(double value) {
+  
+  _impl_.p50_latency_ = value;
+}
+inline void Stat::set_p50_latency(double value) {
+  _internal_set_p50_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.p50_latency)
+}
+
+// double p90_latency = 11;
+inline void Stat::clear_p90_latency() {
+  _impl_.p90_latency_ = 0;
+}
+inline double Stat::_internal_p90_latency() const {
+  return _impl_.p90_latency_;
+}
+inline double Stat::p90_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.p90_latency)
+  return _internal_p90_latency();
+}
+inline void Stat::_internal_set_p90_latency(double value) {
+  
+  _impl_.p90_latency_ = value;
+}
+inline void Stat::set_p90_latency(double value) {
+  _internal_set_p90_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.p90_latency)
+}
+
+// double p99_latency = 12;
+inline void Stat::clear_p99_latency() {
+  _impl_.p99_latency_ = 0;
+}
+inline double Stat::_internal_p99_latency() const {
+  return _impl_.p99_latency_;
+}
+inline double Stat::p99_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.p99_latency)
+  return _internal_p99_latency();
+}
+inline void Stat::_internal_set_p99_latency(double value) {
+  
+  _impl_.p99_latency_ = value;
+}
+inline void Stat::set_p99_latency(double value) {
+  _internal_set_p99_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.p99_latency)
+}
+
+// double p999_latency = 13;
+inline void Stat::clear_p999_latency() {
+  _impl_.p999_latency_ = 0;
+}
+inline double Stat::_internal_p999_latency() const {
+  return _impl_.p999_latency_;
+}
+inline double Stat::p999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.p999_latency)
+  return _internal_p999_latency();
+}
+inline void Stat::_internal_set_p999_latency(double value) {
+  
+  _impl_.p999_latency_ = value;
+}
+inline void Stat::set_p999_latency(double value) {
+  _internal_set_p999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.p999_latency)
+}
+
+// double p9999_latency = 14;
+inline void Stat::clear_p9999_latency() {
+  _impl_.p9999_latency_ = 0;
+}
+inline double Stat::_internal_p9999_latency() const {
+  return _impl_.p9999_latency_;
+}
+inline double Stat::p9999_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.p9999_latency)
+  return _internal_p9999_latency();
+}
+inline void Stat::_internal_set_p9999_latency(double value) {
+  
+  _impl_.p9999_latency_ = value;
+}
+inline void Stat::set_p9999_latency(double value) {
+  _internal_set_p9999_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.p9999_latency)
+}
+
+// uint64 latency_batch = 15;
+inline void Stat::clear_latency_batch() {
+  _impl_.latency_batch_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_latency_batch() const {
+  return _impl_.latency_batch_;
+}
+inline uint64_t Stat::latency_batch() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.latency_batch)
+  return _internal_latency_batch();
+}
+inline void Stat::_internal_set_latency_batch(uint64_t value) {
+  
+  _impl_.latency_batch_ = value;
+}
+inline void Stat::set_latency_batch(uint64_t value) {
+  _internal_set_latency_batch(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.latency_batch)
+}
+
+// .kvbench.LatencyHistogram batch_histogram = 16;
+inline bool Stat::_internal_has_batch_histogram() const {
+  return this != internal_default_instance() && _impl_.batch_histogram_ != nullptr;
+}
+inline bool Stat::has_batch_histogram() const {
+  return _internal_has_batch_histogram();
+}
+inline void Stat::clear_batch_histogram() {
+  if (GetArenaForAllocation() == nullptr && _impl_.batch_histogram_ != nullptr) {
+    delete _impl_.batch_histogram_;
+  }
+  _impl_.batch_histogram_ = nullptr;
+}
+inline const ::kvbench::LatencyHistogram& Stat::_internal_batch_histogram() const {
+  const ::kvbench::LatencyHistogram* p = _impl_.batch_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::LatencyHistogram&>(
+      ::kvbench::_LatencyHistogram_default_instance_);
+}
+inline const ::kvbench::LatencyHistogram& Stat::batch_histogram() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.batch_histogram)
+  return _internal_batch_histogram();
+}
+inline void Stat::unsafe_arena_set_allocated_batch_histogram(
+    ::kvbench::LatencyHistogram* batch_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.batch_histogram_);
+  }
+  _impl_.batch_histogram_ = batch_histogram;
+  if (batch_histogram) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.Stat.batch_histogram)
+}
+inline ::kvbench::LatencyHistogram* Stat::release_batch_histogram() {
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.batch_histogram_;
+  _impl_.batch_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::unsafe_arena_release_batch_histogram() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.batch_histogram)
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.batch_histogram_;
+  _impl_.batch_histogram_ = nullptr;
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::_internal_mutable_batch_histogram() {
+  
+  if (_impl_.batch_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::LatencyHistogram>(GetArenaForAllocation());
+    _impl_.batch_histogram_ = p;
+  }
+  return _impl_.batch_histogram_;
+}
+inline ::kvbench::LatencyHistogram* Stat::mutable_batch_histogram() {
+  ::kvbench::LatencyHistogram* _msg = _internal_mutable_batch_histogram();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.batch_histogram)
+  return _msg;
+}
+inline void Stat::set_allocated_batch_histogram(::kvbench::LatencyHistogram* batch_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.batch_histogram_;
+  }
+  if (batch_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch_histogram);
+    if (message_arena != submessage_arena) {
+      batch_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch_histogram, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.batch_histogram_ = batch_histogram;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.batch_histogram)
+}
+
+// repeated int32 cpu = 17;
+inline int Stat::_internal_cpu_size() const {
+  return _impl_.cpu_.size();
+}
+inline int Stat::cpu_size() const {
+  return _internal_cpu_size();
+}
+inline void Stat::clear_cpu() {
+  _impl_.cpu_.Clear();
+}
+inline int32_t Stat::_internal_cpu(int index) const {
+  return _impl_.cpu_.Get(index);
+}
+inline int32_t Stat::cpu(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.cpu)
+  return _internal_cpu(index);
+}
+inline void Stat::set_cpu(int index, int32_t value) {
+  _impl_.cpu_.Set(index, value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.cpu)
+}
+inline void Stat::_internal_add_cpu(int32_t value) {
+  _impl_.cpu_.Add(value);
+}
+inline void Stat::add_cpu(int32_t value) {
+  _internal_add_cpu(value);
+  // @@protoc_insertion_point(field_add:kvbench.Stat.cpu)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Stat::_internal_cpu() const {
+  return _impl_.cpu_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Stat::cpu() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.cpu)
+  return _internal_cpu();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Stat::_internal_mutable_cpu() {
+  return &_impl_.cpu_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Stat::mutable_cpu() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.cpu)
+  return _internal_mutable_cpu();
+}
+
+// .kvbench.SteadyStat steady = 18;
+inline bool Stat::_internal_has_steady() const {
+  return this != internal_default_instance() && _impl_.steady_ != nullptr;
+}
+inline bool Stat::has_steady() const {
+  return _internal_has_steady();
+}
+inline void Stat::clear_steady() {
+  if (GetArenaForAllocation() == nullptr && _impl_.steady_ != nullptr) {
+    delete _impl_.steady_;
+  }
+  _impl_.steady_ = nullptr;
+}
+inline const ::kvbench::SteadyStat& Stat::_internal_steady() const {
+  const ::kvbench::SteadyStat* p = _impl_.steady_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::SteadyStat&>(
+      ::kvbench::_SteadyStat_default_instance_);
+}
+inline const ::kvbench::SteadyStat& Stat::steady() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.steady)
+  return _internal_steady();
+}
+inline void Stat::unsafe_arena_set_allocated_steady(
+    ::kvbench::SteadyStat* steady) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.steady_);
+  }
+  _impl_.steady_ = steady;
+  if (steady) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.Stat.steady)
+}
+inline ::kvbench::SteadyStat* Stat::release_steady() {
+  
+  ::kvbench::SteadyStat* temp = _impl_.steady_;
+  _impl_.steady_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::SteadyStat* Stat::unsafe_arena_release_steady() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.steady)
+  
+  ::kvbench::SteadyStat* temp = _impl_.steady_;
+  _impl_.steady_ = nullptr;
+  return temp;
+}
+inline ::kvbench::SteadyStat* Stat::_internal_mutable_steady() {
+  
+  if (_impl_.steady_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::SteadyStat>(GetArenaForAllocation());
+    _impl_.steady_ = p;
+  }
+  return _impl_.steady_;
+}
+inline ::kvbench::SteadyStat* Stat::mutable_steady() {
+  ::kvbench::SteadyStat* _msg = _internal_mutable_steady();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.steady)
+  return _msg;
+}
+inline void Stat::set_allocated_steady(::kvbench::SteadyStat* steady) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.steady_;
+  }
+  if (steady) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(steady);
+    if (message_arena != submessage_arena) {
+      steady = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, steady, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.steady_ = steady;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.steady)
+}
+
+// repeated .kvbench.TimelinePoint timeline = 19;
+inline int Stat::_internal_timeline_size() const {
+  return _impl_.timeline_.size();
+}
+inline int Stat::timeline_size() const {
+  return _internal_timeline_size();
+}
+inline void Stat::clear_timeline() {
+  _impl_.timeline_.Clear();
+}
+inline ::kvbench::TimelinePoint* Stat::mutable_timeline(int index) {
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.timeline)
+  return _impl_.timeline_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::TimelinePoint >*
+Stat::mutable_timeline() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.timeline)
+  return &_impl_.timeline_;
+}
+inline const ::kvbench::TimelinePoint& Stat::_internal_timeline(int index) const {
+  return _impl_.timeline_.Get(index);
+}
+inline const ::kvbench::TimelinePoint& Stat::timeline(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.timeline)
+  return _internal_timeline(index);
+}
+inline ::kvbench::TimelinePoint* Stat::_internal_add_timeline() {
+  return _impl_.timeline_.Add();
+}
+inline ::kvbench::TimelinePoint* Stat::add_timeline() {
+  ::kvbench::TimelinePoint* _add = _internal_add_timeline();
+  // @@protoc_insertion_point(field_add:kvbench.Stat.timeline)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::TimelinePoint >&
+Stat::timeline() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.timeline)
+  return _impl_.timeline_;
+}
+
+// string mix = 20;
+inline void Stat::clear_mix() {
+  _impl_.mix_.ClearToEmpty();
+}
+inline const std::string& Stat::mix() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.mix)
+  return _internal_mix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_mix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stat.mix)
+}
+inline std::string* Stat::mutable_mix() {
+  std::string* _s = _internal_mutable_mix();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.mix)
+  return _s;
+}
+inline const std::string& Stat::_internal_mix() const {
+  return _impl_.mix_.Get();
+}
+inline void Stat::_internal_set_mix(const std::string& value) {
+  
+  _impl_.mix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_mix() {
+  
+  return _impl_.mix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_mix() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.mix)
+  return _impl_.mix_.Release();
+}
+inline void Stat::set_allocated_mix(std::string* mix) {
+  if (mix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mix_.SetAllocated(mix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mix_.IsDefault()) {
+    _impl_.mix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.mix)
+}
+
+// repeated .kvbench.OpStat op_stat = 21;
+inline int Stat::_internal_op_stat_size() const {
+  return _impl_.op_stat_.size();
+}
+inline int Stat::op_stat_size() const {
+  return _internal_op_stat_size();
+}
+inline void Stat::clear_op_stat() {
+  _impl_.op_stat_.Clear();
+}
+inline ::kvbench::OpStat* Stat::mutable_op_stat(int index) {
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.op_stat)
+  return _impl_.op_stat_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::OpStat >*
+Stat::mutable_op_stat() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.op_stat)
+  return &_impl_.op_stat_;
+}
+inline const ::kvbench::OpStat& Stat::_internal_op_stat(int index) const {
+  return _impl_.op_stat_.Get(index);
+}
+inline const ::kvbench::OpStat& Stat::op_stat(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.op_stat)
+  return _internal_op_stat(index);
+}
+inline ::kvbench::OpStat* Stat::_internal_add_op_stat() {
+  return _impl_.op_stat_.Add();
+}
+inline ::kvbench::OpStat* Stat::add_op_stat() {
+  ::kvbench::OpStat* _add = _internal_add_op_stat();
+  // @@protoc_insertion_point(field_add:kvbench.Stat.op_stat)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::OpStat >&
+Stat::op_stat() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.op_stat)
+  return _impl_.op_stat_;
+}
+
+// double offered_rate = 22;
+inline void Stat::clear_offered_rate() {
+  _impl_.offered_rate_ = 0;
+}
+inline double Stat::_internal_offered_rate() const {
+  return _impl_.offered_rate_;
+}
+inline double Stat::offered_rate() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.offered_rate)
+  return _internal_offered_rate();
+}
+inline void Stat::_internal_set_offered_rate(double value) {
+  
+  _impl_.offered_rate_ = value;
+}
+inline void Stat::set_offered_rate(double value) {
+  _internal_set_offered_rate(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.offered_rate)
+}
+
+// string arrival = 23;
+inline void Stat::clear_arrival() {
+  _impl_.arrival_.ClearToEmpty();
+}
+inline const std::string& Stat::arrival() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.arrival)
+  return _internal_arrival();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_arrival(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.arrival_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stat.arrival)
+}
+inline std::string* Stat::mutable_arrival() {
+  std::string* _s = _internal_mutable_arrival();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.arrival)
+  return _s;
+}
+inline const std::string& Stat::_internal_arrival() const {
+  return _impl_.arrival_.Get();
+}
+inline void Stat::_internal_set_arrival(const std::string& value) {
+  
+  _impl_.arrival_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_arrival() {
+  
+  return _impl_.arrival_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_arrival() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.arrival)
+  return _impl_.arrival_.Release();
+}
+inline void Stat::set_allocated_arrival(std::string* arrival) {
+  if (arrival != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.arrival_.SetAllocated(arrival, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arrival_.IsDefault()) {
+    _impl_.arrival_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.arrival)
+}
+
+// repeated .kvbench.RatePoint rate_curve = 24;
+inline int Stat::_internal_rate_curve_size() const {
+  return _impl_.rate_curve_.size();
+}
+inline int Stat::rate_curve_size() const {
+  return _internal_rate_curve_size();
+}
+inline void Stat::clear_rate_curve() {
+  _impl_.rate_curve_.Clear();
+}
+inline ::kvbench::RatePoint* Stat::mutable_rate_curve(int index) {
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.rate_curve)
+  return _impl_.rate_curve_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::RatePoint >*
+Stat::mutable_rate_curve() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.rate_curve)
+  return &_impl_.rate_curve_;
+}
+inline const ::kvbench::RatePoint& Stat::_internal_rate_curve(int index) const {
+  return _impl_.rate_curve_.Get(index);
+}
+inline const ::kvbench::RatePoint& Stat::rate_curve(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.rate_curve)
+  return _internal_rate_curve(index);
+}
+inline ::kvbench::RatePoint* Stat::_internal_add_rate_curve() {
+  return _impl_.rate_curve_.Add();
+}
+inline ::kvbench::RatePoint* Stat::add_rate_curve() {
+  ::kvbench::RatePoint* _add = _internal_add_rate_curve();
+  // @@protoc_insertion_point(field_add:kvbench.Stat.rate_curve)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::RatePoint >&
+Stat::rate_curve() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.rate_curve)
+  return _impl_.rate_curve_;
+}
+
+// uint64 scan_items = 25;
+inline void Stat::clear_scan_items() {
+  _impl_.scan_items_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_scan_items() const {
+  return _impl_.scan_items_;
+}
+inline uint64_t Stat::scan_items() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.scan_items)
+  return _internal_scan_items();
+}
+inline void Stat::_internal_set_scan_items(uint64_t value) {
+  
+  _impl_.scan_items_ = value;
+}
+inline void Stat::set_scan_items(uint64_t value) {
+  _internal_set_scan_items(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.scan_items)
+}
+
+// double scan_item_throughput = 26;
+inline void Stat::clear_scan_item_throughput() {
+  _impl_.scan_item_throughput_ = 0;
+}
+inline double Stat::_internal_scan_item_throughput() const {
+  return _impl_.scan_item_throughput_;
+}
+inline double Stat::scan_item_throughput() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.scan_item_throughput)
+  return _internal_scan_item_throughput();
+}
+inline void Stat::_internal_set_scan_item_throughput(double value) {
+  
+  _impl_.scan_item_throughput_ = value;
+}
+inline void Stat::set_scan_item_throughput(double value) {
+  _internal_set_scan_item_throughput(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.scan_item_throughput)
+}
+
+// uint64 batch = 27;
+inline void Stat::clear_batch() {
+  _impl_.batch_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_batch() const {
+  return _impl_.batch_;
+}
+inline uint64_t Stat::batch() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.batch)
+  return _internal_batch();
+}
+inline void Stat::_internal_set_batch(uint64_t value) {
+  
+  _impl_.batch_ = value;
+}
+inline void Stat::set_batch(uint64_t value) {
+  _internal_set_batch(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.batch)
+}
+
+// uint64 interleave = 28;
+inline void Stat::clear_interleave() {
+  _impl_.interleave_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_interleave() const {
+  return _impl_.interleave_;
+}
+inline uint64_t Stat::interleave() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.interleave)
+  return _internal_interleave();
+}
+inline void Stat::_internal_set_interleave(uint64_t value) {
+  
+  _impl_.interleave_ = value;
+}
+inline void Stat::set_interleave(uint64_t value) {
+  _internal_set_interleave(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.interleave)
+}
+
+// string key_size = 29;
+inline void Stat::clear_key_size() {
+  _impl_.key_size_.ClearToEmpty();
+}
+inline const std::string& Stat::key_size() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.key_size)
+  return _internal_key_size();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_key_size(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_size_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stat.key_size)
+}
+inline std::string* Stat::mutable_key_size() {
+  std::string* _s = _internal_mutable_key_size();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.key_size)
+  return _s;
+}
+inline const std::string& Stat::_internal_key_size() const {
+  return _impl_.key_size_.Get();
+}
+inline void Stat::_internal_set_key_size(const std::string& value) {
+  
+  _impl_.key_size_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_key_size() {
+  
+  return _impl_.key_size_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_key_size() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.key_size)
+  return _impl_.key_size_.Release();
+}
+inline void Stat::set_allocated_key_size(std::string* key_size) {
+  if (key_size != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_size_.SetAllocated(key_size, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_size_.IsDefault()) {
+    _impl_.key_size_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.key_size)
+}
+
+// string value_size = 30;
+inline void Stat::clear_value_size() {
+  _impl_.value_size_.ClearToEmpty();
+}
+inline const std::string& Stat::value_size() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.value_size)
+  return _internal_value_size();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_value_size(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_size_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stat.value_size)
+}
+inline std::string* Stat::mutable_value_size() {
+  std::string* _s = _internal_mutable_value_size();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.value_size)
+  return _s;
+}
+inline const std::string& Stat::_internal_value_size() const {
+  return _impl_.value_size_.Get();
+}
+inline void Stat::_internal_set_value_size(const std::string& value) {
+  
+  _impl_.value_size_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_value_size() {
+  
+  return _impl_.value_size_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_value_size() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.value_size)
+  return _impl_.value_size_.Release();
+}
+inline void Stat::set_allocated_value_size(std::string* value_size) {
+  if (value_size != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_size_.SetAllocated(value_size, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_size_.IsDefault()) {
+    _impl_.value_size_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.value_size)
+}
+
+// int32 threads = 31;
+inline void Stat::clear_threads() {
+  _impl_.threads_ = 0;
+}
+inline int32_t Stat::_internal_threads() const {
+  return _impl_.threads_;
+}
+inline int32_t Stat::threads() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.threads)
+  return _internal_threads();
+}
+inline void Stat::_internal_set_threads(int32_t value) {
+  
+  _impl_.threads_ = value;
+}
+inline void Stat::set_threads(int32_t value) {
+  _internal_set_threads(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.threads)
+}
+
+// repeated .kvbench.ThreadPoint thread_curve = 32;
+inline int Stat::_internal_thread_curve_size() const {
+  return _impl_.thread_curve_.size();
+}
+inline int Stat::thread_curve_size() const {
+  return _internal_thread_curve_size();
+}
+inline void Stat::clear_thread_curve() {
+  _impl_.thread_curve_.Clear();
+}
+inline ::kvbench::ThreadPoint* Stat::mutable_thread_curve(int index) {
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.thread_curve)
+  return _impl_.thread_curve_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::ThreadPoint >*
+Stat::mutable_thread_curve() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stat.thread_curve)
+  return &_impl_.thread_curve_;
+}
+inline const ::kvbench::ThreadPoint& Stat::_internal_thread_curve(int index) const {
+  return _impl_.thread_curve_.Get(index);
+}
+inline const ::kvbench::ThreadPoint& Stat::thread_curve(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.thread_curve)
+  return _internal_thread_curve(index);
+}
+inline ::kvbench::ThreadPoint* Stat::_internal_add_thread_curve() {
+  return _impl_.thread_curve_.Add();
+}
+inline ::kvbench::ThreadPoint* Stat::add_thread_curve() {
+  ::kvbench::ThreadPoint* _add = _internal_add_thread_curve();
+  // @@protoc_insertion_point(field_add:kvbench.Stat.thread_curve)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::ThreadPoint >&
+Stat::thread_curve() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stat.thread_curve)
+  return _impl_.thread_curve_;
+}
+
+// double phase_end_duration = 33;
+inline void Stat::clear_phase_end_duration() {
+  _impl_.phase_end_duration_ = 0;
+}
+inline double Stat::_internal_phase_end_duration() const {
+  return _impl_.phase_end_duration_;
+}
+inline double Stat::phase_end_duration() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.phase_end_duration)
+  return _internal_phase_end_duration();
+}
+inline void Stat::_internal_set_phase_end_duration(double value) {
+  
+  _impl_.phase_end_duration_ = value;
+}
+inline void Stat::set_phase_end_duration(double value) {
+  _internal_set_phase_end_duration(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.phase_end_duration)
+}
+
+// uint64 pmem_flushes = 34;
+inline void Stat::clear_pmem_flushes() {
+  _impl_.pmem_flushes_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_pmem_flushes() const {
+  return _impl_.pmem_flushes_;
+}
+inline uint64_t Stat::pmem_flushes() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.pmem_flushes)
+  return _internal_pmem_flushes();
+}
+inline void Stat::_internal_set_pmem_flushes(uint64_t value) {
+  
+  _impl_.pmem_flushes_ = value;
+}
+inline void Stat::set_pmem_flushes(uint64_t value) {
+  _internal_set_pmem_flushes(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.pmem_flushes)
+}
+
+// uint64 pmem_fences = 35;
+inline void Stat::clear_pmem_fences() {
+  _impl_.pmem_fences_ = uint64_t{0u};
+}
+inline uint64_t Stat::_internal_pmem_fences() const {
+  return _impl_.pmem_fences_;
+}
+inline uint64_t Stat::pmem_fences() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.pmem_fences)
+  return _internal_pmem_fences();
+}
+inline void Stat::_internal_set_pmem_fences(uint64_t value) {
+  
+  _impl_.pmem_fences_ = value;
+}
+inline void Stat::set_pmem_fences(uint64_t value) {
+  _internal_set_pmem_fences(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.pmem_fences)
+}
+
+// .kvbench.ResourceStat resource = 36;
+inline bool Stat::_internal_has_resource() const {
+  return this != internal_default_instance() && _impl_.resource_ != nullptr;
+}
+inline bool Stat::has_resource() const {
+  return _internal_has_resource();
+}
+inline void Stat::clear_resource() {
+  if (GetArenaForAllocation() == nullptr && _impl_.resource_ != nullptr) {
+    delete _impl_.resource_;
+  }
+  _impl_.resource_ = nullptr;
+}
+inline const ::kvbench::ResourceStat& Stat::_internal_resource() const {
+  const ::kvbench::ResourceStat* p = _impl_.resource_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::ResourceStat&>(
+      ::kvbench::_ResourceStat_default_instance_);
+}
+inline const ::kvbench::ResourceStat& Stat::resource() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.resource)
+  return _internal_resource();
+}
+inline void Stat::unsafe_arena_set_allocated_resource(
+    ::kvbench::ResourceStat* resource) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.resource_);
+  }
+  _impl_.resource_ = resource;
+  if (resource) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.Stat.resource)
+}
+inline ::kvbench::ResourceStat* Stat::release_resource() {
+  
+  ::kvbench::ResourceStat* temp = _impl_.resource_;
+  _impl_.resource_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::ResourceStat* Stat::unsafe_arena_release_resource() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.resource)
+  
+  ::kvbench::ResourceStat* temp = _impl_.resource_;
+  _impl_.resource_ = nullptr;
+  return temp;
+}
+inline ::kvbench::ResourceStat* Stat::_internal_mutable_resource() {
+  
+  if (_impl_.resource_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::ResourceStat>(GetArenaForAllocation());
+    _impl_.resource_ = p;
+  }
+  return _impl_.resource_;
+}
+inline ::kvbench::ResourceStat* Stat::mutable_resource() {
+  ::kvbench::ResourceStat* _msg = _internal_mutable_resource();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.resource)
+  return _msg;
+}
+inline void Stat::set_allocated_resource(::kvbench::ResourceStat* resource) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.resource_;
+  }
+  if (resource) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(resource);
+    if (message_arena != submessage_arena) {
+      resource = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resource, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.resource_ = resource;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.resource)
+}
+
+// double key_average_latency = 37;
+inline void Stat::clear_key_average_latency() {
+  _impl_.key_average_latency_ = 0;
+}
+inline double Stat::_internal_key_average_latency() const {
+  return _impl_.key_average_latency_;
+}
+inline double Stat::key_average_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.key_average_latency)
+  return _internal_key_average_latency();
+}
+inline void Stat::_internal_set_key_average_latency(double value) {
+  
+  _impl_.key_average_latency_ = value;
+}
+inline void Stat::set_key_average_latency(double value) {
+  _internal_set_key_average_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stat.key_average_latency)
+}
+
+// .kvbench.LatencyHistogram key_histogram = 38;
+inline bool Stat::_internal_has_key_histogram() const {
+  return this != internal_default_instance() && _impl_.key_histogram_ != nullptr;
+}
+inline bool Stat::has_key_histogram() const {
+  return _internal_has_key_histogram();
+}
+inline void Stat::clear_key_histogram() {
+  if (GetArenaForAllocation() == nullptr && _impl_.key_histogram_ != nullptr) {
+    delete _impl_.key_histogram_;
+  }
+  _impl_.key_histogram_ = nullptr;
+}
+inline const ::kvbench::LatencyHistogram& Stat::_internal_key_histogram() const {
+  const ::kvbench::LatencyHistogram* p = _impl_.key_histogram_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kvbench::LatencyHistogram&>(
+      ::kvbench::_LatencyHistogram_default_instance_);
+}
+inline const ::kvbench::LatencyHistogram& Stat::key_histogram() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stat.key_histogram)
+  return _internal_key_histogram();
+}
+inline void Stat::unsafe_arena_set_allocated_key_histogram(
+    ::kvbench::LatencyHistogram* key_histogram) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_histogram_);
+  }
+  _impl_.key_histogram_ = key_histogram;
+  if (key_histogram) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kvbench.Stat.key_histogram)
+}
+inline ::kvbench::LatencyHistogram* Stat::release_key_histogram() {
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.key_histogram_;
+  _impl_.key_histogram_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::unsafe_arena_release_key_histogram() {
+  // @@protoc_insertion_point(field_release:kvbench.Stat.key_histogram)
+  
+  ::kvbench::LatencyHistogram* temp = _impl_.key_histogram_;
+  _impl_.key_histogram_ = nullptr;
+  return temp;
+}
+inline ::kvbench::LatencyHistogram* Stat::_internal_mutable_key_histogram() {
+  
+  if (_impl_.key_histogram_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kvbench::LatencyHistogram>(GetArenaForAllocation());
+    _impl_.key_histogram_ = p;
+  }
+  return _impl_.key_histogram_;
+}
+inline ::kvbench::LatencyHistogram* Stat::mutable_key_histogram() {
+  ::kvbench::LatencyHistogram* _msg = _internal_mutable_key_histogram();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stat.key_histogram)
+  return _msg;
+}
+inline void Stat::set_allocated_key_histogram(::kvbench::LatencyHistogram* key_histogram) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_histogram_;
+  }
+  if (key_histogram) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key_histogram);
+    if (message_arena != submessage_arena) {
+      key_histogram = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_histogram, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.key_histogram_ = key_histogram;
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stat.key_histogram)
+}
+
+// -------------------------------------------------------------------
+
+// Stats
+
+// repeated .kvbench.Stat stat = 1;
+inline int Stats::_internal_stat_size() const {
+  return _impl_.stat_.size();
+}
+inline int Stats::stat_size() const {
+  return _internal_stat_size();
+}
+inline void Stats::clear_stat() {
+  _impl_.stat_.Clear();
+}
+inline ::kvbench::Stat* Stats::mutable_stat(int index) {
+  // @@protoc_insertion_point(field_mutable:kvbench.Stats.stat)
+  return _impl_.stat_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::Stat >*
+Stats::mutable_stat() {
+  // @@protoc_insertion_point(field_mutable_list:kvbench.Stats.stat)
+  return &_impl_.stat_;
+}
+inline const ::kvbench::Stat& Stats::_internal_stat(int index) const {
+  return _impl_.stat_.Get(index);
+}
+inline const ::kvbench::Stat& Stats::stat(int index) const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.stat)
+  return _internal_stat(index);
+}
+inline ::kvbench::Stat* Stats::_internal_add_stat() {
+  return _impl_.stat_.Add();
+}
+inline ::kvbench::Stat* Stats::add_stat() {
+  ::kvbench::Stat* _add = _internal_add_stat();
+  // @@protoc_insertion_point(field_add:kvbench.Stats.stat)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kvbench::Stat >&
+Stats::stat() const {
+  // @@protoc_insertion_point(field_list:kvbench.Stats.stat)
+  return _impl_.stat_;
+}
+
+// uint64 seed = 2;
+inline void Stats::clear_seed() {
+  _impl_.seed_ = uint64_t{0u};
+}
+inline uint64_t Stats::_internal_seed() const {
+  return _impl_.seed_;
+}
+inline uint64_t Stats::seed() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.seed)
+  return _internal_seed();
+}
+inline void Stats::_internal_set_seed(uint64_t value) {
+  
+  _impl_.seed_ = value;
+}
+inline void Stats::set_seed(uint64_t value) {
+  _internal_set_seed(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stats.seed)
+}
+
+// string clock_source = 3;
+inline void Stats::clear_clock_source() {
+  _impl_.clock_source_.ClearToEmpty();
+}
+inline const std::string& Stats::clock_source() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.clock_source)
+  return _internal_clock_source();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stats::set_clock_source(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clock_source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stats.clock_source)
+}
+inline std::string* Stats::mutable_clock_source() {
+  std::string* _s = _internal_mutable_clock_source();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stats.clock_source)
+  return _s;
+}
+inline const std::string& Stats::_internal_clock_source() const {
+  return _impl_.clock_source_.Get();
+}
+inline void Stats::_internal_set_clock_source(const std::string& value) {
+  
+  _impl_.clock_source_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stats::_internal_mutable_clock_source() {
+  
+  return _impl_.clock_source_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stats::release_clock_source() {
+  // @@protoc_insertion_point(field_release:kvbench.Stats.clock_source)
+  return _impl_.clock_source_.Release();
+}
+inline void Stats::set_allocated_clock_source(std::string* clock_source) {
+  if (clock_source != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clock_source_.SetAllocated(clock_source, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clock_source_.IsDefault()) {
+    _impl_.clock_source_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stats.clock_source)
+}
+
+// double clock_frequency = 4;
+inline void Stats::clear_clock_frequency() {
+  _impl_.clock_frequency_ = 0;
+}
+inline double Stats::_internal_clock_frequency() const {
+  return _impl_.clock_frequency_;
+}
+inline double Stats::clock_frequency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.clock_frequency)
+  return _internal_clock_frequency();
+}
+inline void Stats::_internal_set_clock_frequency(double value) {
+  
+  _impl_.clock_frequency_ = value;
+}
+inline void Stats::set_clock_frequency(double value) {
+  _internal_set_clock_frequency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stats.clock_frequency)
+}
+
+// double timer_overhead = 5;
+inline void Stats::clear_timer_overhead() {
+  _impl_.timer_overhead_ = 0;
+}
+inline double Stats::_internal_timer_overhead() const {
+  return _impl_.timer_overhead_;
+}
+inline double Stats::timer_overhead() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.timer_overhead)
+  return _internal_timer_overhead();
+}
+inline void Stats::_internal_set_timer_overhead(double value) {
+  
+  _impl_.timer_overhead_ = value;
+}
+inline void Stats::set_timer_overhead(double value) {
+  _internal_set_timer_overhead(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stats.timer_overhead)
+}
+
+// string numa_policy = 6;
+inline void Stats::clear_numa_policy() {
+  _impl_.numa_policy_.ClearToEmpty();
+}
+inline const std::string& Stats::numa_policy() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.numa_policy)
+  return _internal_numa_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stats::set_numa_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.numa_policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stats.numa_policy)
+}
+inline std::string* Stats::mutable_numa_policy() {
+  std::string* _s = _internal_mutable_numa_policy();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stats.numa_policy)
+  return _s;
+}
+inline const std::string& Stats::_internal_numa_policy() const {
+  return _impl_.numa_policy_.Get();
+}
+inline void Stats::_internal_set_numa_policy(const std::string& value) {
+  
+  _impl_.numa_policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stats::_internal_mutable_numa_policy() {
+  
+  return _impl_.numa_policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stats::release_numa_policy() {
+  // @@protoc_insertion_point(field_release:kvbench.Stats.numa_policy)
+  return _impl_.numa_policy_.Release();
+}
+inline void Stats::set_allocated_numa_policy(std::string* numa_policy) {
+  if (numa_policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.numa_policy_.SetAllocated(numa_policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.numa_policy_.IsDefault()) {
+    _impl_.numa_policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stats.numa_policy)
+}
+
+// string mem_policy = 7;
+inline void Stats::clear_mem_policy() {
+  _impl_.mem_policy_.ClearToEmpty();
+}
+inline const std::string& Stats::mem_policy() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.mem_policy)
+  return _internal_mem_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stats::set_mem_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.mem_policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stats.mem_policy)
+}
+inline std::string* Stats::mutable_mem_policy() {
+  std::string* _s = _internal_mutable_mem_policy();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stats.mem_policy)
+  return _s;
+}
+inline const std::string& Stats::_internal_mem_policy() const {
+  return _impl_.mem_policy_.Get();
+}
+inline void Stats::_internal_set_mem_policy(const std::string& value) {
+  
+  _impl_.mem_policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stats::_internal_mutable_mem_policy() {
+  
+  return _impl_.mem_policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stats::release_mem_policy() {
+  // @@protoc_insertion_point(field_release:kvbench.Stats.mem_policy)
+  return _impl_.mem_policy_.Release();
+}
+inline void Stats::set_allocated_mem_policy(std::string* mem_policy) {
+  if (mem_policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.mem_policy_.SetAllocated(mem_policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mem_policy_.IsDefault()) {
+    _impl_.mem_policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stats.mem_policy)
+}
+
+// string pmem_dir = 8;
+inline void Stats::clear_pmem_dir() {
+  _impl_.pmem_dir_.ClearToEmpty();
+}
+inline const std::string& Stats::pmem_dir() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.pmem_dir)
+  return _internal_pmem_dir();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stats::set_pmem_dir(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pmem_dir_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kvbench.Stats.pmem_dir)
+}
+inline std::string* Stats::mutable_pmem_dir() {
+  std::string* _s = _internal_mutable_pmem_dir();
+  // @@protoc_insertion_point(field_mutable:kvbench.Stats.pmem_dir)
+  return _s;
+}
+inline const std::string& Stats::_internal_pmem_dir() const {
+  return _impl_.pmem_dir_.Get();
+}
+inline void Stats::_internal_set_pmem_dir(const std::string& value) {
+  
+  _impl_.pmem_dir_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stats::_internal_mutable_pmem_dir() {
+  
+  return _impl_.pmem_dir_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stats::release_pmem_dir() {
+  // @@protoc_insertion_point(field_release:kvbench.Stats.pmem_dir)
+  return _impl_.pmem_dir_.Release();
+}
+inline void Stats::set_allocated_pmem_dir(std::string* pmem_dir) {
+  if (pmem_dir != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.pmem_dir_.SetAllocated(pmem_dir, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pmem_dir_.IsDefault()) {
+    _impl_.pmem_dir_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kvbench.Stats.pmem_dir)
+}
+
+// double pmem_flush_latency = 9;
+inline void Stats::clear_pmem_flush_latency() {
+  _impl_.pmem_flush_latency_ = 0;
+}
+inline double Stats::_internal_pmem_flush_latency() const {
+  return _impl_.pmem_flush_latency_;
+}
+inline double Stats::pmem_flush_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.pmem_flush_latency)
+  return _internal_pmem_flush_latency();
+}
+inline void Stats::_internal_set_pmem_flush_latency(double value) {
+  
+  _impl_.pmem_flush_latency_ = value;
+}
+inline void Stats::set_pmem_flush_latency(double value) {
+  _internal_set_pmem_flush_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stats.pmem_flush_latency)
+}
+
+// double pmem_fence_latency = 10;
+inline void Stats::clear_pmem_fence_latency() {
+  _impl_.pmem_fence_latency_ = 0;
+}
+inline double Stats::_internal_pmem_fence_latency() const {
+  return _impl_.pmem_fence_latency_;
+}
+inline double Stats::pmem_fence_latency() const {
+  // @@protoc_insertion_point(field_get:kvbench.Stats.pmem_fence_latency)
+  return _internal_pmem_fence_latency();
+}
+inline void Stats::_internal_set_pmem_fence_latency(double value) {
+  
+  _impl_.pmem_fence_latency_ = value;
+}
+inline void Stats::set_pmem_fence_latency(double value) {
+  _internal_set_pmem_fence_latency(value);
+  // @@protoc_insertion_point(field_set:kvbench.Stats.pmem_fence_latency)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 
@@ -493,4 +5678,5 @@ Stats::stat() const {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_kvbench_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_kvbench_2eproto
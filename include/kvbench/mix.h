@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace kvbench {
+
+// Operation types of a MIX phase.
+enum MixOp {
+  kMixRead,
+  kMixUpdate,
+  kMixInsert,
+  kMixDelete,
+  kMixScan,
+  kMixReadModifyWrite,
+  kMixOps,
+};
+
+static const char* const kMixOpNames[kMixOps] = {
+    "read", "update", "insert", "delete", "scan", "rmw",
+};
+
+// Share of every operation type in a MIX phase, and the key distribution
+// the workload is defined with, if any.
+struct OpMix {
+  std::string name;
+  std::vector<double> ratio = std::vector<double>(kMixOps, 0.0);
+  std::string key_random;
+
+  bool Empty() const {
+    return std::all_of(ratio.begin(), ratio.end(),
+                       [](double r) { return r <= 0.0; });
+  }
+
+  double Sum() const {
+    double sum = 0.0;
+    for (double r : ratio) sum += r;
+    return sum;
+  }
+
+  // Fraction of the operations that insert new keys.
+  double InsertFraction() const {
+    return Empty() ? 0.0 : ratio[kMixInsert] / Sum();
+  }
+};
+
+// Parses an operation mix, either one of the YCSB core workloads
+//
+//   ycsb-a   50% read, 50% update, Zipfian
+//   ycsb-b   95% read, 5% update, Zipfian
+//   ycsb-c   100% read, Zipfian
+//   ycsb-d   95% read, 5% insert, latest
+//   ycsb-e   95% scan, 5% insert, Zipfian
+//   ycsb-f   50% read, 50% read-modify-write, Zipfian
+//
+// or a list of ratios such as "read=90,update=10", which don't need to add
+// up to 1 or 100.
+inline OpMix ParseOpMix(const std::string& spec) {
+  OpMix mix;
+  std::string lower = spec;
+  std::transform(lower.begin(), lower.end(), lower.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  mix.name = lower;
+
+  struct Preset {
+    const char* name;
+    double ratio[kMixOps];
+    const char* key_random;
+  };
+  static const Preset kPresets[] = {
+      {"ycsb-a", {50, 50, 0, 0, 0, 0}, "ScrambledZipfian"},
+      {"ycsb-b", {95, 5, 0, 0, 0, 0}, "ScrambledZipfian"},
+      {"ycsb-c", {100, 0, 0, 0, 0, 0}, "ScrambledZipfian"},
+      {"ycsb-d", {95, 0, 5, 0, 0, 0}, "Latest"},
+      {"ycsb-e", {0, 0, 5, 0, 95, 0}, "ScrambledZipfian"},
+      {"ycsb-f", {50, 0, 0, 0, 0, 50}, "ScrambledZipfian"},
+  };
+  for (auto& preset : kPresets) {
+    if (lower != preset.name) continue;
+    mix.ratio.assign(preset.ratio, preset.ratio + kMixOps);
+    mix.key_random = preset.key_random;
+    return mix;
+  }
+
+  size_t pos = 0;
+  while (pos < lower.size()) {
+    size_t end = lower.find(',', pos);
+    if (end == std::string::npos) end = lower.size();
+    std::string item = lower.substr(pos, end - pos);
+    size_t eq = item.find('=');
+    int op = kMixOps;
+    if (eq != std::string::npos)
+      op = std::find(kMixOpNames, kMixOpNames + kMixOps, item.substr(0, eq)) -
+           kMixOpNames;
+    if (op == kMixOps) {
+      std::cerr << "ERROR! invalid operation mix " << spec << "!" << std::endl;
+      exit(-1);
+    }
+    mix.ratio[op] = std::stod(item.substr(eq + 1));
+    pos = end + 1;
+  }
+  if (mix.Empty()) {
+    std::cerr << "ERROR! operation mix " << spec << " is empty!" << std::endl;
+    exit(-1);
+  }
+  return mix;
+}
+
+} // namespace kvbench
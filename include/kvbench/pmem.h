@@ -0,0 +1,150 @@
+#pragma once
+
+#include <sys/vfs.h>
+#include <linux/magic.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include "clock.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace kvbench {
+
+// Persistent memory of the PM engines, real or emulated.
+//
+// Adapters open their pools at Path(), and engines persist through
+// Flush()/Fence() (or Persist(), both at once), which count the cache
+// lines flushed and the fences issued by the calling thread. Flush() writes
+// the lines back with clwb, clflushopt or clflush, whichever the build
+// targets, and Fence() issues an sfence.
+//
+// Emulate() moves the pools to a directory on tmpfs, i.e. to DRAM, and adds
+// a configurable delay to every line flushed and every fence, so that PM
+// engines run on hosts without PM with a cost model of persisting. The pools
+// are marked as PM for PMDK, which would msync() them otherwise.
+//
+// Engines that flush with code of their own are neither counted nor
+// delayed; adapters route the persist calls of such engines here where the
+// engine's API allows, as clevel_hash.cc does for libpmemobj's while PM is
+// emulated. The counts only cover these persist points.
+class PMem {
+ public:
+  struct Counters {
+    uint64_t flushes = 0;  // cache lines
+    uint64_t fences = 0;
+  };
+
+  // Emulates PM in `dir`, adding `flush_ns` per line flushed and `fence_ns`
+  // per fence. Returns false if `dir` isn't on tmpfs, which emulates a
+  // slower PM than intended.
+  static bool Emulate(const std::string& dir, double flush_ns,
+                      double fence_ns) {
+    State& state = Get_();
+    state.dir = dir;
+    state.flush_ns = flush_ns;
+    state.fence_ns = fence_ns;
+    state.flush_ticks = (uint64_t)(flush_ns / Clock::ToNs(1));
+    state.fence_ticks = (uint64_t)(fence_ns / Clock::ToNs(1));
+    setenv("PMEM_IS_PMEM_FORCE", "1", 0);
+    struct statfs fs;
+    return statfs(dir.c_str(), &fs) == 0 && fs.f_type == TMPFS_MAGIC;
+  }
+
+  static bool Emulated() { return !Get_().dir.empty(); }
+
+  static const std::string& Dir() { return Get_().dir; }
+
+  static double FlushLatency() { return Get_().flush_ns; }
+
+  static double FenceLatency() { return Get_().fence_ns; }
+
+  // Where the pool at `path`, e.g. /mnt/pmem0/pool, is: in the emulation
+  // directory under the same file name if PM is emulated, at `path`
+  // otherwise.
+  static std::string Path(const std::string& path) {
+    if (!Emulated()) return path;
+    size_t slash = path.rfind('/');
+    return Get_().dir + "/" +
+           (slash == std::string::npos ? path : path.substr(slash + 1));
+  }
+
+  // Writes back the cache lines of [addr, addr + size).
+  static void Flush(const void* addr, size_t size) {
+    if (size == 0) return;
+    uintptr_t line = (uintptr_t)addr & ~(uintptr_t)(kLineSize - 1);
+    uintptr_t end = (uintptr_t)addr + size;
+    uint64_t lines = 0;
+    for (; line < end; line += kLineSize, ++lines) FlushLine_((void*)line);
+    Counters_().flushes += lines;
+    Delay_(lines * Get_().flush_ticks);
+  }
+
+  // Orders the flushes before it before the stores after it.
+  static void Fence() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_sfence();
+#else
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+    ++Counters_().fences;
+    Delay_(Get_().fence_ticks);
+  }
+
+  static void Persist(const void* addr, size_t size) {
+    Flush(addr, size);
+    Fence();
+  }
+
+  // Flushes and fences of the calling thread so far.
+  static Counters ThreadCounters() { return Counters_(); }
+
+ private:
+  static constexpr size_t kLineSize = 64;
+
+  struct State {
+    std::string dir;  // empty if PM isn't emulated
+    double flush_ns = 0.0;
+    double fence_ns = 0.0;
+    uint64_t flush_ticks = 0;
+    uint64_t fence_ticks = 0;
+  };
+
+  static State& Get_() {
+    static State state;
+    return state;
+  }
+
+  static Counters& Counters_() {
+    thread_local Counters counters;
+    return counters;
+  }
+
+  static void FlushLine_(void* line) {
+#if defined(__CLWB__)
+    _mm_clwb(line);
+#elif defined(__CLFLUSHOPT__)
+    _mm_clflushopt(line);
+#elif defined(__x86_64__) || defined(__i386__)
+    _mm_clflush(line);
+#else
+    (void)line;
+#endif
+  }
+
+  static void Delay_(uint64_t ticks) {
+    if (ticks == 0) return;
+    uint64_t end = Clock::Start() + ticks;
+    while (Clock::Start() < end) {
+#if defined(__x86_64__) || defined(__i386__)
+      _mm_pause();
+#endif
+    }
+  }
+};
+
+} // namespace kvbench
@@ -1,7 +1,21 @@
 #pragma once
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
 #include <random>
 #include <chrono>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace kvbench {
 
@@ -11,66 +25,565 @@ class Random {
   virtual ~Random() {}
 
   virtual T Next() = 0;
+
+  // Returns an independent copy for thread `thread_id` of `nr_thread`,
+  // seeded with `seed`. Returns nullptr if the generator can't be copied,
+  // in which case all threads share this one under a lock.
+  virtual Random<T>* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    return nullptr;
+  }
+
+  // Generators whose values point into memory they own, like string views
+  // into an arena, keep the last `n` values valid. Returns the bytes of
+  // that memory.
+  virtual size_t Reserve(size_t n) { return 0; }
+
+  // Upper bound of the bytes a value points to, 0 if it is self-contained.
+  virtual size_t ItemBytes() const { return 0; }
 };
 
+inline uint64_t RandomSeed() {
+  // https://stackoverflow.com/a/13446015/7640227
+  std::random_device rd;
+  // seed value is designed specifically to make initialization
+  // parameters of std::mt19937 (instance of std::mersenne_twister_engine<>)
+  // different across executions of application
+  return rd() ^ (
+      (uint64_t)
+      std::chrono::duration_cast<std::chrono::seconds>(
+          std::chrono::system_clock::now().time_since_epoch()
+          ).count() +
+      (uint64_t)
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::high_resolution_clock::now().time_since_epoch()
+          ).count() );
+}
+
+// SplitMix64 finalizer, used to derive well-distributed per-thread seeds
+// from a single run seed.
+inline uint64_t SplitMix64(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+// 64-bit FNV-1a hash of an integer, used to scatter generated items over
+// the key space.
+inline uint64_t FNVHash64(uint64_t val) {
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  for (int i = 0; i < 8; ++i) {
+    hash ^= val & 0xff;
+    hash *= 0x100000001B3ULL;
+    val >>= 8;
+  }
+  return hash;
+}
+
 class RandomUniformInt : public Random<int> {
  public:
   RandomUniformInt() : dist_() {
-    // https://stackoverflow.com/a/13446015/7640227
-    std::random_device rd;
-    // seed value is designed specifically to make initialization
-    // parameters of std::mt19937 (instance of std::mersenne_twister_engine<>)
-    // different across executions of application
-    std::mt19937::result_type seed = rd() ^ (
-            (std::mt19937::result_type)
-            std::chrono::duration_cast<std::chrono::seconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-                ).count() +
-            (std::mt19937::result_type)
-            std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::high_resolution_clock::now().time_since_epoch()
-                ).count() );
-    gen_.seed(seed);
+    gen_.seed(RandomSeed());
   }
 
   int Next() {
     return dist_(gen_);
   }
 
+  void Seed(uint64_t seed) { gen_.seed(seed); }
+
+  RandomUniformInt* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomUniformInt(*this);
+    random->Seed(seed);
+    return random;
+  }
+
  private:
   std::mt19937 gen_;
   std::uniform_int_distribution<int> dist_;
 };
 
-class RandomUniformUint64 : public Random<int> {
+// Uniform over [min, max], the whole 64-bit space by default.
+class RandomUniformUint64 : public Random<uint64_t> {
  public:
-  RandomUniformUint64() : dist_() {
-    // https://stackoverflow.com/a/13446015/7640227
-    std::random_device rd;
-    // seed value is designed specifically to make initialization
-    // parameters of std::mt19937 (instance of std::mersenne_twister_engine<>)
-    // different across executions of application
-    std::mt19937_64::result_type seed = rd() ^ (
-            (std::mt19937_64::result_type)
-            std::chrono::duration_cast<std::chrono::seconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-                ).count() +
-            (std::mt19937_64::result_type)
-            std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::high_resolution_clock::now().time_since_epoch()
-                ).count() );
-    gen_.seed(seed);
+  RandomUniformUint64(uint64_t min = 0, uint64_t max = UINT64_MAX)
+      : dist_(min, max) {
+    gen_.seed(RandomSeed());
   }
 
-  int Next() {
+  uint64_t Next() {
     return dist_(gen_);
   }
 
+  void Seed(uint64_t seed) { gen_.seed(seed); }
+
+  RandomUniformUint64* Fork(uint64_t seed, int thread_id,
+                            int nr_thread) const {
+    auto random = new RandomUniformUint64(*this);
+    random->Seed(seed);
+    return random;
+  }
+
  private:
   std::mt19937_64 gen_;
   std::uniform_int_distribution<uint64_t> dist_;
 };
 
+// start, start + stride, start + 2 * stride, ...
+class RandomSequential : public Random<uint64_t> {
+ public:
+  RandomSequential(uint64_t start = 0, uint64_t stride = 1)
+      : next_(start), stride_(stride) {}
+
+  uint64_t Next() {
+    uint64_t ret = next_;
+    next_ += stride_;
+    return ret;
+  }
+
+  // Threads interleave: thread i gets next + i, next + i + nr_thread, ...
+  RandomSequential* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    return new RandomSequential(next_ + thread_id * stride_,
+                                stride_ * nr_thread);
+  }
+
+ private:
+  uint64_t next_;
+  uint64_t stride_;
+};
+
+// Zipfian over [0, items), item 0 is the most popular one. Uses the
+// algorithm from "Quickly Generating Billion-Record Synthetic Databases"
+// (Gray et al., SIGMOD 1994), the same one used by YCSB.
+class RandomZipfian : public Random<uint64_t> {
+ public:
+  static constexpr double kDefaultTheta = 0.99;
+
+  RandomZipfian(uint64_t items, double theta = kDefaultTheta)
+      : items_(items), theta_(theta), dist_(0.0, 1.0) {
+    gen_.seed(RandomSeed());
+    zeta2_ = Zeta(2, theta_);
+    zetan_ = Zeta(items_, theta_);
+    alpha_ = 1.0 / (1.0 - theta_);
+    eta_ = (1 - std::pow(2.0 / items_, 1 - theta_)) / (1 - zeta2_ / zetan_);
+  }
+
+  // zeta(n) = sum of 1 / i^theta for i in [1, n]. The first kExactZetaTerms
+  // terms are summed, the rest is approximated by the Euler-Maclaurin
+  // formula, whose error is below the rounding of the sum from there on, so
+  // that large key spaces don't take O(n) to set up. Results are cached
+  // per (n, theta).
+  static double Zeta(uint64_t n, double theta) {
+    static std::mutex mutex;
+    static std::map<std::pair<uint64_t, double>, double> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = cache.find({n, theta});
+    if (iter != cache.end()) return iter->second;
+
+    uint64_t m = std::min(n, kExactZetaTerms);
+    double sum = 0.0;
+    for (uint64_t i = 1; i <= m; ++i)
+      sum += 1.0 / std::pow(i, theta);
+    if (n > m) {
+      // sum of f(i) for i in (m, n], f(x) = x^-theta
+      double a = m, b = n;
+      double integral = theta == 1.0 ? std::log(b / a)
+                                     : (std::pow(b, 1 - theta) -
+                                        std::pow(a, 1 - theta)) / (1 - theta);
+      double fa = std::pow(a, -theta), fb = std::pow(b, -theta);
+      sum += integral + (fb - fa) / 2 + theta * (fa / a - fb / b) / 12;
+    }
+    cache.emplace(std::make_pair(n, theta), sum);
+    return sum;
+  }
+
+  uint64_t Next() {
+    double u = dist_(gen_);
+    double uz = u * zetan_;
+    if (uz < 1.0) return 0;
+    if (uz < 1.0 + std::pow(0.5, theta_)) return 1;
+    uint64_t ret = items_ * std::pow(eta_ * u - eta_ + 1, alpha_);
+    return ret < items_ ? ret : items_ - 1;
+  }
+
+  uint64_t Items() const { return items_; }
+
+  void Seed(uint64_t seed) { gen_.seed(seed); }
+
+  RandomZipfian* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomZipfian(*this);
+    random->Seed(seed);
+    return random;
+  }
+
+ private:
+  uint64_t items_;
+  double theta_;
+  double zeta2_;
+  double zetan_;
+  double alpha_;
+  double eta_;
+  std::mt19937_64 gen_;
+  std::uniform_real_distribution<double> dist_;
+
+  static constexpr uint64_t kExactZetaTerms = 1 << 16;
+};
+
+// Zipfian whose popular items are scattered over [0, items) by hashing
+// instead of being clustered at the beginning of the key space.
+class RandomScrambledZipfian : public Random<uint64_t> {
+ public:
+  RandomScrambledZipfian(uint64_t items,
+                         double theta = RandomZipfian::kDefaultTheta)
+      : zipf_(items, theta) {}
+
+  uint64_t Next() {
+    return FNVHash64(zipf_.Next()) % zipf_.Items();
+  }
+
+  RandomScrambledZipfian* Fork(uint64_t seed, int thread_id,
+                               int nr_thread) const {
+    auto random = new RandomScrambledZipfian(*this);
+    random->zipf_.Seed(seed);
+    return random;
+  }
+
+ private:
+  RandomZipfian zipf_;
+};
+
+// YCSB "latest": Zipfian skewed towards the most recently inserted items,
+// i.e. the end of [0, items).
+class RandomLatest : public Random<uint64_t> {
+ public:
+  RandomLatest(uint64_t items, double theta = RandomZipfian::kDefaultTheta)
+      : zipf_(items, theta) {}
+
+  uint64_t Next() {
+    return zipf_.Items() - 1 - zipf_.Next();
+  }
+
+  RandomLatest* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomLatest(*this);
+    random->zipf_.Seed(seed);
+    return random;
+  }
+
+ private:
+  RandomZipfian zipf_;
+};
+
+// `hot_op_fraction` of the operations go to the first `hot_set_fraction`
+// of [0, items), the rest are spread uniformly over the cold items.
+class RandomHotspot : public Random<uint64_t> {
+ public:
+  RandomHotspot(uint64_t items, double hot_set_fraction = 0.2,
+                double hot_op_fraction = 0.8)
+      : hot_op_fraction_(hot_op_fraction), op_dist_(0.0, 1.0) {
+    gen_.seed(RandomSeed());
+    uint64_t hot_items = items * hot_set_fraction;
+    if (hot_items == 0) hot_items = 1;
+    if (hot_items > items) hot_items = items;
+    hot_dist_ = std::uniform_int_distribution<uint64_t>(0, hot_items - 1);
+    if (hot_items < items)
+      cold_dist_ = std::uniform_int_distribution<uint64_t>(hot_items, items - 1);
+    else
+      hot_op_fraction_ = 1.0;
+  }
+
+  uint64_t Next() {
+    if (op_dist_(gen_) < hot_op_fraction_)
+      return hot_dist_(gen_);
+    return cold_dist_(gen_);
+  }
+
+  RandomHotspot* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomHotspot(*this);
+    random->gen_.seed(seed);
+    return random;
+  }
+
+ private:
+  double hot_op_fraction_;
+  std::mt19937_64 gen_;
+  std::uniform_real_distribution<double> op_dist_;
+  std::uniform_int_distribution<uint64_t> hot_dist_;
+  std::uniform_int_distribution<uint64_t> cold_dist_;
+};
+
+// Draws i in [0, weights.size()) with probability proportional to
+// weights[i] in O(1), using Vose's alias method: one 64-bit draw picks a
+// column with its upper half and decides between the column and its alias
+// with the lower half.
+class RandomAlias : public Random<int> {
+ public:
+  explicit RandomAlias(const std::vector<double>& weights)
+      : prob_(weights.size()), alias_(weights.size()) {
+    gen_.seed(RandomSeed());
+    size_t n = weights.size();
+    double sum = 0.0;
+    for (double weight : weights) sum += weight;
+    std::vector<double> scaled(n);
+    std::vector<int> small, large;
+    for (size_t i = 0; i < n; ++i) {
+      scaled[i] = weights[i] * n / sum;
+      (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      int s = small.back(), l = large.back();
+      small.pop_back();
+      prob_[s] = scaled[s] * 4294967296.0;
+      alias_[s] = l;
+      scaled[l] -= 1.0 - scaled[s];
+      if (scaled[l] < 1.0) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // what is left has a probability of 1 up to rounding errors
+    for (int i : small) prob_[i] = 1ULL << 32, alias_[i] = i;
+    for (int i : large) prob_[i] = 1ULL << 32, alias_[i] = i;
+  }
+
+  int Next() {
+    uint64_t r = gen_();
+    size_t column = ((r >> 32) * prob_.size()) >> 32;
+    return (uint32_t)r < prob_[column] ? column : alias_[column];
+  }
+
+  void Seed(uint64_t seed) { gen_.seed(seed); }
+
+  RandomAlias* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomAlias(*this);
+    random->Seed(seed);
+    return random;
+  }
+
+ private:
+  std::vector<uint64_t> prob_;  // scaled to 2^32
+  std::vector<int> alias_;
+  std::mt19937_64 gen_;
+};
+
+// Shifts the output of another generator by `offset`.
+class RandomOffset : public Random<uint64_t> {
+ public:
+  RandomOffset(Random<uint64_t>* random, uint64_t offset)
+      : random_(random), offset_(offset) {}
+
+  ~RandomOffset() { delete random_; }
+
+  uint64_t Next() { return offset_ + random_->Next(); }
+
+  RandomOffset* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    Random<uint64_t>* random = random_->Fork(seed, thread_id, nr_thread);
+    return random ? new RandomOffset(random, offset_) : nullptr;
+  }
+
+ private:
+  Random<uint64_t>* random_;
+  uint64_t offset_;
+};
+
+// Serializes access to a generator that can't be forked per thread.
+template<typename T>
+class RandomLocked : public Random<T> {
+ public:
+  RandomLocked(Random<T>* random, std::mutex* mutex)
+      : random_(random), mutex_(mutex) {}
+
+  T Next() {
+    std::lock_guard<std::mutex> lock(*mutex_);
+    return random_->Next();
+  }
+
+ private:
+  Random<T>* random_;
+  std::mutex* mutex_;
+};
+
+// Sizes in bytes drawn from a spec of the form
+//
+//   Fixed:n                    always n, a plain "n" works as well
+//   Uniform:min:max            uniform over [min, max]
+//   Zipfian:min:max[:theta]    Zipfian over [min, max], min is the most
+//                              popular size, theta defaults to 0.99
+//
+// Size() maps a uniform 64-bit number to a size through the inverse CDF, so
+// that a key always gets the same size when it is derived from its id.
+class SizeDistribution {
+ public:
+  explicit SizeDistribution(const std::string& spec) {
+    std::vector<std::string> args;
+    size_t pos = 0;
+    while (true) {
+      size_t end = spec.find(':', pos);
+      args.push_back(spec.substr(pos, end - pos));
+      if (end == std::string::npos) break;
+      pos = end + 1;
+    }
+    auto param = [&](size_t i) -> size_t {
+      if (args.size() <= i) {
+        std::cerr << "ERROR! size distribution " << spec
+                  << " lacks a parameter!" << std::endl;
+        exit(-1);
+      }
+      return std::stoull(args[i]);
+    };
+    const std::string& name = args[0];
+    if (!name.empty() && std::isdigit((unsigned char)name[0])) {
+      min_ = max_ = std::stoull(name);
+    } else if (name == "Fixed") {
+      min_ = max_ = param(1);
+    } else if (name == "Uniform" || name == "Zipfian") {
+      min_ = param(1);
+      max_ = std::max(param(2), min_);
+    } else {
+      std::cerr << "ERROR! unknown size distribution " << spec << "!"
+                << std::endl;
+      exit(-1);
+    }
+    if (name == "Zipfian") {
+      double theta =
+          args.size() > 3 ? std::stod(args[3]) : RandomZipfian::kDefaultTheta;
+      cdf_.resize(max_ - min_ + 1);
+      double sum = 0.0;
+      for (size_t i = 0; i < cdf_.size(); ++i)
+        cdf_[i] = sum += 1.0 / std::pow(i + 1, theta);
+      for (double& p : cdf_) p /= sum;
+    }
+  }
+
+  size_t Size(uint64_t u) const {
+    if (min_ == max_) return min_;
+    if (cdf_.empty()) return min_ + u % (max_ - min_ + 1);
+    double p = (u >> 11) * (1.0 / 9007199254740992.0);
+    return min_ + (std::lower_bound(cdf_.begin(), cdf_.end() - 1, p) -
+                   cdf_.begin());
+  }
+
+  size_t Min() const { return min_; }
+
+  size_t Max() const { return max_; }
+
+ private:
+  size_t min_ = 0;
+  size_t max_ = 0;
+  std::vector<double> cdf_;  // Zipfian only
+};
+
+// Writes key `id` as `size` bytes, at least 8: the id in big-endian, so
+// that keys sort like their ids, padded with bytes derived from it.
+inline void RenderKey(uint64_t id, size_t size, char* out) {
+  for (int i = 0; i < 8; ++i) out[i] = (char)(id >> (56 - 8 * i));
+  uint64_t pad = id;
+  for (size_t i = 8; i < size; i += 8) {
+    pad = SplitMix64(pad);
+    std::memcpy(out + i, &pad, std::min<size_t>(8, size - i));
+  }
+}
+
+// String keys drawn by a uint64_t generator, so that they follow any of
+// its distributions, and rendered with RenderKey() into a ring arena of the
+// generator. A key's size is derived from its id. The arena holds the last
+// `window` keys, see Reserve(), and is allocated on first use, i.e. on the
+// thread that generates the keys.
+class RandomStringKey : public Random<std::string_view> {
+ public:
+  RandomStringKey(Random<uint64_t>* random_id, const SizeDistribution& sizes)
+      : random_id_(random_id), sizes_(sizes) {}
+
+  RandomStringKey(const RandomStringKey&) = delete;
+  RandomStringKey& operator=(const RandomStringKey&) = delete;
+
+  ~RandomStringKey() { delete random_id_; }
+
+  std::string_view Next() { return Key(random_id_->Next()); }
+
+  // Key of item `id` of the key space, e.g. of a trace record.
+  std::string_view Key(uint64_t id) {
+    size_t size = std::max<size_t>(sizes_.Size(FNVHash64(id)), 8);
+    if (arena_.empty()) arena_.resize(Capacity_());
+    if (pos_ + size > arena_.size()) pos_ = 0;
+    char* key = arena_.data() + pos_;
+    RenderKey(id, size, key);
+    pos_ += size;
+    return std::string_view(key, size);
+  }
+
+  RandomStringKey* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    Random<uint64_t>* random_id = random_id_->Fork(seed, thread_id, nr_thread);
+    if (random_id == nullptr) return nullptr;
+    auto random = new RandomStringKey(random_id, sizes_);
+    random->window_ = window_;
+    return random;
+  }
+
+  size_t Reserve(size_t n) {
+    window_ = std::max<size_t>(n, 1);
+    arena_.clear();
+    arena_.shrink_to_fit();
+    return Capacity_();
+  }
+
+  size_t ItemBytes() const { return MaxSize_(); }
+
+ private:
+  static constexpr size_t kDefaultWindow = 64;
+
+  Random<uint64_t>* random_id_;
+  SizeDistribution sizes_;
+  size_t window_ = kDefaultWindow;
+  std::vector<char> arena_;
+  size_t pos_ = 0;
+
+  size_t MaxSize_() const { return std::max<size_t>(sizes_.Max(), 8); }
+
+  // wraps around before a key would cross the end, so one more key fits
+  size_t Capacity_() const { return (window_ + 1) * MaxSize_(); }
+};
+
+// String values of random sizes. Their content doesn't matter to the
+// engines, so they are views at random offsets into a pool of random bytes
+// owned by the generator, which stay valid as long as it does.
+class RandomStringValue : public Random<std::string_view> {
+ public:
+  explicit RandomStringValue(const SizeDistribution& sizes) : sizes_(sizes) {
+    gen_.seed(RandomSeed());
+  }
+
+  std::string_view Next() {
+    if (pool_.empty()) Fill_();
+    uint64_t r = gen_();
+    size_t size = sizes_.Size(r);
+    size_t offset = (r >> 32) % (pool_.size() - size + 1);
+    return std::string_view(pool_.data() + offset, size);
+  }
+
+  RandomStringValue* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomStringValue(sizes_);
+    random->gen_.seed(seed);
+    return random;
+  }
+
+  size_t Reserve(size_t n) { return kPoolBytes + sizes_.Max(); }
+
+ private:
+  static constexpr size_t kPoolBytes = 64 << 10;
+
+  SizeDistribution sizes_;
+  std::mt19937_64 gen_;
+  std::vector<char> pool_;
+
+  void Fill_() {
+    pool_.resize(kPoolBytes + sizes_.Max());
+    for (size_t i = 0; i < pool_.size(); i += 8) {
+      uint64_t r = gen_();
+      std::memcpy(pool_.data() + i, &r, std::min<size_t>(8, pool_.size() - i));
+    }
+  }
+};
+
 template<typename T>
 class RandomDefault {};
 
@@ -79,6 +592,12 @@ class RandomDefault<int> : public Random<int> {
  public:
   int Next() { return rnd_.Next(); }
 
+  RandomDefault* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomDefault(*this);
+    random->rnd_.Seed(seed);
+    return random;
+  }
+
  private:
   RandomUniformInt rnd_;
 };
@@ -88,6 +607,12 @@ class RandomDefault<uint64_t> : public Random<uint64_t> {
  public:
   uint64_t Next() { return rnd_.Next(); }
 
+  RandomDefault* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    auto random = new RandomDefault(*this);
+    random->rnd_.Seed(seed);
+    return random;
+  }
+
  private:
   RandomUniformUint64 rnd_;
 };
@@ -97,6 +622,108 @@ class RandomDefault<std::string> : public Random<std::string> {
  public:
   std::string Next() { return "test"; }
 
+  RandomDefault* Fork(uint64_t seed, int thread_id, int nr_thread) const {
+    return new RandomDefault();
+  }
+
 };
 
-} // namespace kvbench
\ No newline at end of file
+// Creates a generator from a spec of the form "Name[:param[:param]]":
+//
+//   RandomDefault              default generator of T
+//   RandomUniformUint64        uniform over the whole 64-bit space
+//   Uniform                    uniform over the key space
+//   Sequential                 first, first + 1, ...
+//   Zipfian[:theta]            Zipfian, theta defaults to 0.99
+//   ScrambledZipfian[:theta]   hashed Zipfian
+//   Latest[:theta]             Zipfian skewed towards the last items
+//   Hotspot[:set[:ops]]        `ops` of the operations on `set` of the keys,
+//                              set defaults to 0.2 and ops to 0.8
+//
+// The key space is [first, first + items). Types other than uint64_t only
+// support RandomDefault.
+template<typename T>
+Random<T>* NewRandom(const std::string& spec, uint64_t first, uint64_t items) {
+  if (spec.empty() || spec == "RandomDefault")
+    return new RandomDefault<T>();
+  std::cerr << "ERROR! random generator " << spec
+            << " is not supported for this type!" << std::endl;
+  exit(-1);
+}
+
+template<>
+inline Random<uint64_t>* NewRandom<uint64_t>(const std::string& spec,
+                                             uint64_t first, uint64_t items) {
+  std::vector<std::string> args;
+  size_t pos = 0;
+  while (true) {
+    size_t end = spec.find(':', pos);
+    args.push_back(spec.substr(pos, end - pos));
+    if (end == std::string::npos) break;
+    pos = end + 1;
+  }
+  auto param = [&args](size_t i, double def) {
+    return args.size() > i ? std::stod(args[i]) : def;
+  };
+  if (items == 0) items = 1;
+
+  const std::string& name = args[0];
+  Random<uint64_t>* random = nullptr;
+  if (name.empty() || name == "RandomDefault")
+    return new RandomDefault<uint64_t>();
+  if (name == "RandomUniformUint64")
+    return new RandomUniformUint64();
+  if (name == "Uniform")
+    return new RandomUniformUint64(first, first + items - 1);
+  if (name == "Sequential")
+    return new RandomSequential(first);
+
+  if (name == "Zipfian")
+    random = new RandomZipfian(items, param(1, RandomZipfian::kDefaultTheta));
+  else if (name == "ScrambledZipfian")
+    random = new RandomScrambledZipfian(
+        items, param(1, RandomZipfian::kDefaultTheta));
+  else if (name == "Latest")
+    random = new RandomLatest(items, param(1, RandomZipfian::kDefaultTheta));
+  else if (name == "Hotspot")
+    random = new RandomHotspot(items, param(1, 0.2), param(2, 0.8));
+
+  if (random == nullptr) {
+    std::cerr << "ERROR! unknown random generator " << spec << "!" << std::endl;
+    exit(-1);
+  }
+  return first == 0 ? random : new RandomOffset(random, first);
+}
+
+// Whether keys of type T are drawn by the uint64_t generators, i.e.
+// support all distributions of NewRandom().
+template<typename T>
+constexpr bool HasKeyIds() {
+  return std::is_same<T, uint64_t>::value ||
+         std::is_same<T, std::string_view>::value;
+}
+
+// Generators of keys and values of type T. Integer keys and values come
+// from NewRandom(). String views are keys of ids drawn by NewRandom() and
+// values of random bytes, with sizes drawn from `size_spec`, see
+// SizeDistribution.
+template<typename T>
+Random<T>* NewRandomKey(const std::string& spec, const std::string& size_spec,
+                        uint64_t first, uint64_t items) {
+  if constexpr (std::is_same<T, std::string_view>::value)
+    return new RandomStringKey(NewRandom<uint64_t>(spec, first, items),
+                               SizeDistribution(size_spec));
+  else
+    return NewRandom<T>(spec, first, items);
+}
+
+template<typename T>
+Random<T>* NewRandomValue(const std::string& spec,
+                          const std::string& size_spec, uint64_t items) {
+  if constexpr (std::is_same<T, std::string_view>::value)
+    return new RandomStringValue(SizeDistribution(size_spec));
+  else
+    return NewRandom<T>(spec, 0, items);
+}
+
+} // namespace kvbench
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace kvbench {
+
+// Resources the process used so far, from getrusage().
+struct ResourceUsage {
+  double user_time = 0.0;  // us
+  double sys_time = 0.0;   // us
+  uint64_t minor_faults = 0;
+  uint64_t major_faults = 0;
+  uint64_t voluntary_switches = 0;
+  uint64_t involuntary_switches = 0;
+
+  static ResourceUsage Now() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    ResourceUsage now;
+    now.user_time = usage.ru_utime.tv_sec * 1e6 + usage.ru_utime.tv_usec;
+    now.sys_time = usage.ru_stime.tv_sec * 1e6 + usage.ru_stime.tv_usec;
+    now.minor_faults = usage.ru_minflt;
+    now.major_faults = usage.ru_majflt;
+    now.voluntary_switches = usage.ru_nvcsw;
+    now.involuntary_switches = usage.ru_nivcsw;
+    return now;
+  }
+
+  ResourceUsage operator-(const ResourceUsage& other) const {
+    ResourceUsage diff;
+    diff.user_time = user_time - other.user_time;
+    diff.sys_time = sys_time - other.sys_time;
+    diff.minor_faults = minor_faults - other.minor_faults;
+    diff.major_faults = major_faults - other.major_faults;
+    diff.voluntary_switches = voluntary_switches - other.voluntary_switches;
+    diff.involuntary_switches =
+        involuntary_switches - other.involuntary_switches;
+    return diff;
+  }
+};
+
+// Resident set size of the process in bytes, from /proc/self/statm.
+inline uint64_t ResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size = 0, resident = 0;
+  if (!(statm >> size >> resident)) return 0;
+  return resident * sysconf(_SC_PAGESIZE);
+}
+
+// Samples the resident set size every `interval` between Start() and
+// Stop() and keeps its peak, which getrusage() only has for the whole run.
+class PeakRssSampler {
+ public:
+  explicit PeakRssSampler(std::chrono::milliseconds interval)
+      : interval_(interval) {}
+
+  ~PeakRssSampler() { Stop(); }
+
+  void Start() {
+    peak_ = ResidentBytes();
+    stop_ = false;
+    thread_ = std::thread([this] {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (!cv_.wait_for(lock, interval_, [this] { return stop_; }))
+        peak_ = std::max(peak_, ResidentBytes());
+    });
+  }
+
+  // Returns the peak, including a last sample.
+  uint64_t Stop() {
+    if (thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_one();
+      thread_.join();
+      peak_ = std::max(peak_, ResidentBytes());
+    }
+    return peak_;
+  }
+
+ private:
+  std::chrono::milliseconds interval_;
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+  uint64_t peak_ = 0;
+};
+
+} // namespace kvbench
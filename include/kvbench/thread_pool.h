@@ -0,0 +1,113 @@
+#pragma once
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace kvbench {
+
+inline void FutexWait(std::atomic<uint32_t>* addr, uint32_t val) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT_PRIVATE,
+          val, nullptr, nullptr, 0);
+}
+
+inline void FutexWake(std::atomic<uint32_t>* addr, int count = INT_MAX) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE_PRIVATE,
+          count, nullptr, nullptr, 0);
+}
+
+// Worker threads shared by all phases of a run. Workers are created on
+// demand, set up once by `init` (e.g. pinned) and then reused, so
+// thread-local engine state survives from one phase to the next. Workers
+// that a phase doesn't need sleep on a futex of their own and aren't woken.
+class ThreadPool {
+ public:
+  explicit ThreadPool(std::function<void(int)> init = nullptr)
+      : init_(init) {}
+
+  ~ThreadPool() { Shutdown(); }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int Size() const { return workers_.size(); }
+
+  // Runs `task(thread_id)` on workers 0 .. nr_thread - 1 without waiting
+  // for it to finish. Only one task may run at a time.
+  void Start(int nr_thread, std::function<void(int)> task) {
+    while (Size() < nr_thread) {
+      workers_.emplace_back(new Worker());
+      workers_.back()->thread = std::thread(&ThreadPool::WorkerMain_, this,
+                                            Size() - 1, workers_.back().get());
+    }
+    task_ = std::move(task);
+    remaining_.store(nr_thread, std::memory_order_relaxed);
+    for (int i = 0; i < nr_thread; ++i) {
+      workers_[i]->sequence.fetch_add(1, std::memory_order_release);
+      FutexWake(&workers_[i]->sequence, 1);
+    }
+  }
+
+  // Waits for the task started by Start() to finish on all its workers.
+  void Wait() {
+    uint32_t remaining;
+    while ((remaining = remaining_.load(std::memory_order_acquire)) != 0)
+      FutexWait(&remaining_, remaining);
+  }
+
+  void Run(int nr_thread, std::function<void(int)> task) {
+    Start(nr_thread, std::move(task));
+    Wait();
+  }
+
+  void Shutdown() {
+    stop_.store(true, std::memory_order_release);
+    for (auto& worker : workers_) {
+      worker->sequence.fetch_add(1, std::memory_order_release);
+      FutexWake(&worker->sequence);
+    }
+    for (auto& worker : workers_)
+      if (worker->thread.joinable()) worker->thread.join();
+    workers_.clear();
+    // Start() creates new workers
+    stop_.store(false, std::memory_order_release);
+  }
+
+ private:
+  struct alignas(64) Worker {
+    std::atomic<uint32_t> sequence{0};
+    std::thread thread;
+  };
+
+  std::function<void(int)> init_;
+  std::function<void(int)> task_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  alignas(64) std::atomic<uint32_t> remaining_{0};
+  std::atomic<bool> stop_{false};
+
+  void WorkerMain_(int thread_id, Worker* worker) {
+    if (init_) init_(thread_id);
+    uint32_t seen = 0;
+    while (true) {
+      uint32_t sequence;
+      while ((sequence = worker->sequence.load(std::memory_order_acquire)) ==
+             seen)
+        FutexWait(&worker->sequence, seen);
+      seen = sequence;
+      if (stop_.load(std::memory_order_acquire)) return;
+      task_(thread_id);
+      if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        FutexWake(&remaining_);
+    }
+  }
+};
+
+} // namespace kvbench
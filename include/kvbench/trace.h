@@ -0,0 +1,223 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mix.h"
+#include "random.h"
+
+namespace kvbench {
+
+// Binary operation trace replayed by TRACE phases: a TraceHeader followed
+// by `count` fixed-size TraceRecords, so that the file can be mapped and
+// replayed in place. `op` is a MixOp, `timestamp` is in nanoseconds and
+// only meaningful if the header has kTraceTimestamps set. The value size of
+// a scan is its length.
+struct TraceHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint64_t count;
+  uint64_t reserved;
+};
+
+struct TraceRecord {
+  uint64_t key;
+  uint64_t timestamp;
+  uint32_t value_size;
+  uint8_t op;
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(TraceHeader) == 32, "unexpected TraceHeader layout");
+static_assert(sizeof(TraceRecord) == 24, "unexpected TraceRecord layout");
+
+static const char kTraceMagic[8] = {'K', 'V', 'B', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t kTraceVersion = 1;
+static const uint32_t kTraceTimestamps = 1;
+
+// Key of the bench's key type for a trace key.
+template <typename Key>
+Key TraceKey(uint64_t key) {
+  return static_cast<Key>(key);
+}
+
+template <>
+inline std::string TraceKey<std::string>(uint64_t key) {
+  return std::to_string(key);
+}
+
+// 8-byte keys rendered like RandomStringKey renders ids, valid until the
+// next call on the thread. Benches with a RandomStringKey render the keys
+// with its sizes instead, see OpSource::TraceKey().
+template <>
+inline std::string_view TraceKey<std::string_view>(uint64_t key) {
+  thread_local char buffer[8];
+  RenderKey(key, sizeof(buffer), buffer);
+  return std::string_view(buffer, sizeof(buffer));
+}
+
+// Read-only mapping of a trace file. The pages are populated and the
+// records checked when the file is opened, before any phase timer runs.
+class TraceFile {
+ public:
+  explicit TraceFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+      std::cerr << "ERROR! can't open trace " << path << "!" << std::endl;
+      exit(-1);
+    }
+    length_ = st.st_size;
+    if (length_ < sizeof(TraceHeader)) {
+      std::cerr << "ERROR! " << path << " is not a trace!" << std::endl;
+      exit(-1);
+    }
+    addr_ = mmap(nullptr, length_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd,
+                 0);
+    close(fd);
+    if (addr_ == MAP_FAILED) {
+      std::cerr << "ERROR! can't map trace " << path << "!" << std::endl;
+      exit(-1);
+    }
+    header_ = static_cast<const TraceHeader*>(addr_);
+    records_ = reinterpret_cast<const TraceRecord*>(header_ + 1);
+    if (memcmp(header_->magic, kTraceMagic, sizeof(kTraceMagic)) != 0 ||
+        header_->version != kTraceVersion ||
+        header_->count > (length_ - sizeof(TraceHeader)) / sizeof(TraceRecord)) {
+      std::cerr << "ERROR! " << path << " is not a valid trace!" << std::endl;
+      exit(-1);
+    }
+    for (size_t i = 0; i < Size(); ++i) {
+      if (records_[i].op >= kMixOps) {
+        std::cerr << "ERROR! invalid operation in record " << i << " of "
+                  << path << "!" << std::endl;
+        exit(-1);
+      }
+    }
+  }
+
+  ~TraceFile() { munmap(addr_, length_); }
+
+  TraceFile(const TraceFile&) = delete;
+  TraceFile& operator=(const TraceFile&) = delete;
+
+  const TraceRecord* Records() const { return records_; }
+
+  size_t Size() const { return header_->count; }
+
+  bool HasTimestamps() const { return header_->flags & kTraceTimestamps; }
+
+ private:
+  void* addr_;
+  size_t length_;
+  const TraceHeader* header_;
+  const TraceRecord* records_;
+};
+
+// The part of the first `size` records of a trace that one of `nr_thread`
+// threads replays, in trace order: every nr_thread-th record
+// (round-robin), or all records whose key hashes to the thread so that the
+// operations on one key stay ordered. The latter needs an index, built by
+// Prepare() on the replaying thread.
+class TraceShard {
+ public:
+  TraceShard(const TraceFile& trace, size_t size, int thread_id,
+             int nr_thread, bool by_key)
+      : records_(trace.Records()),
+        size_(size),
+        thread_id_(thread_id),
+        nr_thread_(nr_thread),
+        by_key_(by_key),
+        first_timestamp_(size ? trace.Records()[0].timestamp : 0) {}
+
+  void Prepare() {
+    if (!by_key_) return;
+    index_.clear();
+    for (size_t i = 0; i < size_; ++i)
+      if (FNVHash64(records_[i].key) % nr_thread_ == (uint64_t)thread_id_)
+        index_.push_back(i);
+  }
+
+  size_t Size() const {
+    if (by_key_) return index_.size();
+    return size_ > (size_t)thread_id_
+               ? (size_ - thread_id_ + nr_thread_ - 1) / nr_thread_
+               : 0;
+  }
+
+  const TraceRecord& Next() {
+    size_t i = pos_++;
+    return by_key_ ? records_[index_[i]]
+                   : records_[thread_id_ + i * nr_thread_];
+  }
+
+  // Time of `record` relative to the first record of the trace, in ns.
+  uint64_t Offset(const TraceRecord& record) const {
+    return record.timestamp - first_timestamp_;
+  }
+
+ private:
+  const TraceRecord* records_;
+  size_t size_;
+  int thread_id_;
+  int nr_thread_;
+  bool by_key_;
+  uint64_t first_timestamp_;
+  std::vector<uint64_t> index_;
+  size_t pos_ = 0;
+};
+
+// Writes a trace, used by the converter in tools/. The trace is marked as
+// timed if any record has a timestamp.
+class TraceWriter {
+ public:
+  explicit TraceWriter(const std::string& path) {
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr) {
+      std::cerr << "ERROR! can't create trace " << path << "!" << std::endl;
+      exit(-1);
+    }
+    memset(&header_, 0, sizeof(header_));
+    memcpy(header_.magic, kTraceMagic, sizeof(kTraceMagic));
+    header_.version = kTraceVersion;
+    fwrite(&header_, sizeof(header_), 1, file_);
+  }
+
+  ~TraceWriter() {
+    fseek(file_, 0, SEEK_SET);
+    fwrite(&header_, sizeof(header_), 1, file_);
+    fclose(file_);
+  }
+
+  void Append(MixOp op, uint64_t key, uint32_t value_size,
+              uint64_t timestamp = 0) {
+    TraceRecord record;
+    memset(&record, 0, sizeof(record));
+    record.key = key;
+    record.timestamp = timestamp;
+    record.value_size = value_size;
+    record.op = op;
+    if (timestamp) header_.flags |= kTraceTimestamps;
+    fwrite(&record, sizeof(record), 1, file_);
+    ++header_.count;
+  }
+
+  uint64_t Count() const { return header_.count; }
+
+ private:
+  FILE* file_;
+  TraceHeader header_;
+};
+
+} // namespace kvbench
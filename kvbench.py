@@ -386,9 +386,62 @@ for bench in settings["bench"]:
 
         # run task
         task_arg = ""
+        # -pregenerate only applies to the phases after it
+        if "pregenerateMB" in settings:
+            task_arg += " -pregenerate " + str(settings["pregenerateMB"])
         for phase in settings["phase"]:
-            task_arg += " " + phase["type"] + " " + str(phase["size"])
+            # the harness keeps these options across phases, so every phase
+            # passes them, with the defaults if neither it nor the bench sets
+            # them. MIX phases with a YCSB preset keep the preset's key
+            # distribution unless they set their own.
+            if (phase["type"] == "MIX" and "keyRandom" not in phase and
+                    phase.get("mix", "").startswith("ycsb-")):
+                key_random = ""
+            else:
+                key_random = phase.get("keyRandom", bench.get("keyRandom", "RandomDefault"))
+            if key_random:
+                task_arg += " -key-random " + key_random
+            task_arg += " -value-random " + phase.get("valueRandom", bench.get("valueRandom", "RandomDefault"))
+            for key, arg, default in [("keySize", "-key-size", "Fixed:16"),
+                                      ("valueSize", "-value-size", "Fixed:100")]:
+                task_arg += " " + arg + " " + str(phase.get(key, bench.get(key, default)))
+            task_arg += " -latency-batch " + str(phase.get("latencyBatch", 0))
+            task_arg += " -warmup " + str(phase.get("warmup", 0))
+            task_arg += " -rate " + str(phase.get("rate", 0))
+            task_arg += " -rate-sweep " + str(phase.get("rateSweep", 0))
+            task_arg += " -thread-sweep " + ",".join(str(n) for n in phase.get("threadSweep", [0]))
+            task_arg += " -thread-sweep-reload " + str(int(phase.get("threadSweepReload", False)))
+            task_arg += " -arrival " + phase.get("arrival", "constant")
+            task_arg += " -scan-length " + str(phase.get("scanLength", 100))
+            task_arg += " -scan-length-random " + phase.get("scanLengthRandom", "Constant")
+            task_arg += " -scan-span " + str(phase.get("scanSpan", 0))
+            task_arg += " -batch " + str(phase.get("batch", 0))
+            task_arg += " -interleave " + str(phase.get("interleave", 0))
+            if phase["type"] == "MIX":
+                if "mix" not in phase:
+                    print("ERROR! MIX phase without a mix!")
+                    exit(-1)
+                task_arg += " -mix " + phase["mix"]
+            if "trace" in phase:
+                task_arg += " -trace " + phase["trace"]
+                task_arg += " -trace-split " + phase.get("traceSplit", "round-robin")
+                task_arg += " -trace-timing " + str(int(phase.get("traceTiming", False)))
+            task_arg += " -latency-sample " + str(phase.get("latencySample", 0.01))
+            task_arg += " -timeline " + str(phase.get("timeline", 0))
+            if "duration" in phase:
+                task_arg += " " + phase["type"] + " " + str(phase["duration"]) + "s"
+            else:
+                task_arg += " " + phase["type"] + " " + str(phase["size"])
         task_arg += " -thread " + str(nr_thread)
+        for key, arg in [("cpus", "-cpus"), ("numaPolicy", "-numa-policy"),
+                         ("memPolicy", "-mem-policy"),
+                         ("pmemEmulate", "-pmem-emulate"),
+                         ("pmemFlushLatency", "-pmem-flush-latency"),
+                         ("pmemFenceLatency", "-pmem-fence-latency")]:
+            if key in settings:
+                task_arg += " " + arg + " " + str(settings[key])
+        if "seed" in settings:
+            task_arg += " -seed " + str(settings["seed"])
         task = bench["task"] + task_arg
         print("Run task: " + task)
         res = os.system(task)
@@ -496,7 +549,10 @@ render_dict["phase_max_min"] = phase_max_min
 render_dict["benchs"] = settings["bench"]
 render_dict["phases"] = settings["phase"]
 for phase in render_dict["phases"]:
-    phase["size"] = human_readable(phase["size"])
+    if "duration" in phase:
+        phase["size"] = str(phase["duration"]) + "s"
+    else:
+        phase["size"] = human_readable(phase["size"])
 
 document = template.render(**render_dict)
 
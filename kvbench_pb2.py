@@ -1,11 +1,10 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
 # source: kvbench.proto
-
-import sys
-_b=sys.version_info[0]<3 and (lambda x:x) or (lambda x:x.encode('latin1'))
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
 from google.protobuf import descriptor as _descriptor
-from google.protobuf import message as _message
-from google.protobuf import reflection as _reflection
+from google.protobuf import descriptor_pool as _descriptor_pool
 from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
@@ -14,138 +13,29 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor.FileDescriptor(
-  name='kvbench.proto',
-  package='kvbench',
-  syntax='proto3',
-  serialized_options=None,
-  serialized_pb=_b('\n\rkvbench.proto\x12\x07kvbench\"\x8a\x01\n\x04Stat\x12\x10\n\x08\x64uration\x18\x01 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x02 \x01(\x01\x12\x13\n\x0bmax_latency\x18\x03 \x01(\x01\x12\x12\n\nthroughput\x18\x04 \x01(\x01\x12\x0f\n\x07latency\x18\x05 \x03(\x01\x12\x0e\n\x06\x66\x61iled\x18\x06 \x01(\x05\x12\r\n\x05total\x18\x07 \x01(\x05\"$\n\x05Stats\x12\x1b\n\x04stat\x18\x01 \x03(\x0b\x32\r.kvbench.Statb\x06proto3')
-)
-
-
-
-
-_STAT = _descriptor.Descriptor(
-  name='Stat',
-  full_name='kvbench.Stat',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='duration', full_name='kvbench.Stat.duration', index=0,
-      number=1, type=1, cpp_type=5, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='average_latency', full_name='kvbench.Stat.average_latency', index=1,
-      number=2, type=1, cpp_type=5, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='max_latency', full_name='kvbench.Stat.max_latency', index=2,
-      number=3, type=1, cpp_type=5, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='throughput', full_name='kvbench.Stat.throughput', index=3,
-      number=4, type=1, cpp_type=5, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='latency', full_name='kvbench.Stat.latency', index=4,
-      number=5, type=1, cpp_type=5, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='failed', full_name='kvbench.Stat.failed', index=5,
-      number=6, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='total', full_name='kvbench.Stat.total', index=6,
-      number=7, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=27,
-  serialized_end=165,
-)
-
-
-_STATS = _descriptor.Descriptor(
-  name='Stats',
-  full_name='kvbench.Stats',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='stat', full_name='kvbench.Stats.stat', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=167,
-  serialized_end=203,
-)
-
-_STATS.fields_by_name['stat'].message_type = _STAT
-DESCRIPTOR.message_types_by_name['Stat'] = _STAT
-DESCRIPTOR.message_types_by_name['Stats'] = _STATS
-_sym_db.RegisterFileDescriptor(DESCRIPTOR)
-
-Stat = _reflection.GeneratedProtocolMessageType('Stat', (_message.Message,), dict(
-  DESCRIPTOR = _STAT,
-  __module__ = 'kvbench_pb2'
-  # @@protoc_insertion_point(class_scope:kvbench.Stat)
-  ))
-_sym_db.RegisterMessage(Stat)
-
-Stats = _reflection.GeneratedProtocolMessageType('Stats', (_message.Message,), dict(
-  DESCRIPTOR = _STATS,
-  __module__ = 'kvbench_pb2'
-  # @@protoc_insertion_point(class_scope:kvbench.Stats)
-  ))
-_sym_db.RegisterMessage(Stats)
-
-
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rkvbench.proto\x12\x07kvbench\"\x86\x01\n\x10LatencyHistogram\x12\x17\n\x0fsub_bucket_bits\x18\x01 \x01(\x05\x12\r\n\x05\x63ount\x18\x02 \x01(\x04\x12\x0b\n\x03sum\x18\x03 \x01(\x04\x12\x0b\n\x03min\x18\x04 \x01(\x04\x12\x0b\n\x03max\x18\x05 \x01(\x04\x12\r\n\x05index\x18\x06 \x03(\r\x12\x14\n\x0c\x62ucket_count\x18\x07 \x03(\x04\"\xf9\x01\n\x0cResourceStat\x12\x11\n\tuser_time\x18\x01 \x01(\x01\x12\x10\n\x08sys_time\x18\x02 \x01(\x01\x12\x14\n\x0cminor_faults\x18\x03 \x01(\x04\x12\x14\n\x0cmajor_faults\x18\x04 \x01(\x04\x12\x1a\n\x12voluntary_switches\x18\x05 \x01(\x04\x12\x1c\n\x14involuntary_switches\x18\x06 \x01(\x04\x12\x11\n\trss_begin\x18\x07 \x01(\x04\x12\x0f\n\x07rss_end\x18\x08 \x01(\x04\x12\x10\n\x08rss_peak\x18\t \x01(\x04\x12\x11\n\tlive_keys\x18\n \x01(\x04\x12\x15\n\rbytes_per_key\x18\x0b \x01(\x01\"\xad\x01\n\nSteadyStat\x12\x0e\n\x06warmup\x18\x01 \x01(\x01\x12\r\n\x05total\x18\x02 \x01(\x04\x12\x12\n\nthroughput\x18\x03 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x04 \x01(\x01\x12\x13\n\x0bmax_latency\x18\x05 \x01(\x01\x12\x13\n\x0bp50_latency\x18\x06 \x01(\x01\x12\x13\n\x0bp99_latency\x18\x07 \x01(\x01\x12\x14\n\x0cp999_latency\x18\x08 \x01(\x01\"W\n\rTimelinePoint\x12\x0c\n\x04time\x18\x01 \x01(\x01\x12\x12\n\nthroughput\x18\x02 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x03 \x01(\x01\x12\x0b\n\x03ops\x18\x04 \x01(\x04\"\xe2\x01\n\x06OpStat\x12\n\n\x02op\x18\x01 \x01(\t\x12\r\n\x05ratio\x18\x02 \x01(\x01\x12\r\n\x05total\x18\x03 \x01(\x04\x12\x12\n\nthroughput\x18\x04 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x05 \x01(\x01\x12\x13\n\x0bmax_latency\x18\x06 \x01(\x01\x12\x13\n\x0bp50_latency\x18\x07 \x01(\x01\x12\x13\n\x0bp99_latency\x18\x08 \x01(\x01\x12\x14\n\x0cp999_latency\x18\t \x01(\x01\x12,\n\thistogram\x18\n \x01(\x0b\x32\x19.kvbench.LatencyHistogram\"\xa3\x01\n\tRatePoint\x12\x14\n\x0coffered_rate\x18\x01 \x01(\x01\x12\x12\n\nthroughput\x18\x02 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x03 \x01(\x01\x12\x13\n\x0bmax_latency\x18\x04 \x01(\x01\x12\x13\n\x0bp50_latency\x18\x05 \x01(\x01\x12\x13\n\x0bp99_latency\x18\x06 \x01(\x01\x12\x14\n\x0cp999_latency\x18\x07 \x01(\x01\"\xb0\x01\n\x0bThreadPoint\x12\x0f\n\x07threads\x18\x01 \x01(\x05\x12\x12\n\nthroughput\x18\x02 \x01(\x01\x12\x0f\n\x07speedup\x18\x03 \x01(\x01\x12\x12\n\nefficiency\x18\x04 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x05 \x01(\x01\x12\x13\n\x0bp50_latency\x18\x06 \x01(\x01\x12\x13\n\x0bp99_latency\x18\x07 \x01(\x01\x12\x14\n\x0cp999_latency\x18\x08 \x01(\x01\"\xd6\x07\n\x04Stat\x12\x10\n\x08\x64uration\x18\x01 \x01(\x01\x12\x17\n\x0f\x61verage_latency\x18\x02 \x01(\x01\x12\x13\n\x0bmax_latency\x18\x03 \x01(\x01\x12\x12\n\nthroughput\x18\x04 \x01(\x01\x12\x0f\n\x07latency\x18\x05 \x03(\x01\x12\x0e\n\x06\x66\x61iled\x18\x06 \x01(\x05\x12\r\n\x05total\x18\x07 \x01(\x03\x12\x14\n\x0c\x62uffer_bytes\x18\x08 \x01(\x04\x12,\n\thistogram\x18\t \x01(\x0b\x32\x19.kvbench.LatencyHistogram\x12\x13\n\x0bp50_latency\x18\n \x01(\x01\x12\x13\n\x0bp90_latency\x18\x0b \x01(\x01\x12\x13\n\x0bp99_latency\x18\x0c \x01(\x01\x12\x14\n\x0cp999_latency\x18\r \x01(\x01\x12\x15\n\rp9999_latency\x18\x0e \x01(\x01\x12\x15\n\rlatency_batch\x18\x0f \x01(\x04\x12\x32\n\x0f\x62\x61tch_histogram\x18\x10 \x01(\x0b\x32\x19.kvbench.LatencyHistogram\x12\x0b\n\x03\x63pu\x18\x11 \x03(\x05\x12#\n\x06steady\x18\x12 \x01(\x0b\x32\x13.kvbench.SteadyStat\x12(\n\x08timeline\x18\x13 \x03(\x0b\x32\x16.kvbench.TimelinePoint\x12\x0b\n\x03mix\x18\x14 \x01(\t\x12 \n\x07op_stat\x18\x15 \x03(\x0b\x32\x0f.kvbench.OpStat\x12\x14\n\x0coffered_rate\x18\x16 \x01(\x01\x12\x0f\n\x07\x61rrival\x18\x17 \x01(\t\x12&\n\nrate_curve\x18\x18 \x03(\x0b\x32\x12.kvbench.RatePoint\x12\x12\n\nscan_items\x18\x19 \x01(\x04\x12\x1c\n\x14scan_item_throughput\x18\x1a \x01(\x01\x12\r\n\x05\x62\x61tch\x18\x1b \x01(\x04\x12\x12\n\ninterleave\x18\x1c \x01(\x04\x12\x10\n\x08key_size\x18\x1d \x01(\t\x12\x12\n\nvalue_size\x18\x1e \x01(\t\x12\x0f\n\x07threads\x18\x1f \x01(\x05\x12*\n\x0cthread_curve\x18  \x03(\x0b\x32\x14.kvbench.ThreadPoint\x12\x1a\n\x12phase_end_duration\x18! \x01(\x01\x12\x14\n\x0cpmem_flushes\x18\" \x01(\x04\x12\x13\n\x0bpmem_fences\x18# \x01(\x04\x12\'\n\x08resource\x18$ \x01(\x0b\x32\x15.kvbench.ResourceStat\x12\x1b\n\x13key_average_latency\x18% \x01(\x01\x12\x30\n\rkey_histogram\x18& \x01(\x0b\x32\x19.kvbench.LatencyHistogram\"\xec\x01\n\x05Stats\x12\x1b\n\x04stat\x18\x01 \x03(\x0b\x32\r.kvbench.Stat\x12\x0c\n\x04seed\x18\x02 \x01(\x04\x12\x14\n\x0c\x63lock_source\x18\x03 \x01(\t\x12\x17\n\x0f\x63lock_frequency\x18\x04 \x01(\x01\x12\x16\n\x0etimer_overhead\x18\x05 \x01(\x01\x12\x13\n\x0bnuma_policy\x18\x06 \x01(\t\x12\x12\n\nmem_policy\x18\x07 \x01(\t\x12\x10\n\x08pmem_dir\x18\x08 \x01(\t\x12\x1a\n\x12pmem_flush_latency\x18\t \x01(\x01\x12\x1a\n\x12pmem_fence_latency\x18\n \x01(\x01\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'kvbench_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _LATENCYHISTOGRAM._serialized_start=27
+  _LATENCYHISTOGRAM._serialized_end=161
+  _RESOURCESTAT._serialized_start=164
+  _RESOURCESTAT._serialized_end=413
+  _STEADYSTAT._serialized_start=416
+  _STEADYSTAT._serialized_end=589
+  _TIMELINEPOINT._serialized_start=591
+  _TIMELINEPOINT._serialized_end=678
+  _OPSTAT._serialized_start=681
+  _OPSTAT._serialized_end=907
+  _RATEPOINT._serialized_start=910
+  _RATEPOINT._serialized_end=1073
+  _THREADPOINT._serialized_start=1076
+  _THREADPOINT._serialized_end=1252
+  _STAT._serialized_start=1255
+  _STAT._serialized_end=2237
+  _STATS._serialized_start=2240
+  _STATS._serialized_end=2476
 # @@protoc_insertion_point(module_scope)
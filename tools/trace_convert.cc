@@ -0,0 +1,123 @@
+// Converts a text trace into the binary format replayed by TRACE phases.
+//
+//   trace_convert [-f text|ycsb] <input> <output>
+//
+// text: one operation per line, "<op> <key> [<value size> [<timestamp ns>]]"
+//       with op one of get/read, put/insert, update, delete, scan and rmw.
+// ycsb: the output of YCSB's basic binding, e.g.
+//       "READ usertable user6284781860667377211 [ <all fields>]". Value sizes
+//       are the length of the field list of inserts and updates.
+//
+// Scans store their length in the value size.
+//
+// Keys that aren't numbers, such as YCSB's "user..." keys, are reduced to
+// the number they contain or hashed if there is none.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "kvbench/trace.h"
+
+using namespace kvbench;
+
+static bool ParseOp(std::string name, MixOp* op) {
+  std::transform(name.begin(), name.end(), name.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  if (name == "get" || name == "read") *op = kMixRead;
+  else if (name == "put" || name == "insert") *op = kMixInsert;
+  else if (name == "update") *op = kMixUpdate;
+  else if (name == "delete") *op = kMixDelete;
+  else if (name == "scan") *op = kMixScan;
+  else if (name == "rmw" || name == "readmodifywrite") *op = kMixReadModifyWrite;
+  else return false;
+  return true;
+}
+
+static uint64_t ParseKey(const std::string& key) {
+  std::string digits;
+  for (char c : key)
+    if (std::isdigit((unsigned char)c)) digits += c;
+  if (!digits.empty() && digits.size() <= 19) return std::stoull(digits);
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  for (unsigned char c : key) {
+    hash ^= c;
+    hash *= 0x100000001B3ULL;
+  }
+  return hash;
+}
+
+int main(int argc, char** argv) {
+  bool ycsb = false;
+  int i = 1;
+  if (argc > 2 && strcmp(argv[1], "-f") == 0) {
+    ycsb = strcmp(argv[2], "ycsb") == 0;
+    if (!ycsb && strcmp(argv[2], "text") != 0) {
+      std::cerr << "ERROR! unknown trace format " << argv[2] << "!" << std::endl;
+      return -1;
+    }
+    i = 3;
+  }
+  if (argc - i != 2) {
+    std::cout << "Usage: " << argv[0] << " [-f text|ycsb] <input> <output>"
+              << std::endl;
+    return -1;
+  }
+
+  std::ifstream input(argv[i]);
+  if (!input) {
+    std::cerr << "ERROR! can't open " << argv[i] << "!" << std::endl;
+    return -1;
+  }
+  TraceWriter writer(argv[i + 1]);
+  std::string line;
+  size_t line_number = 0, skipped = 0;
+  while (std::getline(input, line)) {
+    ++line_number;
+    std::istringstream in(line);
+    std::string name, table, key;
+    MixOp op;
+    if (!(in >> name) || !ParseOp(name, &op)) {
+      ++skipped;
+      continue;
+    }
+    uint64_t value_size = 0, timestamp = 0;
+    if (ycsb) {
+      if (!(in >> table >> key)) {
+        ++skipped;
+        continue;
+      }
+      if (op == kMixScan) {
+        in >> value_size;
+      } else if (op == kMixInsert || op == kMixUpdate) {
+        size_t begin = line.find('['), end = line.rfind(']');
+        if (begin != std::string::npos && end != std::string::npos &&
+            end > begin)
+          value_size = end - begin - 1;
+      }
+    } else {
+      if (!(in >> key)) {
+        std::cerr << "WARNING! no key on line " << line_number << std::endl;
+        ++skipped;
+        continue;
+      }
+      in >> value_size >> timestamp;
+    }
+    // records keep 32-bit value sizes
+    if (value_size > UINT32_MAX) {
+      std::cerr << "WARNING! value size " << value_size << " on line "
+                << line_number << " doesn't fit in 32 bits" << std::endl;
+      ++skipped;
+      continue;
+    }
+    writer.Append(op, ParseKey(key), value_size, timestamp);
+  }
+  std::cout << "Wrote " << writer.Count() << " records to " << argv[i + 1]
+            << ", skipped " << skipped << " lines." << std::endl;
+  return 0;
+}